@@ -1 +0,0 @@
-data/alarm.html
\ No newline at end of file
@@ -0,0 +1,222 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      Animation.cpp                                                                                            *
+ * @brief     Animations stored in LittleFS and played from flash with a read-ahead buffer                             *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#include "Animation.hpp"
+
+#include <LittleFS.h>
+
+#include <cstring>
+#include <new>
+
+#include "FrameCodec.hpp"
+
+namespace Animation {
+namespace {
+constexpr uint8_t MAGIC[4] = {'D', 'M', 'A', '1'};
+// Compressed frames the read-ahead buffer holds in the worst case
+constexpr size_t READ_AHEAD_FRAMES = 2;
+
+// --------------------------------------------------------------------------------------
+inline uint16_t le16(const uint8_t *p) { return static_cast<uint16_t>(p[0] | (p[1] << 8)); }
+
+// --------------------------------------------------------------------------------------
+inline uint32_t le32(const uint8_t *p) { return le16(p) | (static_cast<uint32_t>(le16(p + 2)) << 16); }
+} // namespace
+
+// --------------------------------------------------------------------------------------
+bool valid_name(const String &name) {
+    if (name.isEmpty() || name.length() > MAX_NAME_LEN) {
+        return false;
+    }
+    for (size_t i = 0; i < name.length(); i++) {
+        const char c = name[i];
+        if (!isalnum(static_cast<unsigned char>(c)) && c != '-' && c != '_') {
+            return false;
+        }
+    }
+    return true;
+}
+
+// --------------------------------------------------------------------------------------
+String path(const String &name, const char *extension) { return String(DIR) + name + extension; }
+
+// --------------------------------------------------------------------------------------
+const char *check_header(const uint8_t *data, size_t len, size_t total, uint16_t width, uint16_t height) {
+    if (len < HEADER_SIZE || memcmp(data, MAGIC, sizeof(MAGIC)) != 0) {
+        return "Not an animation file";
+    }
+    if (le16(data + 4) != width || le16(data + 6) != height) {
+        return "Animation size does not match the display";
+    }
+    const uint16_t frame_count = le16(data + 8);
+    if (!frame_count || total < HEADER_SIZE + frame_count * INDEX_ENTRY_SIZE) {
+        return "Animation frame index is missing or truncated";
+    }
+    return nullptr;
+}
+
+// --------------------------------------------------------------------------------------
+Player::Player(Compositor::Canvas &canvas, uint16_t width, uint16_t height)
+    : m_canvas(canvas), m_n_pixels(static_cast<size_t>(width) * height), m_width(width), m_height(height),
+      m_frame_max(1 + FrameCodec::rle_max_size(m_n_pixels)) {}
+
+// --------------------------------------------------------------------------------------
+const char *Player::play(const String &path) {
+    stop();
+    m_file = LittleFS.open(path, "r");
+    if (!m_file) {
+        return "Animation not found";
+    }
+    uint8_t header[HEADER_SIZE];
+    m_file_size = m_file.size();
+    const size_t len = m_file.read(header, sizeof(header));
+    if (const char *error = check_header(header, len, m_file_size, m_width, m_height)) {
+        stop();
+        return error;
+    }
+    m_buffer.reset(new (std::nothrow) uint8_t[READ_AHEAD_FRAMES * m_frame_max]);
+    if (!m_buffer) {
+        stop();
+        return "Not enough memory to play an animation";
+    }
+    m_path = path;
+    m_frame_count = le16(header + 8);
+    m_loops = le16(header + 10);
+    m_loop = 0;
+    m_next_frame = 0;
+    m_end = false;
+    m_used = 0;
+    m_count = 0;
+    fill();
+    if (!m_count) {
+        stop();
+        return "Animation has no readable frame";
+    }
+    m_due_ms = millis();
+    return nullptr;
+}
+
+// --------------------------------------------------------------------------------------
+void Player::stop() {
+    m_file.close();
+    m_path = String();
+    m_buffer.reset();
+    m_used = 0;
+    m_count = 0;
+}
+
+// --------------------------------------------------------------------------------------
+void Player::fill() {
+    const size_t capacity = READ_AHEAD_FRAMES * m_frame_max;
+    while (!m_end && m_count < MAX_QUEUED) {
+        if (m_next_frame == m_frame_count) {
+            if (m_loops && ++m_loop >= m_loops) {
+                m_end = true;
+                break;
+            }
+            m_next_frame = 0;
+        }
+        uint8_t entry[INDEX_ENTRY_SIZE];
+        if (!m_file.seek(HEADER_SIZE + m_next_frame * INDEX_ENTRY_SIZE) ||
+            m_file.read(entry, sizeof(entry)) != sizeof(entry)) {
+            Serial.printf("Animation %s: cannot read frame index %u\n", m_path.c_str(), m_next_frame);
+            m_end = true;
+            break;
+        }
+        const uint32_t offset = le32(entry);
+        const uint16_t len = le16(entry + 4);
+        if (!len || len > m_frame_max || offset > m_file_size || len > m_file_size - offset) {
+            Serial.printf("Animation %s: frame %u is out of bounds\n", m_path.c_str(), m_next_frame);
+            m_end = true;
+            break;
+        }
+        if (m_used + len > capacity) {
+            break; // Read on the next round, once frames ahead of it are shown
+        }
+        if (!m_file.seek(offset) || m_file.read(m_buffer.get() + m_used, len) != len) {
+            Serial.printf("Animation %s: cannot read frame %u\n", m_path.c_str(), m_next_frame);
+            m_end = true;
+            break;
+        }
+        m_queue[m_count++] = {len, le16(entry + 6)};
+        m_used += len;
+        m_next_frame++;
+    }
+}
+
+// --------------------------------------------------------------------------------------
+bool Player::decode(const uint8_t *frame, size_t len) {
+    const uint8_t type = frame[0];
+    size_t decoded = 0;
+    if (type == FRAME_KEY) {
+        decoded = FrameCodec::rle_decode_to(frame + 1, len - 1, m_n_pixels,
+                                            [this](size_t first, const uint8_t *rgb, size_t count) {
+                                                m_canvas.write(first, rgb, count);
+                                            });
+    } else if (type == FRAME_DELTA) {
+        // Unchanged pixels are zero runs: cheap to store, and set() leaves them clean
+        decoded = FrameCodec::rle_decode_to(
+            frame + 1, len - 1, m_n_pixels, [this](size_t first, const uint8_t *rgb, size_t count) {
+                for (size_t i = first; i < first + count; i++, rgb += 3) {
+                    const uint8_t *old = m_canvas.pixels() + i * 3;
+                    m_canvas.set(i, old[0] ^ rgb[0], old[1] ^ rgb[1], old[2] ^ rgb[2]);
+                }
+            });
+    }
+    return decoded == m_n_pixels;
+}
+
+// --------------------------------------------------------------------------------------
+bool Player::run(uint32_t now_ms, uint32_t &wait_ms) {
+    wait_ms = IDLE_POLL_MS;
+    if (!playing()) {
+        return false;
+    }
+    if (!m_count) {
+        Serial.printf("Animation %s finished\n", m_path.c_str());
+        stop(); // The last frame stays
+        return false;
+    }
+    const int32_t early = static_cast<int32_t>(m_due_ms - now_ms);
+    if (early > 0) {
+        // Idle until the deadline: top the read-ahead up now, so flash reads never delay a frame
+        fill();
+        const int32_t left = static_cast<int32_t>(m_due_ms - millis());
+        wait_ms = left > 0 ? static_cast<uint32_t>(left) : 0;
+        return false;
+    }
+    if (static_cast<uint32_t>(-early) > LATE_TOLERANCE_MS) {
+        m_stats.late++;
+    }
+
+    const Queued frame = m_queue[0];
+    const bool ok = decode(m_buffer.get(), frame.len);
+    m_used -= frame.len;
+    memmove(m_buffer.get(), m_buffer.get() + frame.len, m_used);
+    memmove(m_queue, m_queue + 1, --m_count * sizeof(Queued));
+    if (!ok) {
+        Serial.printf("Animation %s: corrupt frame\n", m_path.c_str());
+        stop();
+        return true;
+    }
+    m_stats.frames++;
+
+    // Deadlines follow the file's timeline; after a stall longer than a frame it restarts from now instead of rushing
+    const uint32_t duration = frame.duration_ms > MIN_FRAME_MS ? frame.duration_ms : MIN_FRAME_MS;
+    m_due_ms += duration;
+    if (static_cast<int32_t>(m_due_ms - now_ms) <= 0) {
+        m_due_ms = now_ms + duration;
+    }
+    wait_ms = 0; // Back right after the frame is shown, to read ahead while waiting for the next deadline
+    return true;
+}
+
+} // namespace Animation
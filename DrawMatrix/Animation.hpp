@@ -0,0 +1,177 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      Animation.hpp                                                                                            *
+ * @brief     Animations stored in LittleFS and played from flash with a read-ahead buffer                             *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#ifndef DRAWMATRIX_ANIMATION
+#define DRAWMATRIX_ANIMATION
+
+#include <Arduino.h>
+#include <FS.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "Compositor.hpp"
+
+/**
+ * @brief On-flash animation container and its player.
+ *
+ * File layout, little-endian (tools/animation.py writes it):
+ *
+ *     header  16 B      "DMA1", uint16 width, uint16 height, uint16 frames, uint16 loops (0: forever), 4 reserved
+ *     index   8 B each  uint32 offset of the frame in the file, uint16 its length, uint16 duration (ms)
+ *     frames            one type byte, then FrameCodec RLE of the pixels (logical row-major RGB):
+ *                       FRAME_KEY: the frame itself; FRAME_DELTA: the frame XOR the previous one
+ *
+ * The first frame must be a key frame. Files live in DIR as `<name>` + EXTENSION.
+ */
+namespace Animation {
+
+// Directory of the animation files
+constexpr const char *DIR = "/anim/";
+// Extension of the animation files
+constexpr const char *EXTENSION = ".dma";
+// Longest animation name (letters, digits, '-' and '_')
+constexpr size_t MAX_NAME_LEN = 24;
+// Bytes of the file header
+constexpr size_t HEADER_SIZE = 16;
+// Bytes of a frame index entry
+constexpr size_t INDEX_ENTRY_SIZE = 8;
+// Frame types
+constexpr uint8_t FRAME_KEY = 'K';
+constexpr uint8_t FRAME_DELTA = 'D';
+// Shortest frame duration honoured
+constexpr uint32_t MIN_FRAME_MS = 10;
+// Presented later than this after its time, a frame counts as late
+constexpr uint32_t LATE_TOLERANCE_MS = 5;
+// How often the player looks for work while stopped
+constexpr uint32_t IDLE_POLL_MS = 100;
+
+/**
+ * @brief Whether a name can be used for an animation file.
+ */
+bool valid_name(const String &name);
+
+/**
+ * @brief Path of the animation file with the given name.
+ * @param extension EXTENSION, or that of another format stored with them (Gif::EXTENSION).
+ */
+String path(const String &name, const char *extension = EXTENSION);
+
+/**
+ * @brief Check the start of an animation file being uploaded.
+ * @param data First bytes of the file.
+ * @param len Length of data; must cover the header.
+ * @param total Size of the whole file.
+ * @param width Width the animation must have.
+ * @param height Height the animation must have.
+ * @return nullptr if acceptable, otherwise why not.
+ */
+const char *check_header(const uint8_t *data, size_t len, size_t total, uint16_t width, uint16_t height);
+
+/**
+ * @brief Counters since boot, for /info.
+ */
+struct Stats {
+    uint32_t frames = 0; ///< Frames presented
+    uint32_t late = 0;   ///< Frames presented after their time
+};
+
+/**
+ * @brief Plays an animation file onto the canvas, one frame per deadline.
+ *
+ * Compressed frames are read ahead into a buffer of two worst-case frames while the current one is shown, so flash
+ * latency never reaches a deadline; the only frame buffer is the canvas itself (delta frames are applied to it).
+ */
+class Player {
+  public:
+    /**
+     * @brief Construct a stopped player.
+     * @param canvas Where frames are decoded.
+     * @param width Width of the canvas; animations must have the same size.
+     * @param height Height of the canvas.
+     */
+    Player(Compositor::Canvas &canvas, uint16_t width, uint16_t height);
+
+    /**
+     * @brief Start playing a file from its first frame; stops the current animation.
+     * @return nullptr on success, otherwise why it cannot be played.
+     */
+    const char *play(const String &path);
+
+    /**
+     * @brief Stop playing and free the read-ahead buffer; the last frame stays on the canvas.
+     */
+    void stop();
+
+    bool playing() const { return static_cast<bool>(m_file); }
+
+    /**
+     * @brief Path of the file playing, empty when stopped.
+     */
+    const String &current() const { return m_path; }
+
+    /**
+     * @brief Decode the frame due (if any) into the canvas; call from the scheduler.
+     * @param now_ms Current millis().
+     * @param wait_ms Set to the milliseconds until the next frame is due.
+     * @return Whether a frame was decoded (the canvas needs showing).
+     */
+    bool run(uint32_t now_ms, uint32_t &wait_ms);
+
+    /**
+     * @brief Counters since boot.
+     */
+    const Stats &stats() const { return m_stats; }
+
+  private:
+    struct Queued {
+        uint16_t len;
+        uint16_t duration_ms;
+    };
+
+    static constexpr size_t MAX_QUEUED = 16;
+
+    /**
+     * @brief Read frames ahead until the buffer or the queue is full, looping as the header says.
+     */
+    void fill();
+
+    /**
+     * @brief Decode a compressed frame into the canvas.
+     */
+    bool decode(const uint8_t *frame, size_t len);
+
+    Compositor::Canvas &m_canvas;
+    size_t m_n_pixels;
+    uint16_t m_width;
+    uint16_t m_height;
+    size_t m_frame_max; // Largest valid compressed frame
+    File m_file;
+    String m_path;
+    size_t m_file_size = 0;
+    uint16_t m_frame_count = 0;
+    uint16_t m_loops = 0;
+    uint16_t m_loop = 0;       // Loops completed
+    uint16_t m_next_frame = 0; // Next frame to read
+    bool m_end = false;        // Nothing more to read
+
+    std::unique_ptr<uint8_t[]> m_buffer; // Read-ahead: compressed frames back to back
+    size_t m_used = 0;
+    Queued m_queue[MAX_QUEUED];
+    size_t m_count = 0;
+    uint32_t m_due_ms = 0; // When the first queued frame is due
+    Stats m_stats;
+};
+
+} // namespace Animation
+
+#endif /* DRAWMATRIX_ANIMATION */
@@ -0,0 +1,132 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      Autosave.cpp                                                                                             *
+ * @brief     Canvas saved to LittleFS once edits stop, restored at power-up                                           *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#include "Autosave.hpp"
+
+#include <LittleFS.h>
+#include <coredecls.h> // crc32
+
+#include <cstring>
+#include <memory>
+#include <new>
+
+#include "FrameCodec.hpp"
+
+namespace Autosave {
+namespace {
+constexpr uint8_t MAGIC[4] = {'D', 'M', 'C', '1'};
+constexpr size_t HEADER_SIZE = 12;
+constexpr const char *TEMP_PATH = "/canvas.tmp";
+
+// --------------------------------------------------------------------------------------
+inline uint16_t le16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+
+// --------------------------------------------------------------------------------------
+inline uint32_t le32(const uint8_t *p) { return le16(p) | (static_cast<uint32_t>(le16(p + 2)) << 16); }
+} // namespace
+
+// --------------------------------------------------------------------------------------
+Saver::Saver(Compositor::Canvas &canvas) : m_canvas(canvas) {}
+
+// --------------------------------------------------------------------------------------
+bool Saver::restore() {
+    const uint32_t start = micros();
+    File file = LittleFS.open(PATH, "r");
+    if (!file) {
+        return false;
+    }
+    const size_t n_pixels = static_cast<size_t>(m_canvas.width()) * m_canvas.height();
+    const size_t size = file.size();
+    uint8_t header[HEADER_SIZE];
+    if (size <= HEADER_SIZE || size > HEADER_SIZE + FrameCodec::rle_max_size(n_pixels) ||
+        file.read(header, HEADER_SIZE) != HEADER_SIZE || memcmp(header, MAGIC, sizeof(MAGIC)) != 0 ||
+        le16(header + 4) != m_canvas.width() || le16(header + 6) != m_canvas.height()) {
+        Serial.println("Saved canvas does not fit the display");
+        return false;
+    }
+    const size_t len = size - HEADER_SIZE;
+    std::unique_ptr<uint8_t[]> data(new (std::nothrow) uint8_t[len]);
+    if (!data || file.read(data.get(), len) != len || crc32(data.get(), len) != le32(header + 8)) {
+        Serial.println("Saved canvas is damaged");
+        return false;
+    }
+    // Decoded in place of the current pixels: only a complete frame is accepted
+    std::unique_ptr<uint8_t[]> pixels(new (std::nothrow) uint8_t[n_pixels * FrameCodec::BYTES_PER_PIXEL]);
+    if (!pixels || FrameCodec::rle_decode(data.get(), len, pixels.get(), n_pixels) != n_pixels) {
+        Serial.println("Saved canvas is damaged");
+        return false;
+    }
+    memcpy(m_canvas.pixels(), pixels.get(), n_pixels * FrameCodec::BYTES_PER_PIXEL);
+    m_canvas.invalidate();
+    m_crc = le32(header + 8);
+    m_stats.bytes = size;
+    m_stats.restore_us = micros() - start;
+    return true;
+}
+
+// --------------------------------------------------------------------------------------
+void Saver::poll(uint32_t seq, uint32_t now_ms) {
+    if (seq != m_seq) {
+        m_seq = seq;
+        m_changed_ms = now_ms;
+        m_pending = true;
+        return;
+    }
+    if (!m_pending || now_ms - m_changed_ms < IDLE_MS || (m_stats.writes && now_ms - m_saved_ms < MIN_INTERVAL_MS)) {
+        return;
+    }
+    m_pending = false;
+    save();
+    m_saved_ms = now_ms;
+}
+
+// --------------------------------------------------------------------------------------
+void Saver::save() {
+    const size_t n_pixels = static_cast<size_t>(m_canvas.width()) * m_canvas.height();
+    const size_t capacity = HEADER_SIZE + FrameCodec::rle_max_size(n_pixels);
+    std::unique_ptr<uint8_t[]> out(new (std::nothrow) uint8_t[capacity]);
+    if (!out) {
+        m_stats.failed++;
+        Serial.println("Not enough memory to save the canvas");
+        return;
+    }
+    const size_t len = FrameCodec::rle_encode(m_canvas.pixels(), n_pixels, out.get() + HEADER_SIZE,
+                                              capacity - HEADER_SIZE);
+    const uint32_t crc = crc32(out.get() + HEADER_SIZE, len);
+    if (crc == m_crc) {
+        m_stats.unchanged++;
+        return;
+    }
+    memcpy(out.get(), MAGIC, sizeof(MAGIC));
+    const uint32_t fields[] = {m_canvas.width(), m_canvas.height()};
+    for (size_t k = 0; k < 2; k++) {
+        out[4 + k * 2] = fields[k] & 0xFF;
+        out[5 + k * 2] = fields[k] >> 8;
+    }
+    for (size_t k = 0; k < 4; k++) {
+        out[8 + k] = (crc >> (8 * k)) & 0xFF;
+    }
+
+    File file = LittleFS.open(TEMP_PATH, "w");
+    const bool written = file && file.write(out.get(), HEADER_SIZE + len) == HEADER_SIZE + len;
+    file.close();
+    if (!written || !LittleFS.rename(TEMP_PATH, PATH)) {
+        LittleFS.remove(TEMP_PATH);
+        m_stats.failed++;
+        Serial.println("Failed to save the canvas");
+        return;
+    }
+    m_crc = crc;
+    m_stats.writes++;
+    m_stats.bytes = HEADER_SIZE + len;
+}
+
+} // namespace Autosave
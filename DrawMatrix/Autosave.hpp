@@ -0,0 +1,89 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      Autosave.hpp                                                                                             *
+ * @brief     Canvas saved to LittleFS once edits stop, restored at power-up                                           *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#ifndef DRAWMATRIX_AUTOSAVE
+#define DRAWMATRIX_AUTOSAVE
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Compositor.hpp"
+
+/**
+ * @brief The RTC checkpoint (RtcState) survives resets, not power cycles; this is its flash counterpart.
+ *
+ * PATH holds a 12-byte header ("DMC1", width, height as 16-bit little-endian, CRC-32 of the rest) and the canvas in
+ * FrameCodec RLE, usually a few hundred bytes. It is written to a temporary file and renamed, so a power cut leaves the
+ * previous save intact. Writes wait until the canvas has been still for IDLE_MS, happen at most once per
+ * MIN_INTERVAL_MS and are skipped when the content is what the file already holds: a drawing session costs a handful
+ * of flash writes, a stream or an animation none until it stops.
+ */
+namespace Autosave {
+
+// Saved canvas
+constexpr const char *PATH = "/canvas.rle";
+// Quiet time after the last change before saving
+constexpr uint32_t IDLE_MS = 5000;
+// Shortest time between two writes
+constexpr uint32_t MIN_INTERVAL_MS = 60000;
+
+/**
+ * @brief Counters, for /info.
+ */
+struct Stats {
+    uint32_t writes = 0;     ///< Files written since boot
+    uint32_t unchanged = 0;  ///< Saves skipped: the file already held the canvas
+    uint32_t failed = 0;     ///< Saves that could not be written
+    size_t bytes = 0;        ///< Size of the saved file
+    uint32_t restore_us = 0; ///< Time the restore at boot took, 0 if nothing was restored
+};
+
+class Saver {
+  public:
+    /**
+     * @brief Construct the saver.
+     * @param canvas Canvas saved and restored; must outlive the saver.
+     */
+    explicit Saver(Compositor::Canvas &canvas);
+
+    /**
+     * @brief Load the saved canvas (LittleFS must be mounted); the caller refreshes the display.
+     * @return false if there is none, or it does not fit this canvas or is damaged; the canvas is then untouched.
+     */
+    bool restore();
+
+    /**
+     * @brief Call periodically: saves the canvas once it stopped changing, within the rate limit.
+     * @param seq Counter bumped on every canvas change shown (DrawMatrix::frame_seq).
+     * @param now_ms millis().
+     */
+    void poll(uint32_t seq, uint32_t now_ms);
+
+    const Stats &stats() const { return m_stats; }
+
+  private:
+    /**
+     * @brief Write the canvas unless the file already holds it.
+     */
+    void save();
+
+    Compositor::Canvas &m_canvas;
+    uint32_t m_seq = 0;        // seq at the last poll
+    uint32_t m_changed_ms = 0; // When it last changed
+    uint32_t m_saved_ms = 0;   // When the file was last written
+    bool m_pending = false;    // Changed since the last save
+    uint32_t m_crc = 0;        // CRC of the saved data, 0 if unknown
+    Stats m_stats;
+};
+
+} // namespace Autosave
+
+#endif /* DRAWMATRIX_AUTOSAVE */
@@ -0,0 +1,206 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      Compositor.cpp                                                                                           *
+ * @brief     Layered display: user canvas, clock and overlay composited region by region                              *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#include "Compositor.hpp"
+
+#include <cstring>
+#include <new>
+
+#include <gamma.h> // Adafruit_NeoMatrix: GFX colours look the same as when drawn on the matrix directly
+
+namespace Compositor {
+namespace {
+
+// --------------------------------------------------------------------------------------
+void blend(const Layer &layer, size_t i, uint8_t rgb[3]) {
+    const uint16_t color = layer.at(i);
+    const uint8_t alpha = layer.alpha();
+    if (color == Layer::TRANSPARENT || !alpha) {
+        return;
+    }
+    const uint8_t src[3] = {pgm_read_byte(&gamma5[color >> 11]), pgm_read_byte(&gamma6[(color >> 5) & 0x3F]),
+                            pgm_read_byte(&gamma5[color & 0x1F])};
+    for (size_t k = 0; k < 3; k++) {
+        rgb[k] = alpha == 255 ? src[k] : static_cast<uint8_t>(rgb[k] + (src[k] - rgb[k]) * alpha / 255);
+    }
+}
+
+} // namespace
+
+// --------------------------------------------------------------------------------------
+void Rect::add(int16_t x, int16_t y) {
+    if (empty()) {
+        x0 = x1 = x;
+        y0 = y1 = y;
+        return;
+    }
+    x0 = x < x0 ? x : x0;
+    x1 = x > x1 ? x : x1;
+    y0 = y < y0 ? y : y0;
+    y1 = y > y1 ? y : y1;
+}
+
+// --------------------------------------------------------------------------------------
+void Rect::add(const Rect &other) {
+    if (!other.empty()) {
+        add(other.x0, other.y0);
+        add(other.x1, other.y1);
+    }
+}
+
+// --------------------------------------------------------------------------------------
+Canvas::Canvas(uint16_t width, uint16_t height)
+    : m_width(width), m_height(height), m_pixels(new uint8_t[static_cast<size_t>(width) * height * 3]()) {}
+
+// --------------------------------------------------------------------------------------
+void Canvas::set(size_t i, uint8_t r, uint8_t g, uint8_t b) {
+    uint8_t *pixel = m_pixels.get() + i * 3;
+    if (pixel[0] == r && pixel[1] == g && pixel[2] == b) {
+        return;
+    }
+    if (m_recorder) {
+        m_recorder->changing(i, pixel);
+    }
+    pixel[0] = r;
+    pixel[1] = g;
+    pixel[2] = b;
+    m_dirty.add(static_cast<int16_t>(i % m_width), static_cast<int16_t>(i / m_width));
+}
+
+// --------------------------------------------------------------------------------------
+void Canvas::write(size_t first, const uint8_t *rgb, size_t count) {
+    for (size_t i = first; i < first + count; i++, rgb += 3) {
+        set(i, rgb[0], rgb[1], rgb[2]);
+    }
+}
+
+// --------------------------------------------------------------------------------------
+void Canvas::fill(uint8_t r, uint8_t g, uint8_t b) { fill_rect(0, 0, m_width, m_height, r, g, b); }
+
+// --------------------------------------------------------------------------------------
+void Canvas::fill_rect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t r, uint8_t g, uint8_t b) {
+    const int16_t x0 = x < 0 ? 0 : x;
+    const int16_t y0 = y < 0 ? 0 : y;
+    const int16_t x1 = x + w > m_width ? m_width : x + w; // Exclusive
+    const int16_t y1 = y + h > m_height ? m_height : y + h;
+    for (int16_t row = y0; row < y1; row++) {
+        const size_t first = static_cast<size_t>(row) * m_width;
+        uint8_t *pixel = m_pixels.get() + (first + x0) * 3;
+        bool changed = false;
+        for (int16_t col = x0; col < x1; col++, pixel += 3) {
+            if (pixel[0] == r && pixel[1] == g && pixel[2] == b) {
+                continue;
+            }
+            if (m_recorder) {
+                m_recorder->changing(first + col, pixel);
+            }
+            pixel[0] = r;
+            pixel[1] = g;
+            pixel[2] = b;
+            changed = true;
+        }
+        if (changed) {
+            m_dirty.add(x0, row);
+            m_dirty.add(x1 - 1, row);
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------
+void Canvas::invalidate() {
+    m_dirty = {0, 0, static_cast<int16_t>(m_width - 1), static_cast<int16_t>(m_height - 1)};
+}
+
+// --------------------------------------------------------------------------------------
+Layer::Layer(uint16_t width, uint16_t height) : Adafruit_GFX(width, height) {}
+
+// --------------------------------------------------------------------------------------
+bool Layer::begin() {
+    if (active()) {
+        return true;
+    }
+    const size_t n_pixels = static_cast<size_t>(WIDTH) * HEIGHT;
+    m_pixels.reset(new (std::nothrow) uint16_t[n_pixels]);
+    if (!m_pixels) {
+        return false;
+    }
+    static_assert(TRANSPARENT == 0, "Layers are cleared with memset");
+    memset(m_pixels.get(), 0, n_pixels * sizeof(uint16_t));
+    m_extent.clear();
+    return true;
+}
+
+// --------------------------------------------------------------------------------------
+void Layer::end() {
+    m_pixels.reset();
+    m_dirty.add(m_extent);
+    m_extent.clear();
+}
+
+// --------------------------------------------------------------------------------------
+void Layer::set_alpha(uint8_t alpha) {
+    if (alpha != m_alpha) {
+        m_alpha = alpha;
+        m_dirty.add(m_extent);
+    }
+}
+
+// --------------------------------------------------------------------------------------
+void Layer::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if (!m_pixels || x < 0 || y < 0 || x >= WIDTH || y >= HEIGHT) {
+        return;
+    }
+    uint16_t &pixel = m_pixels[static_cast<size_t>(y) * WIDTH + x];
+    if (pixel == color) {
+        return;
+    }
+    pixel = color;
+    m_dirty.add(x, y);
+    if (color != TRANSPARENT) {
+        m_extent.add(x, y);
+    }
+}
+
+// --------------------------------------------------------------------------------------
+void Layer::fillScreen(uint16_t color) {
+    if (!m_pixels) {
+        return;
+    }
+    if (color == TRANSPARENT) {
+        for (int16_t y = m_extent.y0; y <= m_extent.y1; y++) {
+            for (int16_t x = m_extent.x0; x <= m_extent.x1; x++) {
+                m_pixels[static_cast<size_t>(y) * WIDTH + x] = TRANSPARENT;
+            }
+        }
+        m_dirty.add(m_extent);
+        m_extent.clear();
+        return;
+    }
+    const size_t n_pixels = static_cast<size_t>(WIDTH) * HEIGHT;
+    for (size_t i = 0; i < n_pixels; i++) {
+        m_pixels[i] = color;
+    }
+    m_extent = {0, 0, static_cast<int16_t>(WIDTH - 1), static_cast<int16_t>(HEIGHT - 1)};
+    m_dirty.add(m_extent);
+}
+
+// --------------------------------------------------------------------------------------
+Scene::Scene(uint16_t width, uint16_t height)
+    : canvas(width, height), clock(width, height), overlay(width, height), m_width(width), m_height(height) {}
+
+// --------------------------------------------------------------------------------------
+void Scene::pixel(size_t i, uint8_t rgb[3]) const {
+    memcpy(rgb, canvas.pixels() + i * 3, 3);
+    blend(clock, i, rgb);
+    blend(overlay, i, rgb);
+}
+
+} // namespace Compositor
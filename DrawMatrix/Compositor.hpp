@@ -0,0 +1,242 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      Compositor.hpp                                                                                           *
+ * @brief     Layered display: user canvas, clock and overlay composited region by region                              *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#ifndef DRAWMATRIX_COMPOSITOR
+#define DRAWMATRIX_COMPOSITOR
+
+#include <Adafruit_GFX.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/**
+ * @brief A fixed stack of layers, bottom to top: the canvas (what users draw or stream, 24-bit, opaque), the clock
+ * and a transient overlay (both Adafruit_GFX surfaces, RGB565, black is transparent, optional alpha).
+ *
+ * Every layer records the region changed since the last composite; Scene::compose() recomputes only the union of
+ * those regions, so the clock ticking over a drawing rewrites the digits, not the picture. Pixels are logical,
+ * row-major; mapping to the strip is up to the caller.
+ */
+namespace Compositor {
+
+/**
+ * @brief Inclusive pixel rectangle; empty by default.
+ */
+struct Rect {
+    int16_t x0 = 0;
+    int16_t y0 = 0;
+    int16_t x1 = -1;
+    int16_t y1 = -1;
+
+    bool empty() const { return x1 < x0 || y1 < y0; }
+    void add(int16_t x, int16_t y);
+    void add(const Rect &other);
+    void clear() { *this = Rect(); }
+};
+
+/**
+ * @brief Told about every canvas pixel about to change, e.g. to keep an undo history. Writes made directly through
+ * Canvas::pixels() are not reported.
+ */
+class Recorder {
+  public:
+    virtual ~Recorder() = default;
+
+    /**
+     * @param i Logical index of the pixel.
+     * @param rgb Its colour until now.
+     */
+    virtual void changing(size_t i, const uint8_t rgb[3]) = 0;
+};
+
+/**
+ * @brief Bottom layer: the user's picture in 24-bit RGB.
+ */
+class Canvas {
+  public:
+    /**
+     * @brief Construct a black canvas.
+     */
+    Canvas(uint16_t width, uint16_t height);
+
+    /**
+     * @brief Set one pixel; unchanged pixels are not marked dirty.
+     * @param i Logical index (row-major).
+     */
+    void set(size_t i, uint8_t r, uint8_t g, uint8_t b);
+
+    /**
+     * @brief Set consecutive pixels.
+     * @param first Logical index of the first pixel.
+     * @param rgb Pixels, 3 bytes each.
+     * @param count Number of pixels; must fit in the canvas.
+     */
+    void write(size_t first, const uint8_t *rgb, size_t count);
+
+    /**
+     * @brief Set every pixel to one colour.
+     */
+    void fill(uint8_t r, uint8_t g, uint8_t b);
+
+    /**
+     * @brief Set a rectangle to one colour, row span by row span; the part outside the canvas is ignored and only
+     * rows that changed are marked dirty.
+     */
+    void fill_rect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t r, uint8_t g, uint8_t b);
+
+    uint16_t width() const { return m_width; }
+    uint16_t height() const { return m_height; }
+
+    /**
+     * @brief The pixels, 3 bytes each; call invalidate() after writing them directly.
+     */
+    uint8_t *pixels() { return m_pixels.get(); }
+    const uint8_t *pixels() const { return m_pixels.get(); }
+
+    /**
+     * @brief Mark the whole canvas changed.
+     */
+    void invalidate();
+
+    const Rect &dirty() const { return m_dirty; }
+    void clean() { m_dirty.clear(); }
+
+    /**
+     * @brief Report pixel changes to a recorder, nullptr for none.
+     */
+    void set_recorder(Recorder *recorder) { m_recorder = recorder; }
+
+  private:
+    uint16_t m_width;
+    uint16_t m_height;
+    std::unique_ptr<uint8_t[]> m_pixels;
+    Rect m_dirty;
+    Recorder *m_recorder = nullptr;
+};
+
+/**
+ * @brief Upper layer drawn with the Adafruit_GFX API; its memory exists only between begin() and end().
+ */
+class Layer : public Adafruit_GFX {
+  public:
+    // Colour key: pixels of this colour let the layers below show through
+    static constexpr uint16_t TRANSPARENT = 0;
+
+    /**
+     * @brief Construct an inactive layer.
+     */
+    Layer(uint16_t width, uint16_t height);
+
+    /**
+     * @brief Allocate a transparent layer, unless already active.
+     * @return false when out of memory.
+     */
+    bool begin();
+
+    /**
+     * @brief Free the layer; what it covered is uncovered on the next composite.
+     */
+    void end();
+
+    bool active() const { return m_pixels != nullptr; }
+
+    /**
+     * @brief Opacity of the drawn pixels, 255 for opaque.
+     */
+    void set_alpha(uint8_t alpha);
+    uint8_t alpha() const { return m_alpha; }
+
+    /**
+     * @brief Pixel at a logical index, TRANSPARENT while inactive.
+     */
+    uint16_t at(size_t i) const { return m_pixels ? m_pixels[i] : TRANSPARENT; }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+
+    /**
+     * @brief Clearing to TRANSPARENT only touches (and dirties) what was drawn since the last clear.
+     */
+    void fillScreen(uint16_t color) override;
+
+    const Rect &dirty() const { return m_dirty; }
+    void clean() { m_dirty.clear(); }
+
+  private:
+    std::unique_ptr<uint16_t[]> m_pixels;
+    Rect m_extent; // Opaque pixels drawn since the last clear
+    Rect m_dirty;
+    uint8_t m_alpha = 255;
+};
+
+/**
+ * @brief The layer stack and its composite.
+ */
+class Scene {
+  public:
+    Scene(uint16_t width, uint16_t height);
+
+    /**
+     * @brief Mark everything changed, e.g. when the output scaling (brightness) changes.
+     */
+    void invalidate() { m_invalid = true; }
+
+    /**
+     * @brief Composite of one pixel.
+     * @param i Logical index.
+     * @param rgb Set to the resulting colour.
+     */
+    void pixel(size_t i, uint8_t rgb[3]) const;
+
+    /**
+     * @brief Composite the changed region and hand every pixel in it to `write(i, rgb)`, then mark all clean.
+     * @return Whether anything was written.
+     */
+    template <typename Write> bool compose(Write &&write) {
+        Rect area;
+        if (m_invalid) {
+            area = {0, 0, static_cast<int16_t>(m_width - 1), static_cast<int16_t>(m_height - 1)};
+        } else {
+            area.add(canvas.dirty());
+            area.add(clock.dirty());
+            area.add(overlay.dirty());
+        }
+        canvas.clean();
+        clock.clean();
+        overlay.clean();
+        m_invalid = false;
+        if (area.empty()) {
+            return false;
+        }
+        uint8_t rgb[3];
+        for (int16_t y = area.y0; y <= area.y1; y++) {
+            for (int16_t x = area.x0; x <= area.x1; x++) {
+                const size_t i = static_cast<size_t>(y) * m_width + x;
+                pixel(i, rgb);
+                write(i, rgb);
+            }
+        }
+        return true;
+    }
+
+    Canvas canvas;
+    Layer clock;
+    Layer overlay;
+
+  private:
+    uint16_t m_width;
+    uint16_t m_height;
+    bool m_invalid = true;
+};
+
+} // namespace Compositor
+
+#endif /* DRAWMATRIX_COMPOSITOR */
@@ -1 +0,0 @@
-data/draw.html
\ No newline at end of file
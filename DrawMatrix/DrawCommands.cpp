@@ -0,0 +1,284 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      DrawCommands.cpp                                                                                         *
+ * @brief     Compact drawing commands (pixels, lines, rectangles, flood fill, blits, text) run on the canvas          *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#include "DrawCommands.hpp"
+
+#include <Fonts/TomThumb.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <new>
+
+namespace DrawCommands {
+namespace {
+constexpr uint8_t FONT_CLASSIC = 0;
+constexpr uint8_t FONT_TOM_THUMB = 1;
+// TomThumb is positioned by its baseline, 5 pixels below the top of its capitals
+constexpr int16_t TOM_THUMB_ASCENT = 5;
+
+// --------------------------------------------------------------------------------------
+uint8_t n_args(uint8_t op) {
+    switch (op) {
+    case OP_CLEAR:
+        return 3;
+    case OP_PIXELS:
+        return 3;
+    case OP_BLIT:
+        return 4;
+    case OP_PIXEL:
+    case OP_FLOOD_FILL:
+        return 5;
+    case OP_LINE:
+    case OP_RECT:
+    case OP_FILL_RECT:
+        return 7;
+    case OP_TEXT:
+        return 8;
+    default:
+        return 0;
+    }
+}
+} // namespace
+
+// --------------------------------------------------------------------------------------
+Interpreter::Surface::Surface(Compositor::Canvas &canvas)
+    : Adafruit_GFX(canvas.width(), canvas.height()), m_canvas(canvas) {}
+
+// --------------------------------------------------------------------------------------
+void Interpreter::Surface::drawPixel(int16_t x, int16_t y, uint16_t) {
+    if (x >= 0 && y >= 0 && x < WIDTH && y < HEIGHT) {
+        m_canvas.set(static_cast<size_t>(y) * WIDTH + x, rgb[0], rgb[1], rgb[2]);
+    }
+}
+
+// --------------------------------------------------------------------------------------
+void Interpreter::Surface::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t) {
+    m_canvas.fill_rect(x, y, w, h, rgb[0], rgb[1], rgb[2]);
+}
+
+// --------------------------------------------------------------------------------------
+void Interpreter::Surface::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t) {
+    m_canvas.fill_rect(x, y, w, 1, rgb[0], rgb[1], rgb[2]);
+}
+
+// --------------------------------------------------------------------------------------
+void Interpreter::Surface::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t) {
+    m_canvas.fill_rect(x, y, 1, h, rgb[0], rgb[1], rgb[2]);
+}
+
+// --------------------------------------------------------------------------------------
+void Interpreter::Surface::fillScreen(uint16_t) { m_canvas.fill(rgb[0], rgb[1], rgb[2]); }
+
+// --------------------------------------------------------------------------------------
+Interpreter::Interpreter(Compositor::Canvas &canvas) : m_canvas(canvas), m_surface(canvas) {
+    m_surface.setTextWrap(false);
+}
+
+// --------------------------------------------------------------------------------------
+void Interpreter::begin() {
+    m_op = 0;
+    m_payload = 0;
+    m_n_pixel = 0;
+    m_error = nullptr;
+}
+
+// --------------------------------------------------------------------------------------
+bool Interpreter::feed(const uint8_t *data, size_t len) {
+    for (size_t i = 0; i < len && !m_error;) {
+        if (!m_op) {
+            m_n_args = n_args(data[i]);
+            if (!m_n_args) {
+                m_error = "Unknown draw command";
+                break;
+            }
+            m_op = data[i++];
+            m_have = 0;
+            continue;
+        }
+        if (m_have < m_n_args) {
+            m_args[m_have++] = data[i++];
+            if (m_have == m_n_args) {
+                run();
+            }
+            continue;
+        }
+
+        if (m_op == OP_TEXT) {
+            if (m_next < MAX_TEXT) {
+                m_text[m_next] = static_cast<char>(data[i]);
+            }
+            m_next++;
+            i++;
+            m_payload--;
+        } else if (m_n_pixel || len - i < 3) {
+            // A pixel split between chunks
+            m_pixel[m_n_pixel++] = data[i++];
+            m_payload--;
+            if (m_n_pixel == 3) {
+                payload_pixels(m_pixel, 1);
+                m_n_pixel = 0;
+            }
+        } else {
+            // Whole pixels straight from the input
+            const size_t count = std::min(m_payload, len - i) / 3;
+            payload_pixels(data + i, count);
+            i += count * 3;
+            m_payload -= count * 3;
+        }
+        if (!m_payload) {
+            finish();
+        }
+    }
+    return !m_error;
+}
+
+// --------------------------------------------------------------------------------------
+void Interpreter::run() {
+    const uint8_t *a = m_args;
+    m_next = 0;
+    m_payload = 0;
+    switch (m_op) {
+    case OP_PIXEL:
+        if (a[0] < m_canvas.width() && a[1] < m_canvas.height()) {
+            m_canvas.set(static_cast<size_t>(a[1]) * m_canvas.width() + a[0], a[2], a[3], a[4]);
+        }
+        break;
+    case OP_PIXELS:
+        m_payload = a[2] * 3;
+        break;
+    case OP_LINE:
+        memcpy(m_surface.rgb, a + 4, 3);
+        m_surface.drawLine(a[0], a[1], a[2], a[3], 0);
+        break;
+    case OP_RECT:
+        memcpy(m_surface.rgb, a + 4, 3);
+        m_surface.drawRect(a[0], a[1], a[2], a[3], 0);
+        break;
+    case OP_FILL_RECT:
+        m_canvas.fill_rect(a[0], a[1], a[2], a[3], a[4], a[5], a[6]);
+        break;
+    case OP_CLEAR:
+        m_canvas.fill(a[0], a[1], a[2]);
+        break;
+    case OP_FLOOD_FILL:
+        flood_fill(a[0], a[1]);
+        break;
+    case OP_BLIT:
+        m_payload = a[2] * a[3] * 3;
+        break;
+    case OP_TEXT:
+        if (a[5] != FONT_CLASSIC && a[5] != FONT_TOM_THUMB) {
+            m_error = "Unknown font";
+            return;
+        }
+        m_payload = a[7];
+        break;
+    }
+    if (!m_payload) {
+        finish();
+    }
+}
+
+// --------------------------------------------------------------------------------------
+void Interpreter::payload_pixels(const uint8_t *rgb, size_t count) {
+    const uint16_t width = m_canvas.width();
+    const size_t n_pixels = static_cast<size_t>(width) * m_canvas.height();
+    if (m_op == OP_PIXELS) {
+        // Consecutive logical pixels: one write through the canvas
+        const size_t first = static_cast<size_t>(m_args[1]) * width + m_args[0] + m_next;
+        if (first < n_pixels) {
+            m_canvas.write(first, rgb, std::min(count, n_pixels - first));
+        }
+        m_next += count;
+        return;
+    }
+    for (size_t k = 0; k < count; k++, m_next++, rgb += 3) {
+        const size_t x = m_args[0] + m_next % m_args[2];
+        const size_t y = m_args[1] + m_next / m_args[2];
+        if (x < width && y < m_canvas.height()) {
+            m_canvas.set(y * width + x, rgb[0], rgb[1], rgb[2]);
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------
+void Interpreter::finish() {
+    if (m_op == OP_TEXT) {
+        m_text[std::min(m_next, MAX_TEXT)] = '\0';
+        const uint8_t size = m_args[6] ? m_args[6] : 1;
+        const bool tom_thumb = m_args[5] == FONT_TOM_THUMB;
+        memcpy(m_surface.rgb, m_args + 2, 3);
+        m_surface.setFont(tom_thumb ? &TomThumb : nullptr);
+        m_surface.setTextSize(size);
+        m_surface.setTextColor(0); // Transparent background
+        m_surface.setCursor(m_args[0], m_args[1] + (tom_thumb ? TOM_THUMB_ASCENT * size : 0));
+        m_surface.print(m_text);
+    }
+    m_op = 0;
+    m_executed++;
+}
+
+// --------------------------------------------------------------------------------------
+void Interpreter::flood_fill(uint8_t x, uint8_t y) {
+    const uint16_t width = m_canvas.width();
+    const uint16_t height = m_canvas.height();
+    if (x >= width || y >= height) {
+        return;
+    }
+    const uint8_t *rgb = m_args + 2;
+    const uint8_t *pixels = m_canvas.pixels();
+    uint8_t target[3];
+    memcpy(target, pixels + (static_cast<size_t>(y) * width + x) * 3, 3);
+    if (!memcmp(target, rgb, 3)) {
+        return;
+    }
+    auto is_target = [&](size_t col, size_t row) { return !memcmp(pixels + (row * width + col) * 3, target, 3); };
+
+    // Scanline fill: each seed grows into a row span, filled at once; the spans above and below seed the next ones
+    const size_t capacity = static_cast<size_t>(width) * height;
+    std::unique_ptr<uint16_t[]> seeds(new (std::nothrow) uint16_t[capacity]);
+    if (!seeds) {
+        m_error = "Not enough memory to flood fill";
+        return;
+    }
+    size_t n_seeds = 0;
+    seeds[n_seeds++] = static_cast<uint16_t>(y * width + x);
+    while (n_seeds) {
+        const size_t seed = seeds[--n_seeds];
+        const size_t row = seed / width;
+        size_t left = seed % width;
+        if (!is_target(left, row)) {
+            continue; // Filled since it was pushed
+        }
+        size_t right = left;
+        while (left > 0 && is_target(left - 1, row)) {
+            left--;
+        }
+        while (right + 1 < width && is_target(right + 1, row)) {
+            right++;
+        }
+        m_canvas.fill_rect(left, row, right - left + 1, 1, rgb[0], rgb[1], rgb[2]);
+        for (const size_t next : {row - 1, row + 1}) {
+            if (next >= height) {
+                continue; // Also row 0 - 1, wrapped around
+            }
+            for (size_t col = left; col <= right; col++) {
+                // One seed per run of the target colour; a full stack (pathological shapes) leaves the rest unfilled
+                if (is_target(col, next) && (col == left || !is_target(col - 1, next)) && n_seeds < capacity) {
+                    seeds[n_seeds++] = static_cast<uint16_t>(next * width + col);
+                }
+            }
+        }
+    }
+}
+
+} // namespace DrawCommands
@@ -0,0 +1,149 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      DrawCommands.hpp                                                                                         *
+ * @brief     Compact drawing commands (pixels, lines, rectangles, flood fill, blits, text) run on the canvas          *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#ifndef DRAWMATRIX_DRAWCOMMANDS
+#define DRAWMATRIX_DRAWCOMMANDS
+
+#include <Adafruit_GFX.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Compositor.hpp"
+
+/**
+ * @brief A batch is a sequence of commands, each an opcode byte and its arguments; coordinates are bytes (clipped to
+ * the canvas), colours 3 bytes of RGB:
+ * - `'p'` x y rgb: one pixel.
+ * - `'P'` x y n, then n x rgb: n pixels from (x, y) on, wrapping to the next rows.
+ * - `'L'` x0 y0 x1 y1 rgb: line.
+ * - `'R'` x y w h rgb: rectangle outline.
+ * - `'F'` x y w h rgb: filled rectangle.
+ * - `'C'` rgb: fill the canvas.
+ * - `'f'` x y rgb: flood fill of the area of (x, y)'s colour.
+ * - `'B'` x y w h, then w x h x rgb: block of pixels, row by row.
+ * - `'T'` x y rgb font size n, then n characters: text with its top-left corner at (x, y); font 0 is the classic 6x8
+ *   font, 1 TomThumb (4x6); size scales it.
+ *
+ * A click is 6 bytes instead of a frame, a "Fill All" 4. Commands run as their bytes arrive, whatever the chunking;
+ * rectangles and text go straight to Canvas::fill_rect row spans, pixel payloads are not buffered.
+ */
+namespace DrawCommands {
+
+// Content-Type of command batches
+constexpr const char *CONTENT_TYPE = "application/x-draw-commands";
+
+constexpr uint8_t OP_PIXEL = 'p';
+constexpr uint8_t OP_PIXELS = 'P';
+constexpr uint8_t OP_LINE = 'L';
+constexpr uint8_t OP_RECT = 'R';
+constexpr uint8_t OP_FILL_RECT = 'F';
+constexpr uint8_t OP_CLEAR = 'C';
+constexpr uint8_t OP_FLOOD_FILL = 'f';
+constexpr uint8_t OP_BLIT = 'B';
+constexpr uint8_t OP_TEXT = 'T';
+
+// Characters of a text command drawn; the rest are skipped (the display is 5 to 8 characters wide)
+constexpr size_t MAX_TEXT = 32;
+
+/**
+ * @brief Runs batches on a canvas, byte by byte.
+ */
+class Interpreter {
+  public:
+    /**
+     * @brief Construct an interpreter.
+     * @param canvas What the commands draw on; must outlive the interpreter.
+     */
+    explicit Interpreter(Compositor::Canvas &canvas);
+
+    /**
+     * @brief Expect a new batch; a command left incomplete by the previous one is dropped.
+     */
+    void begin();
+
+    /**
+     * @brief Run the next bytes of the batch.
+     * @return false once the batch is invalid (unknown opcode); the rest of it is ignored.
+     */
+    bool feed(const uint8_t *data, size_t len);
+
+    /**
+     * @brief Whether the batch so far ends on a command boundary (a complete batch).
+     */
+    bool complete() const { return !m_op && !m_error; }
+
+    /**
+     * @brief Why the batch is invalid, nullptr while fine.
+     */
+    const char *error() const { return m_error; }
+
+    /**
+     * @brief Commands run since boot, for /info.
+     */
+    uint32_t executed() const { return m_executed; }
+
+  private:
+    /**
+     * @brief Adafruit_GFX on the canvas in 24-bit colour: the 565 colour arguments are ignored for rgb, and fills
+     * become canvas row spans.
+     */
+    class Surface : public Adafruit_GFX {
+      public:
+        explicit Surface(Compositor::Canvas &canvas);
+
+        void drawPixel(int16_t x, int16_t y, uint16_t) override;
+        void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t) override;
+        void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t) override;
+        void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t) override;
+        void fillScreen(uint16_t) override;
+
+        uint8_t rgb[3] = {}; // Colour drawn
+
+      private:
+        Compositor::Canvas &m_canvas;
+    };
+
+    /**
+     * @brief Run the command whose arguments are in m_args; commands with a payload start streaming it.
+     */
+    void run();
+
+    /**
+     * @brief Take the next pixels of a 'P' or 'B' payload.
+     */
+    void payload_pixels(const uint8_t *rgb, size_t count);
+
+    /**
+     * @brief The command, payload included, is complete.
+     */
+    void finish();
+
+    void flood_fill(uint8_t x, uint8_t y);
+
+    Compositor::Canvas &m_canvas;
+    Surface m_surface;
+    uint8_t m_op = 0;          // Command being received, 0 between commands
+    uint8_t m_args[8];         // Its fixed arguments
+    uint8_t m_n_args = 0;      // Fixed arguments it takes
+    uint8_t m_have = 0;        // Fixed arguments received
+    size_t m_payload = 0;      // Payload bytes still to come ('P', 'B', 'T')
+    size_t m_next = 0;         // Payload pixels (or characters) received
+    uint8_t m_pixel[3];        // Payload pixel split between two chunks
+    uint8_t m_n_pixel = 0;
+    char m_text[MAX_TEXT + 1]; // Text of a 'T' command
+    const char *m_error = nullptr;
+    uint32_t m_executed = 0;
+};
+
+} // namespace DrawCommands
+
+#endif /* DRAWMATRIX_DRAWCOMMANDS */
@@ -13,6 +13,7 @@
 #include <memory>
 
 #include <ArduinoJson.h>
+#include <AsyncWebPool.h>
 #include <ESPAsyncWebServer.h>
 #include <ESP8266WiFi.h>
 #include <ESP8266mDNS.h>
@@ -24,7 +25,9 @@
 #include <AsyncTasker.hpp>
 
 #include "MusicPlayer.hpp"
+#include "Router.hpp"
 #include "ServerSys.hpp"
+#include "WifiManager.hpp"
 
 // #define STASSID "your-ssid"
 // #define STAPSK "your-password"
@@ -52,6 +55,7 @@ volatile unsigned long g_lastDisplayActivity = 0;
 
 void updateClientActivity() {
     g_lastClientActivity = millis();
+    WifiManager::mark_request();
 }
 
 void updateDisplayActivity() {
@@ -59,6 +63,225 @@ void updateDisplayActivity() {
     updateClientActivity(); // Display activity is also client activity
 }
 
+// ======================================================================================
+// API routes, sorted by path (checked at compile time); the dispatcher reports each route's activity once the request
+// is complete
+constexpr Router::Route ROUTES[] = {
+    {"/", HTTP_ANY, Router::Activity::CLIENT, [](AsyncWebServerRequest *request) { app->handle_root(request); }},
+    {"/alarm", HTTP_ANY, Router::Activity::CLIENT, [](AsyncWebServerRequest *request) { app->handle_alarm(request); }},
+    {"/animation_play", HTTP_ANY, Router::Activity::DISPLAY,
+     [](AsyncWebServerRequest *request) { app->handle_animation_play(request); }},
+    {"/animation_stop", HTTP_ANY, Router::Activity::DISPLAY,
+     [](AsyncWebServerRequest *request) { app->handle_animation_stop(request); }},
+    {"/animation_upload", HTTP_POST, Router::Activity::CLIENT, nullptr,
+     [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+         app->handle_animation_upload(request, data, len, index, total);
+     }},
+    {"/delete-alarm", HTTP_POST, Router::Activity::CLIENT, nullptr,
+     [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+         app->handle_delete_alarm(request, data, len, index, total);
+     }},
+    {"/draw", HTTP_ANY, Router::Activity::DISPLAY, [](AsyncWebServerRequest *request) { app->handle_draw(request); }},
+    {"/draw_commands", HTTP_POST, Router::Activity::DISPLAY, nullptr,
+     [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+         app->handle_draw_commands(request, data, len, index, total);
+     }},
+    {"/effect", HTTP_ANY, Router::Activity::DISPLAY,
+     [](AsyncWebServerRequest *request) { app->handle_effect(request); }},
+    {"/effect_benchmark", HTTP_ANY, Router::Activity::CLIENT,
+     [](AsyncWebServerRequest *request) { app->handle_effect_benchmark(request); }},
+    {"/effect_stop", HTTP_ANY, Router::Activity::DISPLAY,
+     [](AsyncWebServerRequest *request) { app->handle_effect_stop(request); }},
+    {"/gallery", HTTP_ANY, Router::Activity::CLIENT,
+     [](AsyncWebServerRequest *request) { app->handle_gallery(request); }},
+    {"/gallery_delete", HTTP_ANY, Router::Activity::CLIENT,
+     [](AsyncWebServerRequest *request) { app->handle_gallery_delete(request); }},
+    {"/gallery_recall", HTTP_ANY, Router::Activity::DISPLAY,
+     [](AsyncWebServerRequest *request) { app->handle_gallery_recall(request); }},
+    {"/gallery_save", HTTP_ANY, Router::Activity::CLIENT,
+     [](AsyncWebServerRequest *request) { app->handle_gallery_save(request); }},
+    {"/gallery_thumbnail", HTTP_ANY, Router::Activity::CLIENT,
+     [](AsyncWebServerRequest *request) { app->handle_gallery_thumbnail(request); }},
+    {"/gif", HTTP_ANY, Router::Activity::DISPLAY, [](AsyncWebServerRequest *request) { app->handle_gif(request); }},
+    {"/info", HTTP_ANY, Router::Activity::CLIENT,
+     [](AsyncWebServerRequest *request) {
+         StaticJsonDocument<768> doc;
+         doc["chip_id"] = ESP.getChipId();
+         doc["core_version"] = ESP.getCoreVersion();
+         doc["sdk_version"] = ESP.getSdkVersion();
+         doc["flash_chip_id"] = ESP.getFlashChipId();
+         doc["flash_chip_size"] = ESP.getFlashChipSize();
+         doc["sketch_size"] = ESP.getSketchSize();
+         doc["free_sketch_space"] = ESP.getFreeSketchSpace();
+         // doc["heap_size"] = ESP.getHeapSize(); // Uncomment if available
+         doc["free_heap"] = ESP.getFreeHeap();
+         doc["max_free_block_size"] = ESP.getMaxFreeBlockSize();
+         doc["heap_fragmentation"] = ESP.getHeapFragmentation();
+         doc["free_stack"] = ESP.getFreeContStack();
+         doc["cpu_freq_mhz"] = ESP.getCpuFreqMHz();
+         doc["boot_version"] = ESP.getBootVersion();
+         doc["boot_mode"] = ESP.getBootMode();
+         doc["reset_reason"] = ESP.getResetReason();
+         const auto &boot = WifiManager::boot_times();
+         doc["boot_first_pixel_ms"] = boot.first_pixel_ms;
+         doc["boot_wifi_connected_ms"] = boot.wifi_connected_ms;
+         doc["boot_first_request_ms"] = boot.first_request_ms;
+         doc["boot_fast_connect"] = boot.fast_connect;
+         const auto &mirror = app->mirror();
+         doc["mirror_viewers"] = mirror.viewers();
+         doc["mirror_frames"] = mirror.stats().frames;
+         doc["mirror_key_frames"] = mirror.stats().key_frames;
+         doc["mirror_sent"] = mirror.stats().sent;
+         doc["mirror_skipped"] = mirror.stats().skipped;
+         const auto &ws_objects = AsyncWebPool::objects().stats();
+         doc["ws_pool_object_hits"] = ws_objects.hits;
+         doc["ws_pool_object_misses"] = ws_objects.misses;
+         doc["ws_pool_object_peak"] = ws_objects.peak;
+         const auto &ws_payloads = AsyncWebPool::payloads().stats();
+         doc["ws_pool_payload_hits"] = ws_payloads.hits;
+         doc["ws_pool_payload_misses"] = ws_payloads.misses;
+         doc["ws_pool_payload_peak"] = ws_payloads.peak;
+         const auto &ws_nodes = AsyncWebPool::nodes().stats();
+         doc["ws_pool_node_hits"] = ws_nodes.hits;
+         doc["ws_pool_node_misses"] = ws_nodes.misses;
+         doc["ws_pool_node_peak"] = ws_nodes.peak;
+         const auto &udp = app->frame_input().stats();
+         doc["udp_packets"] = udp.packets;
+         doc["udp_frames"] = udp.frames;
+         doc["udp_rejected"] = udp.rejected;
+         const auto &ws_frames = app->frame_socket().stats();
+         doc["ws_frames"] = ws_frames.frames;
+         doc["ws_frames_rejected"] = ws_frames.rejected;
+         const auto &jitter = app->jitter_buffer();
+         doc["stream_depth"] = jitter.depth();
+         doc["stream_queued"] = jitter.stats().queued;
+         doc["stream_presented"] = jitter.stats().presented;
+         doc["stream_late"] = jitter.stats().late;
+         doc["stream_dropped"] = jitter.stats().dropped;
+         doc["indexed_mode"] = app->indexed_mode();
+         const auto &animation = app->animation();
+         doc["animation_playing"] = animation.playing() ? animation.current() : app->gif().current();
+         doc["animation_frames"] = animation.stats().frames;
+         doc["animation_late"] = animation.stats().late;
+         doc["gif_frames"] = app->gif().stats().frames;
+         doc["gif_late"] = app->gif().stats().late;
+         doc["gif_decode_us"] = app->gif().stats().decode_us;
+         const auto &effects = app->effects();
+         doc["effect"] = effects.running() ? Effects::name(effects.current()) : "";
+         doc["effect_frames"] = effects.stats().frames;
+         doc["effect_late"] = effects.stats().late;
+         doc["effect_render_us"] = effects.stats().render_us;
+         doc["effect_render_max_us"] = effects.stats().render_max_us;
+         const auto &ticker = app->ticker().stats();
+         doc["ticker_columns"] = ticker.columns;
+         doc["ticker_frames"] = ticker.frames;
+         doc["ticker_render_us"] = ticker.render_us;
+         doc["ticker_blit_us"] = ticker.blit_us;
+         doc["ticker_blit_max_us"] = ticker.blit_max_us;
+         const auto &transition = app->transition();
+         doc["transition"] = transition.running() ? Transition::name(transition.current()) : "";
+         doc["transition_count"] = transition.stats().transitions;
+         doc["transition_cancelled"] = transition.stats().cancelled;
+         doc["transition_frames"] = transition.stats().frames;
+         doc["transition_present_us"] = transition.stats().present_us;
+         doc["transition_present_max_us"] = transition.stats().present_max_us;
+         doc["draw_commands"] = app->draw_commands();
+         const auto &history = app->history();
+         doc["undo_budget"] = history.budget;
+         doc["undo_used"] = history.used;
+         doc["undo_depth"] = history.undo;
+         doc["redo_depth"] = history.redo;
+         doc["undo_too_large"] = history.too_large;
+         const auto &autosave = app->autosave();
+         doc["autosave_writes"] = autosave.writes;
+         doc["autosave_unchanged"] = autosave.unchanged;
+         doc["autosave_failed"] = autosave.failed;
+         doc["autosave_bytes"] = autosave.bytes;
+         doc["autosave_restore_us"] = autosave.restore_us;
+         const auto &gallery = app->gallery();
+         doc["gallery_frames"] = gallery.size();
+         doc["gallery_recalls"] = gallery.stats().recalls;
+         doc["gallery_recall_us"] = gallery.stats().recall_us;
+         doc["gallery_recall_max_us"] = gallery.stats().recall_max_us;
+
+         String json;
+         serializeJson(doc, json);
+         request->send(200, "application/json", json);
+     }},
+    {"/list-alarms", HTTP_ANY, Router::Activity::CLIENT,
+     [](AsyncWebServerRequest *request) { app->handle_list_alarms(request); }},
+    {"/modify-alarm", HTTP_POST, Router::Activity::CLIENT, nullptr,
+     [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+         app->handle_modify_alarm(request, data, len, index, total);
+     }},
+    {"/music", HTTP_ANY, Router::Activity::CLIENT, [](AsyncWebServerRequest *request) { app->handle_music(request); }},
+    {"/music_play", HTTP_ANY, Router::Activity::CLIENT,
+     [](AsyncWebServerRequest *request) {
+         if (request->hasParam("track")) {
+             String trackStr = request->getParam("track")->value();
+             Serial.printf("Playing music track: %s\n", trackStr.c_str());
+             // convert to int
+             int trackInt = trackStr.toInt();
+             MusicPlayer::play(static_cast<MusicPlayer::MusicTrack>(trackInt));
+             request->send(200, "text/plain", "Playing track: " + trackStr);
+         } else { // pause/play toggle
+             MusicPlayer::pause();
+             request->send(200, "text/plain", "Toggling play/pause");
+         }
+     }},
+    {"/music_stop", HTTP_ANY, Router::Activity::CLIENT,
+     [](AsyncWebServerRequest *request) {
+         Serial.println("Stopping music...");
+         MusicPlayer::stop();
+         request->send(200, "text/plain", "Music stopped");
+     }},
+    {"/redo", HTTP_ANY, Router::Activity::DISPLAY, [](AsyncWebServerRequest *request) { app->handle_redo(request); }},
+    {"/set_alarm", HTTP_POST, Router::Activity::CLIENT, nullptr,
+     [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+         app->handle_set_alarm(request, data, len, index, total);
+     }},
+    {"/set_display_brightness", HTTP_ANY, Router::Activity::DISPLAY,
+     [](AsyncWebServerRequest *request) { app->handle_set_display_brightness(request); }},
+    {"/set_display_color", HTTP_ANY, Router::Activity::DISPLAY,
+     [](AsyncWebServerRequest *request) { app->handle_set_display_color(request); }},
+    {"/set_display_gif", HTTP_POST, Router::Activity::DISPLAY, nullptr,
+     [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+         app->handle_set_display_gif(request, data, len, index, total);
+     }},
+    {"/set_display_image", HTTP_POST, Router::Activity::DISPLAY, nullptr,
+     [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+         app->handle_set_display_image(request, data, len, index, total);
+     }},
+    {"/set_display_matrix", HTTP_POST, Router::Activity::DISPLAY, nullptr,
+     [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+         app->handle_set_display_matrix(request, data, len, index, total);
+     }},
+    {"/set_palette_cycle", HTTP_ANY, Router::Activity::DISPLAY,
+     [](AsyncWebServerRequest *request) { app->handle_set_palette_cycle(request); }},
+    {"/snapshot", HTTP_ANY, Router::Activity::CLIENT,
+     [](AsyncWebServerRequest *request) { app->handle_snapshot(request); }},
+    {"/status_led_control", HTTP_ANY, Router::Activity::CLIENT,
+     [](AsyncWebServerRequest *request) { app->handle_status_led_control(request); }},
+    {"/ticker", HTTP_ANY, Router::Activity::DISPLAY,
+     [](AsyncWebServerRequest *request) { app->handle_ticker(request); }},
+    {"/ticker_stop", HTTP_ANY, Router::Activity::DISPLAY,
+     [](AsyncWebServerRequest *request) { app->handle_ticker_stop(request); }},
+    {"/transition", HTTP_ANY, Router::Activity::CLIENT,
+     [](AsyncWebServerRequest *request) { app->handle_transition(request); }},
+    {"/undo", HTTP_ANY, Router::Activity::DISPLAY, [](AsyncWebServerRequest *request) { app->handle_undo(request); }},
+    {"/wifi_off", HTTP_ANY, Router::Activity::CLIENT,
+     [](AsyncWebServerRequest *request) {
+         Serial.println("Turning WiFi off...");
+         WiFi.disconnect();
+         request->send(200, "text/plain", "WiFi turned off");
+     }},
+};
+static_assert(Router::is_sorted(ROUTES), "ROUTES must be sorted by path");
+
+Router::Dispatcher dispatcher(ROUTES, [](Router::Activity activity) {
+    activity == Router::Activity::DISPLAY ? updateDisplayActivity() : updateClientActivity();
+});
+
 constexpr uint8_t BUTTON_PLAY_PAUSE = D1; // GPIO pin for play/pause button
 constexpr uint8_t BUTTON_CTRL = D6;       // GPIO pin for control button
 
@@ -70,6 +293,15 @@ std::map<uint8_t, OneButton> buttons = {
 // ======================================================================================
 void setup(void) {
     Serial.begin(115200);
+
+    // Display first: the App mounts LittleFS and lights the matrix, nothing here waits for the network
+    app = std::make_unique<ServerSys::App>(ntpClient, []() {
+        Serial.println("Alarm callback triggered!");
+        MusicPlayer::play(MusicPlayer::MusicTrack::MUSIC_ALARM);
+        MusicPlayer::set_volume(MusicPlayer::MAX_VOLUME);  // Set volume to maximum
+    });
+    WifiManager::mark_first_pixel();
+
     MusicPlayer::init();
 
     // Configure buttons
@@ -100,144 +332,23 @@ void setup(void) {
         MusicPlayer::stop_volume_change();
     });
 
-    WiFi.mode(WIFI_STA);
-    WiFi.begin(ssid, password);
-    Serial.println("");
-
-    app = std::make_unique<ServerSys::App>(ntpClient, []() {
-        Serial.println("Alarm callback triggered!");
-        MusicPlayer::play(MusicPlayer::MusicTrack::MUSIC_ALARM);
-        MusicPlayer::set_volume(MusicPlayer::MAX_VOLUME);  // Set volume to maximum
-    });
-
-    // Wait for connection
-    while (WiFi.status() != WL_CONNECTED) {
-        delay(500);
-        Serial.print(".");
-    }
-    Serial.println("");
-    Serial.print("Connected to ");
-    Serial.println(ssid);
-    Serial.print("IP address: ");
-    Serial.println(WiFi.localIP());
-
-    if (MDNS.begin("esp8266")) {
-        Serial.println("MDNS responder started");
-    }
-
-    server.on("/", [](AsyncWebServerRequest *request){
-        updateClientActivity();
-        app->handle_root(request);
-    });
-    server.on("/draw", [](AsyncWebServerRequest *request){
-        updateDisplayActivity(); // Display-related - disable clock
-        app->handle_draw(request);
-    });
-    server.on("/alarm", [](AsyncWebServerRequest *request){
-        updateClientActivity();
-        app->handle_alarm(request);
-    });
-    server.on("/music", [](AsyncWebServerRequest *request){
-        updateClientActivity();
-        app->handle_music(request);
+    // Connect in the background; routes, NTP and the scheduler are all up before the association completes
+    WifiManager::begin(ssid, password, []() {
+        if (MDNS.isRunning() || MDNS.begin("esp8266")) {
+            Serial.println("MDNS responder started");
+        }
     });
 
-    server.on("/status_led_control", [](AsyncWebServerRequest *request){
-        updateClientActivity();
-        app->handle_status_led_control(request);
-    });
-    server.on("/set_display_brightness", [](AsyncWebServerRequest *request){
-        updateDisplayActivity(); // Display-related - disable clock
-        app->handle_set_display_brightness(request);
-    });
-    server.on("/set_display_color", [](AsyncWebServerRequest *request){
-        updateDisplayActivity(); // Display-related - disable clock
-        app->handle_set_display_color(request);
-    });
-    server.on("/gif", [](AsyncWebServerRequest *request){
-        updateDisplayActivity(); // Display-related - disable clock
-        app->handle_gif(request);
-    });
-    server.on("/set_display_matrix", HTTP_POST, [](AsyncWebServerRequest *request){
-        updateDisplayActivity(); // Display-related - disable clock
-    }, NULL, [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total){
-        app->handle_set_display_matrix(request, data, len, index, total);
-    });
-    server.on("/list-alarms", [](AsyncWebServerRequest *request){
-        updateClientActivity();
-        app->handle_list_alarms(request);
-    });
-    server.on("/delete-alarm", HTTP_POST, [](AsyncWebServerRequest *request){
-        updateClientActivity();
-    }, NULL, [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total){
-        app->handle_delete_alarm(request, data, len, index, total);
-    });
-    server.on("/modify-alarm", HTTP_POST, [](AsyncWebServerRequest *request){
-        updateClientActivity();
-    }, NULL, [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total){
-        app->handle_modify_alarm(request, data, len, index, total);
-    });
-    server.on("/set_alarm", HTTP_POST, [](AsyncWebServerRequest *request){
-        updateClientActivity();
-    }, NULL, [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total){
-        app->handle_set_alarm(request, data, len, index, total);
-    });
+    // The draw page fires many small requests; reuse connections instead of a TCP handshake each. Short idle
+    // timeout: lwIP only has a handful of PCBs
+    server.setKeepAlive(2, 16);
+    server.addHandler(&dispatcher);
+    server.addHandler(&app->mirror_handler());
+    server.addHandler(&app->frame_socket_handler());
     server.onNotFound([](AsyncWebServerRequest *request){
         updateClientActivity();
         app->handle_not_found(request);
     });
-    server.on("/info", [](AsyncWebServerRequest *request) {
-        updateClientActivity(); // Info requests don't affect display
-        StaticJsonDocument<512> doc;
-        doc["chip_id"] = ESP.getChipId();
-        doc["core_version"] = ESP.getCoreVersion();
-        doc["sdk_version"] = ESP.getSdkVersion();
-        doc["flash_chip_id"] = ESP.getFlashChipId();
-        doc["flash_chip_size"] = ESP.getFlashChipSize();
-        doc["sketch_size"] = ESP.getSketchSize();
-        doc["free_sketch_space"] = ESP.getFreeSketchSpace();
-        // doc["heap_size"] = ESP.getHeapSize(); // Uncomment if available
-        doc["free_heap"] = ESP.getFreeHeap();
-        doc["max_free_block_size"] = ESP.getMaxFreeBlockSize();
-        doc["heap_fragmentation"] = ESP.getHeapFragmentation();
-        doc["free_stack"] = ESP.getFreeContStack();
-        doc["cpu_freq_mhz"] = ESP.getCpuFreqMHz();
-        doc["boot_version"] = ESP.getBootVersion();
-        doc["boot_mode"] = ESP.getBootMode();
-        doc["reset_reason"] = ESP.getResetReason();
-
-        String json;
-        serializeJson(doc, json);
-        request->send(200, "application/json", json);
-    });
-    server.on("/wifi_off", [](AsyncWebServerRequest *request) {
-        updateClientActivity();
-        Serial.println("Turning WiFi off...");
-        WiFi.disconnect();
-        request->send(200, "text/plain", "WiFi turned off");
-    });
-    server.on("/music_play", [](AsyncWebServerRequest *request) {
-        updateClientActivity();
-        if (request->hasParam("track")) {
-            String trackStr = request->getParam("track")->value();
-            Serial.printf("Playing music track: %s\n", trackStr.c_str());
-            // convert to int
-            int trackInt = trackStr.toInt();
-            MusicPlayer::play(static_cast<MusicPlayer::MusicTrack>(trackInt));
-            request->send(200, "text/plain", "Playing track: " + trackStr);
-            return;
-        } else { // pause/play toggle
-            MusicPlayer::pause();
-            request->send(200, "text/plain", "Toggling play/pause");
-            return;
-        }
-    });
-    server.on("/music_stop", [](AsyncWebServerRequest *request) {
-        updateClientActivity();
-        Serial.println("Stopping music...");
-        MusicPlayer::stop();
-        request->send(200, "text/plain", "Music stopped");
-    });
 
 #if 0
     /////////////////////////////////////////////////////////
@@ -309,7 +420,8 @@ void setup(void) {
             
             // Check if we've had recent DISPLAY activity (not just any client activity)
             unsigned long now = millis();
-            bool hasDisplayActivity = (now - g_lastDisplayActivity) < (SERVER_CHECK_INTERVAL * 2);
+            bool hasDisplayActivity = (now - g_lastDisplayActivity) < (SERVER_CHECK_INTERVAL * 2) ||
+                                      app->streaming(SERVER_CHECK_INTERVAL * 2) || app->animating();
             
             if (hasDisplayActivity) {
                 n_fails = 0;
@@ -332,18 +444,15 @@ void setup(void) {
         WIFI_CHECK_INTERVAL,
         [](uint64_t, uint64_t &, bool &) {
             static size_t fail_sync_count = 0;
+            if (!WifiManager::connected()) {
+                // The SDK keeps re-associating on its own; querying NTP now would only block for its timeout
+                return;
+            }
             if (!ntpClient.update()) {
-                if ((WiFi.status() != WL_CONNECTED) ||
-                    (++fail_sync_count > ((NTP_SYNC_PERIOD_MS / WIFI_CHECK_INTERVAL) + 1))) {
-                    Serial.println("NTP sync failed. No WiFi? Wifi status: " + String(WiFi.status()) +
-                                   ". Re-connecting...");
+                if (++fail_sync_count > ((NTP_SYNC_PERIOD_MS / WIFI_CHECK_INTERVAL) + 1)) {
+                    Serial.println("NTP sync failed. Wifi status: " + String(WiFi.status()) + ". Re-connecting...");
                     fail_sync_count = 0;
-                    WiFi.disconnect();
-                    WiFi.begin(ssid, password); // Wait for connection
-                    while (WiFi.status() != WL_CONNECTED) {
-                        delay(500);
-                        Serial.print(".");
-                    }
+                    WifiManager::reconnect();
                 }
 
             } else {
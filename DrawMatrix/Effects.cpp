@@ -0,0 +1,401 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      Effects.cpp                                                                                              *
+ * @brief     Procedural effects rendered into the canvas with table lookups and fixed-point math                      *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#include "Effects.hpp"
+
+#include <Adafruit_NeoPixel.h>
+#include <Arduino.h>
+
+#include <array>
+#include <cstring>
+#include <new>
+
+namespace Effects {
+namespace {
+constexpr const char *NAMES[] = {"rainbow", "plasma", "fire", "noise", "gradient"};
+static_assert(sizeof(NAMES) / sizeof(NAMES[0]) == N_KINDS, "One name per effect");
+
+// Fire: how much heat every cell loses per frame, and the chance (out of 256) of a new spark per column
+constexpr uint8_t FIRE_COOLING = 55;
+constexpr uint8_t FIRE_SPARKING = 120;
+// Noise: lattice cells per pixel, 8.8 fixed point
+constexpr uint32_t NOISE_SCALE = 48;
+
+constexpr double HALF_TURN = 3.14159265358979323846;
+
+// --------------------------------------------------------------------------------------
+// Taylor series of sin(x) for x in [-pi, pi]; far more precise than the 8 bits kept
+constexpr double taylor_sin(double x) {
+    double term = x;
+    double sum = x;
+    for (int k = 1; k < 12; k++) {
+        term *= -x * x / ((2 * k) * (2 * k + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+// sin of a byte angle (256 per turn), mapped to 0-255
+constexpr std::array<uint8_t, 256> SINE = []() {
+    std::array<uint8_t, 256> table = {};
+    for (int i = 0; i < 256; i++) {
+        const double value = 128 + 127.5 * taylor_sin((i < 128 ? i : i - 256) * HALF_TURN / 128);
+        table[i] = static_cast<uint8_t>(value > 255 ? 255 : value);
+    }
+    return table;
+}();
+
+// Fully saturated, full value colour of a byte hue: six linear ramps, red at 0, 3 bytes per hue
+constexpr std::array<uint8_t, 256 * 3> HUE_WHEEL = []() {
+    std::array<uint8_t, 256 * 3> table = {};
+    for (int hue = 0; hue < 256; hue++) {
+        const int h = hue * 6;
+        const uint8_t up = h & 0xFF;
+        const uint8_t down = 255 - up;
+        const uint8_t ramps[6][3] = {{255, up, 0}, {down, 255, 0}, {0, 255, up},
+                                     {0, down, 255}, {up, 0, 255}, {255, 0, down}};
+        for (int c = 0; c < 3; c++) {
+            table[hue * 3 + c] = ramps[h >> 8][c];
+        }
+    }
+    return table;
+}();
+
+// --------------------------------------------------------------------------------------
+// HSV triple at full value, converted by hsv_to_rgb() once the frame is complete
+inline void put_hsv(uint8_t *&pixel, uint8_t hue, uint8_t saturation) {
+    pixel[0] = hue;
+    pixel[1] = saturation;
+    pixel[2] = 255;
+    pixel += 3;
+}
+
+// --------------------------------------------------------------------------------------
+// ColorHSV's arithmetic on the wheel colour: c * s / 255 + (255 - s), then times v / 255, with s + 1 and v + 1 as
+// 8-bit fixed-point factors; the gamma choice is made once per span, not per pixel
+template <bool GAMMA> void convert(const uint8_t *hsv, uint8_t *rgb, size_t count) {
+    for (; count--; hsv += 3, rgb += 3) {
+        const uint8_t *wheel = &HUE_WHEEL[hsv[0] * 3];
+        const uint16_t s1 = hsv[1] + 1;
+        const uint8_t s2 = 255 - hsv[1];
+        const uint16_t v1 = hsv[2] + 1;
+        const uint8_t r = ((((wheel[0] * s1) >> 8) + s2) * v1) >> 8;
+        const uint8_t g = ((((wheel[1] * s1) >> 8) + s2) * v1) >> 8;
+        const uint8_t b = ((((wheel[2] * s1) >> 8) + s2) * v1) >> 8;
+        rgb[0] = GAMMA ? Adafruit_NeoPixel::gamma8(r) : r;
+        rgb[1] = GAMMA ? Adafruit_NeoPixel::gamma8(g) : g;
+        rgb[2] = GAMMA ? Adafruit_NeoPixel::gamma8(b) : b;
+    }
+}
+
+// --------------------------------------------------------------------------------------
+// Black, red, yellow, white as heat rises (three ramps of 64 steps)
+inline void put_heat(uint8_t *&pixel, uint8_t heat) {
+    const uint8_t t192 = (heat * 191) >> 8;
+    const uint8_t ramp = (t192 & 0x3F) << 2;
+    pixel[0] = t192 & 0xC0 ? 255 : ramp;
+    pixel[1] = t192 & 0x80 ? 255 : t192 & 0x40 ? ramp : 0;
+    pixel[2] = t192 & 0x80 ? ramp : 0;
+    pixel += 3;
+}
+
+// --------------------------------------------------------------------------------------
+// Pseudo-random byte of a lattice point
+inline uint8_t lattice(uint32_t ix, uint32_t iy) {
+    uint32_t h = ix * 0x9E3779B1u ^ iy * 0x85EBCA77u;
+    h ^= h >> 15;
+    h *= 0x2C1B3C6Du;
+    h ^= h >> 12;
+    return h >> 24;
+}
+
+// --------------------------------------------------------------------------------------
+// 3u^2 - 2u^3 with u and the result in 0-255
+inline uint8_t smooth(uint32_t u) { return (u * u * (768 - 2 * u)) >> 16; }
+
+// --------------------------------------------------------------------------------------
+inline uint8_t lerp8(uint8_t a, uint8_t b, uint8_t s) { return a + (((b - a) * s) >> 8); }
+
+// --------------------------------------------------------------------------------------
+// Value noise at (fx, fy), 8.8 fixed point: lattice values blended with a smoothstep
+inline uint8_t value_noise(uint32_t fx, uint32_t fy) {
+    const uint32_t ix = fx >> 8;
+    const uint32_t iy = fy >> 8;
+    const uint8_t sx = smooth(fx & 0xFF);
+    const uint8_t sy = smooth(fy & 0xFF);
+    const uint8_t top = lerp8(lattice(ix, iy), lattice(ix + 1, iy), sx);
+    const uint8_t bottom = lerp8(lattice(ix, iy + 1), lattice(ix + 1, iy + 1), sx);
+    return lerp8(top, bottom, sy);
+}
+} // namespace
+
+// --------------------------------------------------------------------------------------
+const char *name(Kind kind) { return NAMES[static_cast<size_t>(kind)]; }
+
+// --------------------------------------------------------------------------------------
+bool find(const char *name, Kind &kind) {
+    for (size_t k = 0; k < N_KINDS; k++) {
+        if (!strcmp(NAMES[k], name)) {
+            kind = static_cast<Kind>(k);
+            return true;
+        }
+    }
+    return false;
+}
+
+// --------------------------------------------------------------------------------------
+void hsv_to_rgb(const uint8_t *hsv, uint8_t *rgb, size_t count, bool gamma) {
+    if (gamma) {
+        convert<true>(hsv, rgb, count);
+    } else {
+        convert<false>(hsv, rgb, count);
+    }
+}
+
+// --------------------------------------------------------------------------------------
+uint32_t benchmark_hsv(size_t count, size_t frames, bool batch) {
+    std::unique_ptr<uint8_t[]> hsv(new (std::nothrow) uint8_t[count * 3]);
+    std::unique_ptr<uint8_t[]> rgb(new (std::nothrow) uint8_t[count * 3]);
+    if (!hsv || !rgb) {
+        return 0;
+    }
+    // Every hue, and saturations and values away from the trivial 0 and 255
+    for (size_t i = 0; i < count; i++) {
+        hsv[i * 3] = i;
+        hsv[i * 3 + 1] = 128 + (i & 0x7F);
+        hsv[i * 3 + 2] = 255 - (i & 0x3F);
+    }
+    const uint32_t start = micros();
+    for (size_t k = 0; k < frames; k++) {
+        if (batch) {
+            hsv_to_rgb(hsv.get(), rgb.get(), count, true);
+            continue;
+        }
+        for (size_t i = 0; i < count; i++) {
+            const uint8_t *in = hsv.get() + i * 3;
+            const uint32_t color = Adafruit_NeoPixel::gamma32(Adafruit_NeoPixel::ColorHSV(in[0] << 8, in[1], in[2]));
+            rgb[i * 3] = color >> 16;
+            rgb[i * 3 + 1] = color >> 8;
+            rgb[i * 3 + 2] = color;
+        }
+    }
+    const uint32_t us = (micros() - start) / frames;
+    return us ? us : 1;
+}
+
+// --------------------------------------------------------------------------------------
+Engine::Engine(Compositor::Canvas &canvas) : m_canvas(canvas), m_width(canvas.width()), m_height(canvas.height()) {}
+
+// --------------------------------------------------------------------------------------
+const char *Engine::start(Kind kind, uint8_t fps, uint32_t now_ms, uint8_t saturation, bool gamma) {
+    if (!fps || fps > MAX_FPS) {
+        return "Invalid frame rate";
+    }
+    if (kind == Kind::FIRE) {
+        // Cold start: flames grow from the sparks
+        m_heat.reset(new (std::nothrow) uint8_t[static_cast<size_t>(m_width) * m_height]());
+        if (!m_heat) {
+            m_running = false;
+            return "Not enough memory for the fire effect";
+        }
+    } else {
+        m_heat.reset();
+    }
+    m_kind = kind;
+    m_saturation = saturation;
+    m_gamma = gamma;
+    m_period_ms = 1000 / fps;
+    m_start_ms = m_due_ms = now_ms;
+    m_stats.render_max_us = 0;
+    m_running = true;
+    return nullptr;
+}
+
+// --------------------------------------------------------------------------------------
+void Engine::stop() {
+    m_running = false;
+    m_heat.reset();
+}
+
+// --------------------------------------------------------------------------------------
+bool Engine::run(uint32_t now_ms, uint32_t &wait_ms) {
+    wait_ms = IDLE_POLL_MS;
+    if (!m_running) {
+        return false;
+    }
+    const int32_t early = static_cast<int32_t>(m_due_ms - now_ms);
+    if (early > 0) {
+        wait_ms = static_cast<uint32_t>(early);
+        return false;
+    }
+    if (static_cast<uint32_t>(-early) > LATE_TOLERANCE_MS) {
+        m_stats.late++;
+    }
+
+    const uint32_t start = micros();
+    render(m_kind, m_canvas.pixels(), now_ms - m_start_ms);
+    m_stats.render_us = micros() - start;
+    m_stats.render_max_us = m_stats.render_us > m_stats.render_max_us ? m_stats.render_us : m_stats.render_max_us;
+    m_stats.frames++;
+    m_canvas.invalidate();
+
+    // Same timeline rule as Animation::Player: after a stall longer than a frame, restart from now instead of rushing
+    m_due_ms += m_period_ms;
+    if (static_cast<int32_t>(m_due_ms - now_ms) <= 0) {
+        m_due_ms = now_ms + m_period_ms;
+    }
+    const int32_t left = static_cast<int32_t>(m_due_ms - millis());
+    wait_ms = left > 0 ? static_cast<uint32_t>(left) : 0;
+    return true;
+}
+
+// --------------------------------------------------------------------------------------
+uint32_t Engine::benchmark(Kind kind, uint8_t *pixels, size_t frames) {
+    const bool own_heat = kind == Kind::FIRE && !m_heat;
+    if (own_heat) {
+        m_heat.reset(new (std::nothrow) uint8_t[static_cast<size_t>(m_width) * m_height]());
+        if (!m_heat) {
+            return 0;
+        }
+    }
+    const uint32_t start = micros();
+    for (size_t k = 0; k < frames; k++) {
+        render(kind, pixels, k * 1000 / DEFAULT_FPS);
+    }
+    const uint32_t us = (micros() - start) / frames;
+    if (own_heat) {
+        m_heat.reset();
+    }
+    return us ? us : 1;
+}
+
+// --------------------------------------------------------------------------------------
+void Engine::render(Kind kind, uint8_t *pixels, uint32_t t_ms) {
+    switch (kind) {
+    case Kind::RAINBOW:
+        rainbow(pixels, t_ms);
+        break;
+    case Kind::PLASMA:
+        plasma(pixels, t_ms);
+        break;
+    case Kind::FIRE:
+        fire(pixels);
+        return;
+    case Kind::NOISE:
+        noise(pixels, t_ms);
+        break;
+    case Kind::GRADIENT:
+        gradient(pixels, t_ms);
+        break;
+    }
+    hsv_to_rgb(pixels, pixels, static_cast<size_t>(m_width) * m_height, m_gamma);
+}
+
+// --------------------------------------------------------------------------------------
+void Engine::rainbow(uint8_t *pixels, uint32_t t_ms) const {
+    // One turn of the wheel across the width, slightly tilted, a turn every 2 s
+    const uint8_t step = 256 / m_width;
+    const uint8_t phase = t_ms >> 3;
+    for (uint16_t y = 0; y < m_height; y++) {
+        uint8_t hue = phase + y * 2;
+        for (uint16_t x = 0; x < m_width; x++, hue += step) {
+            put_hsv(pixels, hue, m_saturation);
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------
+void Engine::plasma(uint8_t *pixels, uint32_t t_ms) const {
+    // Four waves at different speeds and directions; their mean picks the hue, which drifts on its own
+    const uint8_t t1 = t_ms >> 3;
+    const uint8_t t2 = t_ms >> 4;
+    const uint8_t t3 = (t_ms * 11) >> 8;
+    const uint8_t t4 = t_ms >> 5;
+    const uint8_t drift = t_ms >> 6;
+    for (uint16_t y = 0; y < m_height; y++) {
+        const uint8_t row = SINE[static_cast<uint8_t>(y * 16 - t2)];
+        for (uint16_t x = 0; x < m_width; x++) {
+            const uint16_t sum = SINE[static_cast<uint8_t>(x * 16 + t1)] + row +
+                                 SINE[static_cast<uint8_t>((x + y) * 8 + t3)] +
+                                 SINE[static_cast<uint8_t>(SINE[static_cast<uint8_t>(x * 8 + t4)] + y * 16)];
+            put_hsv(pixels, (sum >> 2) + drift, m_saturation);
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------
+void Engine::fire(uint8_t *pixels) {
+    // Fire2012 on every column, the base being the bottom row
+    uint8_t *heat = m_heat.get();
+    const uint16_t w = m_width;
+    const uint8_t cooling_range = FIRE_COOLING * 10 / m_height + 2;
+    for (size_t i = 0; i < static_cast<size_t>(w) * m_height; i++) {
+        const uint8_t cool = (random8() * cooling_range) >> 8;
+        heat[i] = heat[i] > cool ? heat[i] - cool : 0;
+    }
+    // Heat drifts up and diffuses: each cell averages the two below it, the nearer one counting once
+    for (uint16_t y = 0; y + 2 < m_height; y++) {
+        uint8_t *cell = heat + y * w;
+        for (uint16_t x = 0; x < w; x++) {
+            cell[x] = ((cell[x + w] + 2 * cell[x + 2 * w]) * 171) >> 9;
+        }
+    }
+    for (uint16_t x = 0; x < w; x++) {
+        if (random8() < FIRE_SPARKING) {
+            uint8_t &cell = heat[(m_height - 1 - random8() % 3) * w + x];
+            const uint16_t hotter = cell + 160 + (random8() % 96);
+            cell = hotter > 255 ? 255 : hotter;
+        }
+    }
+    for (size_t i = 0; i < static_cast<size_t>(w) * m_height; i++) {
+        put_heat(pixels, heat[i]);
+    }
+}
+
+// --------------------------------------------------------------------------------------
+void Engine::noise(uint8_t *pixels, uint32_t t_ms) const {
+    // A coarse octave drifting right and down, a finer one drifting left, weighted 3:1
+    const uint32_t dx = t_ms >> 2;
+    const uint32_t dy = t_ms >> 3;
+    const uint8_t drift = t_ms >> 6;
+    for (uint16_t y = 0; y < m_height; y++) {
+        const uint32_t fy = y * NOISE_SCALE + dy;
+        for (uint16_t x = 0; x < m_width; x++) {
+            const uint32_t fx = x * NOISE_SCALE;
+            const uint16_t n = value_noise(fx + dx, fy) * 3 + value_noise(2 * fx - dx, 2 * fy);
+            put_hsv(pixels, (n >> 2) + drift, m_saturation);
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------
+void Engine::gradient(uint8_t *pixels, uint32_t t_ms) const {
+    // A quarter of the wheel, there and back (triangle wave) along the diagonal; the band itself turns slowly
+    const uint8_t shift = t_ms >> 4;
+    const uint8_t base = t_ms >> 7;
+    for (uint16_t y = 0; y < m_height; y++) {
+        uint8_t pos = y * 8 - shift;
+        for (uint16_t x = 0; x < m_width; x++, pos += 8) {
+            const uint8_t tri = pos & 0x80 ? 255 - pos : pos;
+            put_hsv(pixels, base + (tri >> 1), m_saturation);
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------
+uint8_t Engine::random8() {
+    m_seed ^= m_seed << 13;
+    m_seed ^= m_seed >> 17;
+    m_seed ^= m_seed << 5;
+    return m_seed >> 24;
+}
+
+} // namespace Effects
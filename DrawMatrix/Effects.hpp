@@ -0,0 +1,168 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      Effects.hpp                                                                                              *
+ * @brief     Procedural effects rendered into the canvas with table lookups and fixed-point math                      *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#ifndef DRAWMATRIX_EFFECTS
+#define DRAWMATRIX_EFFECTS
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "Compositor.hpp"
+
+/**
+ * @brief Each effect computes a whole frame in one pass over the canvas pixels: no floating point, no per-pixel
+ * division. Angles and hues are bytes (256 per turn); sines come from a 256-entry table computed by the compiler.
+ * Hue-based effects write HSV triples in place of the pixels and convert the frame in one hsv_to_rgb() pass. Frames are
+ * functions of the time since the effect started, except fire, which keeps a heat map of one byte per pixel while it
+ * runs and writes RGB directly.
+ */
+namespace Effects {
+
+enum class Kind : uint8_t {
+    RAINBOW,  ///< Hue sweeping across the display
+    PLASMA,   ///< Sum of travelling sine waves
+    FIRE,     ///< Heat rising from random sparks on the bottom row
+    NOISE,    ///< Two octaves of drifting value noise
+    GRADIENT, ///< Band of neighbouring hues scrolling diagonally
+};
+
+// Number of effects
+constexpr size_t N_KINDS = 5;
+// Frame rate used when none is requested
+constexpr uint8_t DEFAULT_FPS = 40;
+// Highest frame rate accepted
+constexpr uint8_t MAX_FPS = 100;
+// Rendered later than this after its time, a frame counts as late
+constexpr uint32_t LATE_TOLERANCE_MS = 5;
+// How often the engine looks for work while stopped
+constexpr uint32_t IDLE_POLL_MS = 100;
+
+/**
+ * @brief Name of an effect, as used by /effect.
+ */
+const char *name(Kind kind);
+
+/**
+ * @brief Effect with the given name.
+ * @return false if there is none.
+ */
+bool find(const char *name, Kind &kind);
+
+/**
+ * @brief Convert a span of HSV triples to RGB in one pass: hue through a 256-entry wheel (the same hexcone as
+ * Adafruit_NeoPixel::ColorHSV), saturation and value with 8-bit fixed-point multiplies, no branches per pixel. Within
+ * 1 of ColorHSV on every channel, 3 after gamma (checked by tools/host/bench.sh).
+ * @param hsv Hue (256 per turn), saturation, value; 3 bytes per pixel.
+ * @param rgb Output, 3 bytes per pixel; may be `hsv` (converted in place).
+ * @param gamma Apply Adafruit_NeoPixel::gamma8() to every channel, as ColorHSV followed by gamma32 would.
+ */
+void hsv_to_rgb(const uint8_t *hsv, uint8_t *rgb, size_t count, bool gamma);
+
+/**
+ * @brief Time hsv_to_rgb() with gamma against the per-pixel ColorHSV and gamma32 calls, over the same frames.
+ * @param count Pixels per frame.
+ * @param batch true for hsv_to_rgb(), false for the per-pixel calls.
+ * @return Average microseconds per frame, 0 when out of memory.
+ */
+uint32_t benchmark_hsv(size_t count, size_t frames, bool batch);
+
+/**
+ * @brief Counters since boot, for /info.
+ */
+struct Stats {
+    uint32_t frames = 0;        ///< Frames rendered
+    uint32_t late = 0;          ///< Frames rendered after their time
+    uint32_t render_us = 0;     ///< Time the last frame took to compute
+    uint32_t render_max_us = 0; ///< Slowest frame of the current effect
+};
+
+/**
+ * @brief Renders one effect onto the canvas at a fixed frame rate.
+ */
+class Engine {
+  public:
+    /**
+     * @brief Construct a stopped engine.
+     * @param canvas Where frames are rendered; must outlive the engine.
+     */
+    explicit Engine(Compositor::Canvas &canvas);
+
+    /**
+     * @brief Start an effect; replaces the current one.
+     * @param fps Frame rate, 1 to MAX_FPS.
+     * @param now_ms Current millis(); the first frame is due now.
+     * @param saturation Saturation of the hue-based effects; lower is paler.
+     * @param gamma Gamma-correct the hue-based effects.
+     * @return nullptr on success, otherwise why it cannot run.
+     */
+    const char *start(Kind kind, uint8_t fps, uint32_t now_ms, uint8_t saturation = 255, bool gamma = false);
+
+    /**
+     * @brief Stop rendering; the last frame stays on the canvas.
+     */
+    void stop();
+
+    bool running() const { return m_running; }
+    Kind current() const { return m_kind; }
+
+    /**
+     * @brief Render the frame due (if any) into the canvas; call from the scheduler.
+     * @param now_ms Current millis().
+     * @param wait_ms Set to the milliseconds until the next frame is due.
+     * @return Whether a frame was rendered (the canvas needs showing).
+     */
+    bool run(uint32_t now_ms, uint32_t &wait_ms);
+
+    /**
+     * @brief Time an effect on the device: renders `frames` frames, DEFAULT_FPS apart in effect time, into `pixels`.
+     * @param pixels Scratch buffer the size of the canvas; the canvas itself is not touched.
+     * @return Average microseconds per frame, 0 when out of memory.
+     */
+    uint32_t benchmark(Kind kind, uint8_t *pixels, size_t frames);
+
+    const Stats &stats() const { return m_stats; }
+
+  private:
+    /**
+     * @brief Compute the frame at `t_ms` into `pixels` (3 bytes each, row-major).
+     */
+    void render(Kind kind, uint8_t *pixels, uint32_t t_ms);
+
+    void rainbow(uint8_t *pixels, uint32_t t_ms) const;
+    void plasma(uint8_t *pixels, uint32_t t_ms) const;
+    void fire(uint8_t *pixels);
+    void noise(uint8_t *pixels, uint32_t t_ms) const;
+    void gradient(uint8_t *pixels, uint32_t t_ms) const;
+
+    /**
+     * @brief Next pseudo-random byte (xorshift32).
+     */
+    uint8_t random8();
+
+    Compositor::Canvas &m_canvas;
+    uint16_t m_width;
+    uint16_t m_height;
+    std::unique_ptr<uint8_t[]> m_heat; // Fire only: one byte per pixel
+    uint32_t m_seed = 0x2545F491;
+    Kind m_kind = Kind::RAINBOW;
+    bool m_running = false;
+    uint8_t m_saturation = 255;
+    bool m_gamma = false;
+    uint32_t m_period_ms = 0;
+    uint32_t m_start_ms = 0; // Time 0 of the effect
+    uint32_t m_due_ms = 0;   // When the next frame is due
+    Stats m_stats;
+};
+
+} // namespace Effects
+
+#endif /* DRAWMATRIX_EFFECTS */
@@ -0,0 +1,99 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      FrameCodec.cpp                                                                                           *
+ * @brief     Compact run-length coding of RGB frames for checkpoints and storage                                      *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#include "FrameCodec.hpp"
+
+#include <cstring>
+
+namespace FrameCodec {
+namespace {
+// --------------------------------------------------------------------------------------
+inline bool same_pixel(const uint8_t *a, const uint8_t *b) { return a[0] == b[0] && a[1] == b[1] && a[2] == b[2]; }
+} // namespace
+
+// --------------------------------------------------------------------------------------
+size_t rle_encode(const uint8_t *pixels, size_t n_pixels, uint8_t *out, size_t capacity) {
+    size_t o = 0;
+    size_t i = 0;
+    while (i < n_pixels) {
+        const uint8_t *px = pixels + i * BYTES_PER_PIXEL;
+
+        size_t run = 1;
+        while (i + run < n_pixels && run < MAX_PACKET_PIXELS && same_pixel(px, px + run * BYTES_PER_PIXEL)) {
+            run++;
+        }
+        if (run >= 2) {
+            if (out) {
+                if (o + 1 + BYTES_PER_PIXEL > capacity) {
+                    return 0;
+                }
+                out[o] = static_cast<uint8_t>(0x80 | (run - 1));
+                memcpy(out + o + 1, px, BYTES_PER_PIXEL);
+            }
+            o += 1 + BYTES_PER_PIXEL;
+            i += run;
+            continue;
+        }
+
+        // Literal: extend until the next pair of equal pixels (which starts a run)
+        size_t lit = 1;
+        while (i + lit < n_pixels && lit < MAX_PACKET_PIXELS) {
+            const uint8_t *next = px + lit * BYTES_PER_PIXEL;
+            if (i + lit + 1 < n_pixels && same_pixel(next, next + BYTES_PER_PIXEL)) {
+                break;
+            }
+            lit++;
+        }
+        if (out) {
+            if (o + 1 + lit * BYTES_PER_PIXEL > capacity) {
+                return 0;
+            }
+            out[o] = static_cast<uint8_t>(lit - 1);
+            memcpy(out + o + 1, px, lit * BYTES_PER_PIXEL);
+        }
+        o += 1 + lit * BYTES_PER_PIXEL;
+        i += lit;
+    }
+    return o;
+}
+
+// --------------------------------------------------------------------------------------
+size_t rle_decode(const uint8_t *in, size_t len, uint8_t *pixels, size_t n_pixels) {
+    size_t i = 0;
+    size_t p = 0;
+    while (i < len && p < n_pixels) {
+        const uint8_t c = in[i++];
+        size_t count = (c & 0x7F) + 1;
+        if (count > n_pixels - p) {
+            count = n_pixels - p;
+        }
+        if (c & 0x80) {
+            if (i + BYTES_PER_PIXEL > len) {
+                break;
+            }
+            for (size_t k = 0; k < count; k++, p++) {
+                memcpy(pixels + p * BYTES_PER_PIXEL, in + i, BYTES_PER_PIXEL);
+            }
+            i += BYTES_PER_PIXEL;
+        } else {
+            const size_t bytes = ((c & 0x7F) + 1) * BYTES_PER_PIXEL;
+            if (i + bytes > len) {
+                break;
+            }
+            memcpy(pixels + p * BYTES_PER_PIXEL, in + i, count * BYTES_PER_PIXEL);
+            p += count;
+            i += bytes;
+        }
+    }
+    return p;
+}
+
+} // namespace FrameCodec
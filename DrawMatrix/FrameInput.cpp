@@ -0,0 +1,321 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      FrameInput.cpp                                                                                           *
+ * @brief     Real-time frame input over UDP: DDP and E1.31 (sACN) written straight into the display                   *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#include "FrameInput.hpp"
+
+#include <Arduino.h>
+#include <lwip/pbuf.h>
+#include <lwip/udp.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace FrameInput {
+namespace {
+constexpr size_t BYTES_PER_PIXEL = 3;
+
+// DDP header: flags, sequence, data type, destination, offset (uint32 BE), length (uint16 BE), [timecode]
+constexpr size_t DDP_HEADER_SIZE = 10;
+constexpr size_t DDP_TIMECODE_SIZE = 4;
+constexpr uint8_t DDP_VERSION_MASK = 0xC0;
+constexpr uint8_t DDP_VERSION_1 = 0x40;
+constexpr uint8_t DDP_FLAG_TIMECODE = 0x10;
+constexpr uint8_t DDP_FLAG_QUERY = 0x02;
+constexpr uint8_t DDP_FLAG_PUSH = 0x01;
+constexpr uint8_t DDP_ID_DISPLAY = 1;
+constexpr uint8_t DDP_ID_ALL = 255;
+
+// E1.31 offsets (root, framing and DMP layers)
+constexpr size_t E131_ACN_ID = 4;
+constexpr size_t E131_ROOT_VECTOR = 18;
+constexpr size_t E131_FRAMING_VECTOR = 40;
+constexpr size_t E131_SYNC_ADDRESS = 109; // Data packets
+constexpr size_t E131_OPTIONS = 112;
+constexpr size_t E131_UNIVERSE = 113;
+constexpr size_t E131_DMP_VECTOR = 117;
+constexpr size_t E131_VALUE_COUNT = 123;
+constexpr size_t E131_START_CODE = 125;
+constexpr size_t E131_DATA = 126;
+constexpr size_t E131_SYNC_UNIVERSE = 45; // Synchronization packets
+constexpr size_t E131_SYNC_SIZE = 49;
+constexpr uint8_t E131_ACN_PACKET_ID[12] = {'A', 'S', 'C', '-', 'E', '1', '.', '1', '7', 0, 0, 0};
+constexpr uint32_t E131_VECTOR_ROOT_DATA = 0x04;
+constexpr uint32_t E131_VECTOR_ROOT_EXTENDED = 0x08;
+constexpr uint32_t E131_VECTOR_DATA_PACKET = 0x02;
+constexpr uint32_t E131_VECTOR_SYNCHRONIZATION = 0x01;
+constexpr uint8_t E131_VECTOR_DMP_SET_PROPERTY = 0x02;
+constexpr uint8_t E131_OPTION_PREVIEW = 0x80;
+constexpr uint8_t E131_OPTION_TERMINATED = 0x40;
+constexpr size_t E131_MAX_CHANNELS = 512;
+
+uint16_t be16(const uint8_t *p) { return (p[0] << 8) | p[1]; }
+
+uint32_t be32(const uint8_t *p) {
+    return (static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16) | (p[2] << 8) | p[3];
+}
+} // namespace
+
+struct Receiver::Lwip {
+    static void on_ddp(void *arg, udp_pcb *, pbuf *p, const ip_addr_t *, u16_t) {
+        // The ESP8266 receives each datagram in a single pbuf; a chained one would need copying, drop it instead
+        if (p->next) {
+            static_cast<Receiver *>(arg)->m_stats.rejected++;
+        } else {
+            static_cast<Receiver *>(arg)->on_ddp(static_cast<const uint8_t *>(p->payload), p->len);
+        }
+        pbuf_free(p);
+    }
+
+    static void on_e131(void *arg, udp_pcb *, pbuf *p, const ip_addr_t *, u16_t) {
+        if (p->next) {
+            static_cast<Receiver *>(arg)->m_stats.rejected++;
+        } else {
+            static_cast<Receiver *>(arg)->on_e131(static_cast<const uint8_t *>(p->payload), p->len);
+        }
+        pbuf_free(p);
+    }
+};
+
+// --------------------------------------------------------------------------------------
+Receiver::Receiver(Sink &sink, size_t n_pixels) : m_sink(sink), m_n_pixels(n_pixels) {}
+
+// --------------------------------------------------------------------------------------
+Receiver::~Receiver() {
+    if (m_ddp) {
+        udp_remove(m_ddp);
+    }
+    if (m_e131) {
+        udp_remove(m_e131);
+    }
+}
+
+// --------------------------------------------------------------------------------------
+bool Receiver::begin() {
+    auto listen = [this](uint16_t port, udp_recv_fn on_packet) -> udp_pcb * {
+        udp_pcb *pcb = udp_new();
+        if (!pcb) {
+            return nullptr;
+        }
+        if (udp_bind(pcb, IP_ADDR_ANY, port) != ERR_OK) {
+            udp_remove(pcb);
+            return nullptr;
+        }
+        udp_recv(pcb, on_packet, this);
+        return pcb;
+    };
+    if (!m_ddp) {
+        m_ddp = listen(DDP_PORT, &Lwip::on_ddp);
+    }
+    if (!m_e131) {
+        m_e131 = listen(E131_PORT, &Lwip::on_e131);
+    }
+    return m_ddp && m_e131;
+}
+
+// --------------------------------------------------------------------------------------
+void Receiver::on_ddp(const uint8_t *packet, size_t len) {
+    if (len < DDP_HEADER_SIZE || (packet[0] & DDP_VERSION_MASK) != DDP_VERSION_1 || (packet[0] & DDP_FLAG_QUERY) ||
+        (packet[3] != DDP_ID_DISPLAY && packet[3] != DDP_ID_ALL)) {
+        m_stats.rejected++;
+        return;
+    }
+    const size_t header = DDP_HEADER_SIZE + ((packet[0] & DDP_FLAG_TIMECODE) ? DDP_TIMECODE_SIZE : 0);
+    const uint32_t offset = be32(packet + 4);
+    const size_t data_len = be16(packet + 8);
+    if (len < header + data_len || offset % BYTES_PER_PIXEL) {
+        m_stats.rejected++;
+        return;
+    }
+    m_stats.packets++;
+
+    const bool timed = packet[0] & DDP_FLAG_TIMECODE;
+    const uint32_t timecode = timed ? be32(packet + DDP_HEADER_SIZE) : 0;
+    auto put = [&](size_t first, const uint8_t *rgb, size_t count) {
+        timed ? write_timed(timecode, first, rgb, count) : write(first, rgb, count);
+    };
+    if (data_len && packet[2] == DDP_TYPE_HEATSHRINK) {
+        // Each packet is a stream of its own: a lost packet cannot corrupt the next ones
+        m_inflate.begin(offset / BYTES_PER_PIXEL);
+        m_inflate.feed(packet + header, data_len, put);
+    } else if (data_len) {
+        put(offset / BYTES_PER_PIXEL, packet + header, data_len / BYTES_PER_PIXEL);
+    }
+    if (packet[0] & DDP_FLAG_PUSH) {
+        timed ? present_at(timecode) : present();
+    }
+}
+
+// --------------------------------------------------------------------------------------
+void Receiver::on_e131(const uint8_t *packet, size_t len) {
+    if (len < E131_SYNC_SIZE || memcmp(packet + E131_ACN_ID, E131_ACN_PACKET_ID, sizeof(E131_ACN_PACKET_ID))) {
+        m_stats.rejected++;
+        return;
+    }
+
+    const uint32_t root_vector = be32(packet + E131_ROOT_VECTOR);
+    const uint32_t framing_vector = be32(packet + E131_FRAMING_VECTOR);
+    if (root_vector == E131_VECTOR_ROOT_EXTENDED && framing_vector == E131_VECTOR_SYNCHRONIZATION) {
+        if (m_sync_address && be16(packet + E131_SYNC_UNIVERSE) == m_sync_address) {
+            m_sync_address = 0;
+            present();
+        }
+        return;
+    }
+
+    if (root_vector != E131_VECTOR_ROOT_DATA || framing_vector != E131_VECTOR_DATA_PACKET || len < E131_DATA ||
+        packet[E131_DMP_VECTOR] != E131_VECTOR_DMP_SET_PROPERTY || packet[E131_START_CODE] != 0 ||
+        (packet[E131_OPTIONS] & (E131_OPTION_PREVIEW | E131_OPTION_TERMINATED))) {
+        m_stats.rejected++;
+        return;
+    }
+    const size_t n_universes = (m_n_pixels + E131_PIXELS_PER_UNIVERSE - 1) / E131_PIXELS_PER_UNIVERSE;
+    const uint16_t universe = be16(packet + E131_UNIVERSE);
+    if (universe < FIRST_UNIVERSE || universe >= FIRST_UNIVERSE + n_universes) {
+        m_stats.rejected++;
+        return;
+    }
+    // The value count includes the start code
+    size_t channels = be16(packet + E131_VALUE_COUNT);
+    channels = channels ? channels - 1 : 0;
+    if (channels > E131_MAX_CHANNELS || len < E131_DATA + channels) {
+        m_stats.rejected++;
+        return;
+    }
+    m_stats.packets++;
+    const size_t count = std::min(channels / BYTES_PER_PIXEL, E131_PIXELS_PER_UNIVERSE);
+    write((universe - FIRST_UNIVERSE) * E131_PIXELS_PER_UNIVERSE, packet + E131_DATA, count);
+
+    const uint16_t sync_address = be16(packet + E131_SYNC_ADDRESS);
+    if (sync_address) {
+        m_sync_address = sync_address;
+    } else if (universe == FIRST_UNIVERSE + n_universes - 1) {
+        present();
+    }
+}
+
+// --------------------------------------------------------------------------------------
+void Receiver::write(size_t first, const uint8_t *rgb, size_t count) {
+    if (first >= m_n_pixels) {
+        return;
+    }
+    m_sink.write_pixels(first, rgb, std::min(count, m_n_pixels - first));
+}
+
+// --------------------------------------------------------------------------------------
+void Receiver::write_timed(uint32_t timecode, size_t first, const uint8_t *rgb, size_t count) {
+    if (first >= m_n_pixels) {
+        return;
+    }
+    m_sink.write_timed_pixels(timecode, first, rgb, std::min(count, m_n_pixels - first));
+}
+
+// --------------------------------------------------------------------------------------
+void Receiver::present() {
+    m_stats.frames++;
+    m_stats.last_frame_ms = millis();
+    m_sink.present();
+}
+
+// --------------------------------------------------------------------------------------
+void Receiver::present_at(uint32_t timecode) {
+    m_stats.frames++;
+    m_stats.last_frame_ms = millis();
+    m_sink.present_at(timecode);
+}
+
+// --------------------------------------------------------------------------------------
+SocketReceiver::SocketReceiver(const char *path, Sink &sink, size_t n_pixels)
+    : m_ws(path), m_sink(sink), m_n_pixels(n_pixels) {
+    m_ws.onEvent([this](AsyncWebSocket *, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data,
+                        size_t len) {
+        if (type == WS_EVT_DATA) {
+            on_data(client, *static_cast<const AwsFrameInfo *>(arg), data, len);
+        } else if (type == WS_EVT_DISCONNECT && client->id() == m_client) {
+            m_client = 0;
+        }
+    });
+}
+
+// --------------------------------------------------------------------------------------
+void SocketReceiver::on_data(AsyncWebSocketClient *client, const AwsFrameInfo &info, const uint8_t *data,
+                             size_t len) {
+    // Segments of a message arrive as their TCP segments do; its end is the last segment of its final frame
+    const bool last = info.final && info.index + len == info.len;
+    const bool start = info.index == 0 && info.opcode != WS_CONTINUATION;
+    if (start) {
+        // A new message, which also takes over from a sender that stalled mid-message
+        m_client = 0;
+        if (info.opcode != WS_BINARY || !len ||
+            (data[0] != MESSAGE_RAW && data[0] != MESSAGE_HEATSHRINK && data[0] != MESSAGE_COMMANDS)) {
+            m_stats.rejected++;
+            return;
+        }
+        m_client = client->id();
+        m_type = data[0];
+        m_next = 0;
+        m_n_partial = 0;
+        m_inflate.begin();
+        data++;
+        len--;
+    } else if (client->id() != m_client) {
+        return; // Rest of a rejected or abandoned message
+    }
+
+    if (m_type == MESSAGE_COMMANDS) {
+        if (!m_sink.write_commands(data, len, start, last)) {
+            m_client = 0;
+            m_stats.rejected++;
+            return;
+        }
+    } else if (m_type == MESSAGE_HEATSHRINK) {
+        m_inflate.feed(data, len, [this](size_t first, const uint8_t *rgb, size_t count) { write(first, rgb, count); });
+    } else {
+        // Raw pixels, possibly split between segments
+        if (m_n_partial) {
+            uint8_t pixel[BYTES_PER_PIXEL];
+            memcpy(pixel, m_partial, m_n_partial);
+            const size_t take = std::min(BYTES_PER_PIXEL - m_n_partial, len);
+            memcpy(pixel + m_n_partial, data, take);
+            m_n_partial += take;
+            data += take;
+            len -= take;
+            if (m_n_partial == BYTES_PER_PIXEL) {
+                write(m_next++, pixel, 1);
+                m_n_partial = 0;
+            } else {
+                memcpy(m_partial, pixel, m_n_partial);
+            }
+        }
+        const size_t count = len / BYTES_PER_PIXEL;
+        write(m_next, data, count);
+        m_next += count;
+        memcpy(m_partial + m_n_partial, data + count * BYTES_PER_PIXEL, len - count * BYTES_PER_PIXEL);
+        m_n_partial += len - count * BYTES_PER_PIXEL;
+    }
+
+    if (last) {
+        m_client = 0;
+        m_stats.packets++;
+        m_stats.frames++;
+        m_stats.last_frame_ms = millis();
+        m_sink.present();
+    }
+}
+
+// --------------------------------------------------------------------------------------
+void SocketReceiver::write(size_t first, const uint8_t *rgb, size_t count) {
+    if (!count || first >= m_n_pixels) {
+        return;
+    }
+    m_sink.write_pixels(first, rgb, std::min(count, m_n_pixels - first));
+}
+
+} // namespace FrameInput
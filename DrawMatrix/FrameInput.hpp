@@ -0,0 +1,203 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      FrameInput.hpp                                                                                           *
+ * @brief     Real-time frame input over UDP: DDP and E1.31 (sACN) written straight into the display                   *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#ifndef DRAWMATRIX_FRAMEINPUT
+#define DRAWMATRIX_FRAMEINPUT
+
+#include <AsyncWebSocket.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Heatshrink.hpp"
+
+struct udp_pcb;
+
+/**
+ * @brief UDP listeners for the protocols lighting software speaks.
+ *
+ * Pixels are logical, row-major RGB (pixel 0 is the top-left one):
+ * - DDP (port 4048): the data offset is a byte offset into the frame; the push flag presents the frame. Packets with
+ *   a timecode are handed to the Sink as timestamped frames, to be presented on the sender's timeline. Data type
+ *   DDP_TYPE_HEATSHRINK marks a heatshrink-compressed payload; the offset is then that of the decompressed data.
+ * - E1.31 (port 5568, unicast): universe `FIRST_UNIVERSE + n` holds pixels `n * E131_PIXELS_PER_UNIVERSE` onwards.
+ *   The frame is presented once its last universe arrives, or on the sync packet when the sender uses
+ *   synchronization.
+ * - WebSocket (SocketReceiver): one binary message per frame, `'R'` + raw pixels or `'H'` + heatshrink-compressed
+ *   pixels, from pixel 0, or `'C'` + a batch of drawing commands (DrawCommands.hpp) applied to the current frame;
+ *   presented once the message is complete.
+ *
+ * Packets are parsed in place in the lwIP receive buffer and written to the Sink as they come, compressed payloads
+ * through a 256-byte window; nothing is copied or queued in between (a sink scheduling timestamped frames keeps its
+ * own queue).
+ */
+namespace FrameInput {
+
+// Standard DDP port
+constexpr uint16_t DDP_PORT = 4048;
+// Standard E1.31 (sACN) port
+constexpr uint16_t E131_PORT = 5568;
+// Universe holding the first pixels
+constexpr uint16_t FIRST_UNIVERSE = 1;
+// RGB pixels per E1.31 universe (510 of the 512 channels, the usual mapping of lighting software)
+constexpr size_t E131_PIXELS_PER_UNIVERSE = 170;
+// DDP data type (customer-defined range) of heatshrink-compressed RGB payloads
+constexpr uint8_t DDP_TYPE_HEATSHRINK = 0x80;
+// WebSocket message types
+constexpr uint8_t MESSAGE_RAW = 'R';
+constexpr uint8_t MESSAGE_HEATSHRINK = 'H';
+constexpr uint8_t MESSAGE_COMMANDS = 'C';
+
+/**
+ * @brief Where received pixels go.
+ */
+class Sink {
+  public:
+    virtual ~Sink() = default;
+
+    /**
+     * @brief Write pixels to the frame being received; only called with pixels inside the display.
+     * @param first Logical index of the first pixel (row-major).
+     * @param rgb Pixels, 3 bytes each.
+     * @param count Number of pixels.
+     */
+    virtual void write_pixels(size_t first, const uint8_t *rgb, size_t count) = 0;
+
+    /**
+     * @brief The frame is complete: show it.
+     */
+    virtual void present() = 0;
+
+    /**
+     * @brief Run drawing commands on the current frame; a message may arrive in several pieces.
+     * @param start Whether data starts a new batch.
+     * @param end Whether data ends the batch; a command cut short there makes it invalid.
+     * @return false if the batch is invalid; the rest of the message is dropped and the frame is not presented.
+     */
+    virtual bool write_commands(const uint8_t *data, size_t len, bool start, bool end) { return false; }
+
+    /**
+     * @brief Write pixels of a timestamped frame; shown right away unless the sink schedules it.
+     * @param timecode Presentation timestamp (DDP timecode), the same for every packet of the frame.
+     */
+    virtual void write_timed_pixels(uint32_t timecode, size_t first, const uint8_t *rgb, size_t count) {
+        write_pixels(first, rgb, count);
+    }
+
+    /**
+     * @brief The timestamped frame is complete: present it at its time.
+     */
+    virtual void present_at(uint32_t timecode) { present(); }
+};
+
+/**
+ * @brief Counters since boot, for /info.
+ */
+struct Stats {
+    uint32_t packets = 0;       ///< Packets (or messages) accepted
+    uint32_t frames = 0;        ///< Frames complete (presented, or queued when timestamped)
+    uint32_t rejected = 0;      ///< Packets malformed or not meant for the display
+    uint32_t last_frame_ms = 0; ///< millis() of the last frame complete
+};
+
+/**
+ * @brief Listens on both ports and feeds the Sink.
+ */
+class Receiver {
+  public:
+    /**
+     * @brief Construct the receiver.
+     * @param sink Destination of the pixels; must outlive the receiver.
+     * @param n_pixels Pixels in the display; pixels beyond it are dropped.
+     */
+    Receiver(Sink &sink, size_t n_pixels);
+
+    /**
+     * @brief Stop listening.
+     */
+    ~Receiver();
+
+    /**
+     * @brief Start listening on both ports.
+     * @return false if a port could not be bound (out of lwIP PCBs).
+     */
+    bool begin();
+
+    /**
+     * @brief Counters since boot.
+     */
+    const Stats &stats() const { return m_stats; }
+
+  private:
+    struct Lwip; // lwIP receive callbacks (FrameInput.cpp)
+
+    void on_ddp(const uint8_t *packet, size_t len);
+    void on_e131(const uint8_t *packet, size_t len);
+
+    /**
+     * @brief Hand pixels to the sink, clipped to the display.
+     */
+    void write(size_t first, const uint8_t *rgb, size_t count);
+    void write_timed(uint32_t timecode, size_t first, const uint8_t *rgb, size_t count);
+    void present();
+    void present_at(uint32_t timecode);
+
+    Sink &m_sink;
+    size_t m_n_pixels;
+    udp_pcb *m_ddp = nullptr;
+    udp_pcb *m_e131 = nullptr;
+    uint16_t m_sync_address = 0; // E1.31 synchronization universe the pending frame waits for, 0 for none
+    Heatshrink::FrameStream m_inflate;
+    Stats m_stats;
+};
+
+/**
+ * @brief Frames sent over a WebSocket (browsers cannot send UDP), decompressed as their TCP segments arrive.
+ */
+class SocketReceiver {
+  public:
+    /**
+     * @brief Construct the receiver.
+     * @param path WebSocket URL senders connect to.
+     * @param sink Destination of the pixels; must outlive the receiver.
+     * @param n_pixels Pixels in the display; pixels beyond it are dropped.
+     */
+    SocketReceiver(const char *path, Sink &sink, size_t n_pixels);
+
+    /**
+     * @brief Web handler to register with the server.
+     */
+    AsyncWebHandler &handler() { return m_ws; }
+
+    /**
+     * @brief Counters since boot.
+     */
+    const Stats &stats() const { return m_stats; }
+
+  private:
+    void on_data(AsyncWebSocketClient *client, const AwsFrameInfo &info, const uint8_t *data, size_t len);
+    void write(size_t first, const uint8_t *rgb, size_t count);
+
+    AsyncWebSocket m_ws;
+    Sink &m_sink;
+    size_t m_n_pixels;
+    uint32_t m_client = 0;  // Sender of the message being received, 0 for none
+    uint8_t m_type = 0;     // Its message type
+    size_t m_next = 0;      // Next pixel of a raw message
+    uint8_t m_partial[2];   // Bytes of a raw pixel split between two segments
+    size_t m_n_partial = 0;
+    Heatshrink::FrameStream m_inflate;
+    Stats m_stats;
+};
+
+} // namespace FrameInput
+
+#endif /* DRAWMATRIX_FRAMEINPUT */
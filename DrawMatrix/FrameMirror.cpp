@@ -0,0 +1,237 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      FrameMirror.cpp                                                                                          *
+ * @brief     Live mirror of the display broadcast to WebSocket viewers, delta coded with per-viewer backpressure      *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#include "FrameMirror.hpp"
+
+#include <cstring>
+#include <new>
+
+#include "FrameCodec.hpp"
+
+namespace FrameMirror {
+namespace {
+using FrameCodec::BYTES_PER_PIXEL;
+// Longest delta span (its count is one byte)
+constexpr size_t MAX_SPAN_PIXELS = 255;
+
+enum class Update : uint8_t { NONE, SKIP, DELTA, KEY };
+} // namespace
+
+// --------------------------------------------------------------------------------------
+Broadcaster::Broadcaster(const char *path, size_t n_pixels) : m_ws(path), m_n_pixels(n_pixels) {
+    m_ws.onEvent([this](AsyncWebSocket *, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data,
+                        size_t len) { on_event(client, type, arg, data, len); });
+}
+
+// --------------------------------------------------------------------------------------
+Broadcaster::Viewer *Broadcaster::find(uint32_t id) {
+    for (size_t i = 0; i < m_n_viewers; i++) {
+        if (m_viewers[i].id == id) {
+            return &m_viewers[i];
+        }
+    }
+    return nullptr;
+}
+
+// --------------------------------------------------------------------------------------
+void Broadcaster::on_event(AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len) {
+    switch (type) {
+    case WS_EVT_CONNECT:
+        if (m_n_viewers == MAX_VIEWERS) {
+            Serial.printf("Mirror: viewer %u rejected, %u already watching\n", client->id(),
+                          static_cast<unsigned>(m_n_viewers));
+            client->close();
+            return;
+        }
+        if (!m_n_viewers) {
+            // Only paid for while someone is watching
+            const size_t bytes = m_n_pixels * BYTES_PER_PIXEL;
+            m_frame.reset(new (std::nothrow) uint8_t[bytes]);
+            m_last.reset(new (std::nothrow) uint8_t[bytes]()); // Black: what a viewer shows before the key frame
+            if (!m_frame || !m_last) {
+                Serial.printf("Mirror: no memory for viewer %u\n", client->id());
+                m_frame.reset();
+                m_last.reset();
+                client->close();
+                return;
+            }
+            m_seq = 1;
+        }
+        m_viewers[m_n_viewers++] = {client->id(), 0, 0};
+        break;
+    case WS_EVT_DISCONNECT: {
+        Viewer *viewer = find(client->id());
+        if (!viewer) {
+            return;
+        }
+        *viewer = m_viewers[--m_n_viewers];
+        if (!m_n_viewers) {
+            m_frame.reset();
+            m_last.reset();
+        }
+        break;
+    }
+    case WS_EVT_DATA: {
+        // Acknowledgement: the 4 sequence bytes of the frame, in a single binary frame
+        const AwsFrameInfo *info = static_cast<const AwsFrameInfo *>(arg);
+        Viewer *viewer = find(client->id());
+        if (!viewer || info->opcode != WS_BINARY || info->index != 0 || info->len != 4 || len != 4) {
+            return;
+        }
+        const uint32_t seq = data[0] | (data[1] << 8) | (data[2] << 16) | (static_cast<uint32_t>(data[3]) << 24);
+        if (seq == viewer->sent) {
+            viewer->acked = seq;
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+// --------------------------------------------------------------------------------------
+size_t Broadcaster::encode_delta(uint8_t *out) {
+    const uint8_t *frame = m_frame.get();
+    uint8_t *last = m_last.get();
+    auto changed = [&](size_t i) {
+        return memcmp(frame + i * BYTES_PER_PIXEL, last + i * BYTES_PER_PIXEL, BYTES_PER_PIXEL) != 0;
+    };
+
+    size_t o = HEADER_SIZE;
+    size_t i = 0;
+    while (i < m_n_pixels) {
+        if (!changed(i)) {
+            i++;
+            continue;
+        }
+        // Bridge single unchanged pixels: resending one costs the same as a new span header
+        size_t end = i + 1;
+        for (size_t j = i + 1; j < m_n_pixels && j - i < MAX_SPAN_PIXELS; j++) {
+            if (changed(j)) {
+                end = j + 1;
+            } else if (j > end) {
+                break;
+            }
+        }
+        const size_t count = end - i;
+        if (out) {
+            out[o] = static_cast<uint8_t>(i);
+            out[o + 1] = static_cast<uint8_t>(i >> 8);
+            out[o + 2] = static_cast<uint8_t>(count);
+            memcpy(out + o + SPAN_HEADER_SIZE, frame + i * BYTES_PER_PIXEL, count * BYTES_PER_PIXEL);
+            memcpy(last + i * BYTES_PER_PIXEL, frame + i * BYTES_PER_PIXEL, count * BYTES_PER_PIXEL);
+        }
+        o += SPAN_HEADER_SIZE + count * BYTES_PER_PIXEL;
+        i = end;
+    }
+    return o;
+}
+
+// --------------------------------------------------------------------------------------
+AsyncWebSocketMessageBuffer *Broadcaster::make_message(uint8_t type, size_t len) {
+    AsyncWebSocketMessageBuffer *buffer = m_ws.makeBuffer(len);
+    if (!buffer || !buffer->get()) {
+        return nullptr;
+    }
+    // Kept until publish() is done with it; the socket frees it once the last viewer has sent it
+    buffer->lock();
+    uint8_t *p = buffer->get();
+    p[0] = type;
+    p[1] = static_cast<uint8_t>(m_seq);
+    p[2] = static_cast<uint8_t>(m_seq >> 8);
+    p[3] = static_cast<uint8_t>(m_seq >> 16);
+    p[4] = static_cast<uint8_t>(m_seq >> 24);
+    return buffer;
+}
+
+// --------------------------------------------------------------------------------------
+void Broadcaster::publish() {
+    if (!m_n_viewers) {
+        return;
+    }
+
+    AsyncWebSocketMessageBuffer *delta = nullptr;
+    const size_t delta_len = encode_delta(nullptr);
+    if (delta_len > HEADER_SIZE) {
+        m_seq++;
+        m_stats.frames++;
+        delta = make_message(DELTA_FRAME, delta_len);
+        if (delta) {
+            encode_delta(delta->get());
+        } else {
+            // Viewers will get a key frame instead
+            memcpy(m_last.get(), m_frame.get(), m_n_pixels * BYTES_PER_PIXEL);
+        }
+    }
+
+    Update updates[MAX_VIEWERS];
+    size_t n_deltas = 0;
+    size_t n_keys = 0;
+    for (size_t i = 0; i < m_n_viewers; i++) {
+        const Viewer &viewer = m_viewers[i];
+        AsyncWebSocketClient *client = m_ws.client(viewer.id);
+        if (viewer.acked == m_seq) {
+            updates[i] = Update::NONE;
+        } else if (!client || viewer.sent != viewer.acked || !client->canSend()) {
+            // Previous frame still on its way: skip this one rather than queue it
+            updates[i] = Update::SKIP;
+            m_stats.skipped++;
+        } else if (delta && viewer.acked == m_seq - 1) {
+            updates[i] = Update::DELTA;
+            n_deltas++;
+        } else {
+            updates[i] = Update::KEY;
+            n_keys++;
+        }
+    }
+
+    AsyncWebSocketMessageBuffer *key = nullptr;
+    if (n_keys) {
+        const size_t key_len = HEADER_SIZE + FrameCodec::rle_encode(m_last.get(), m_n_pixels, nullptr, 0);
+        key = make_message(KEY_FRAME, key_len);
+        if (key) {
+            FrameCodec::rle_encode(m_last.get(), m_n_pixels, key->get() + HEADER_SIZE, key_len - HEADER_SIZE);
+            m_stats.key_frames++;
+        }
+    }
+
+    if (n_deltas == m_n_viewers && m_ws.count() == m_n_viewers) {
+        // The usual case: everyone kept up, one shared message for all
+        m_ws.binaryAll(delta); // Unlocks it: handed over
+        delta = nullptr;
+        for (size_t i = 0; i < m_n_viewers; i++) {
+            m_viewers[i].sent = m_seq;
+        }
+        m_stats.sent += m_n_viewers;
+    } else {
+        for (size_t i = 0; i < m_n_viewers; i++) {
+            AsyncWebSocketMessageBuffer *message =
+                updates[i] == Update::DELTA ? delta : (updates[i] == Update::KEY ? key : nullptr);
+            if (!message) {
+                continue;
+            }
+            m_ws.client(m_viewers[i].id)->binary(message);
+            m_viewers[i].sent = m_seq;
+            m_stats.sent++;
+        }
+    }
+
+    if (delta) {
+        delta->unlock();
+    }
+    if (key) {
+        key->unlock();
+    }
+    // Frees the messages no viewer took
+    m_ws._cleanBuffers();
+}
+
+} // namespace FrameMirror
@@ -0,0 +1,126 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      FrameMirror.hpp                                                                                          *
+ * @brief     Live mirror of the display broadcast to WebSocket viewers, delta coded with per-viewer backpressure      *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#ifndef DRAWMATRIX_FRAMEMIRROR
+#define DRAWMATRIX_FRAMEMIRROR
+
+#include <AsyncWebSocket.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/**
+ * @brief Display mirror over a WebSocket.
+ *
+ * Binary messages, all starting with a type byte and the frame sequence number (uint32, little endian):
+ * - `'K'` key frame: FrameCodec RLE of the whole frame (row-major RGB);
+ * - `'D'` delta against the previous frame: spans of `[start:uint16 LE][count:uint8][count RGB pixels]`.
+ *
+ * Viewers acknowledge each frame by sending its 4 sequence bytes back. A viewer only gets a new frame once the
+ * previous one is acknowledged (frames in between are skipped, never queued), so a slow phone costs no heap. Viewers
+ * that acked the previous frame get the shared delta, any other gets the shared key frame: each frame is encoded at
+ * most twice whatever the number of viewers.
+ */
+namespace FrameMirror {
+
+// Message types
+constexpr uint8_t KEY_FRAME = 'K';
+constexpr uint8_t DELTA_FRAME = 'D';
+// Type byte and sequence number
+constexpr size_t HEADER_SIZE = 5;
+// Start and count of a delta span
+constexpr size_t SPAN_HEADER_SIZE = 3;
+// Viewers served at once; more are turned away
+constexpr size_t MAX_VIEWERS = 4;
+
+/**
+ * @brief Counters since boot, for /info.
+ */
+struct Stats {
+    uint32_t frames = 0;     ///< Changed frames published
+    uint32_t key_frames = 0; ///< Key frames encoded
+    uint32_t sent = 0;       ///< Messages queued to viewers
+    uint32_t skipped = 0;    ///< Viewer updates skipped because the previous frame was not acked yet
+};
+
+/**
+ * @brief Publishes frames to every connected viewer.
+ */
+class Broadcaster {
+  public:
+    /**
+     * @brief Construct the broadcaster.
+     * @param path WebSocket URL viewers connect to.
+     * @param n_pixels Pixels per frame.
+     */
+    Broadcaster(const char *path, size_t n_pixels);
+
+    /**
+     * @brief Web handler to register with the server.
+     */
+    AsyncWebHandler &handler() { return m_ws; }
+
+    /**
+     * @brief Number of connected viewers; nothing needs to be published without any.
+     */
+    size_t viewers() const { return m_n_viewers; }
+
+    /**
+     * @brief Buffer to write the next frame to (row-major RGB), nullptr without viewers.
+     */
+    uint8_t *frame() { return m_frame.get(); }
+
+    /**
+     * @brief Send the frame written to frame() to the viewers that are ready for it.
+     */
+    void publish();
+
+    /**
+     * @brief Counters since boot.
+     */
+    const Stats &stats() const { return m_stats; }
+
+  private:
+    struct Viewer {
+        uint32_t id;    ///< AsyncWebSocketClient id
+        uint32_t sent;  ///< Sequence number of the last frame sent
+        uint32_t acked; ///< Sequence number of the last frame acknowledged, 0 for none
+    };
+
+    void on_event(AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len);
+    Viewer *find(uint32_t id);
+
+    /**
+     * @brief Delta from m_last to m_frame; also brings m_last up to date when writing.
+     * @param out Message to write, nullptr to only measure.
+     * @return Message length (HEADER_SIZE when nothing changed).
+     */
+    size_t encode_delta(uint8_t *out);
+
+    /**
+     * @brief Shared message buffer with the header written, nullptr if out of memory.
+     */
+    AsyncWebSocketMessageBuffer *make_message(uint8_t type, size_t len);
+
+    AsyncWebSocket m_ws;
+    size_t m_n_pixels;
+    std::unique_ptr<uint8_t[]> m_frame; // Frame being published, allocated while there are viewers
+    std::unique_ptr<uint8_t[]> m_last;  // Last published frame, base of the deltas
+    uint32_t m_seq = 1;                 // Sequence number of m_last
+    Viewer m_viewers[MAX_VIEWERS];
+    size_t m_n_viewers = 0;
+    Stats m_stats;
+};
+
+} // namespace FrameMirror
+
+#endif /* DRAWMATRIX_FRAMEMIRROR */
@@ -0,0 +1,253 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      Gallery.cpp                                                                                              *
+ * @brief     Named frames stored compressed in LittleFS, found through one index file                                 *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#include "Gallery.hpp"
+
+#include <LittleFS.h>
+#include <coredecls.h> // crc32
+
+#include <cstring>
+#include <new>
+
+#include "FrameCodec.hpp"
+
+namespace Gallery {
+namespace {
+constexpr uint8_t MAGIC[4] = {'D', 'M', 'G', '1'};
+constexpr size_t HEADER_SIZE = 8;
+constexpr size_t ENTRY_SIZE = 36;
+constexpr size_t NAME_SIZE = MAX_NAME_LEN + 1;
+constexpr const char *DATA_TEMP_PATH = "/gallery.dat.tmp";
+constexpr const char *INDEX_TEMP_PATH = "/gallery.idx.tmp";
+
+// --------------------------------------------------------------------------------------
+inline uint32_t get_le(const uint8_t *p, size_t n) {
+    uint32_t value = 0;
+    for (size_t k = n; k--;) {
+        value = (value << 8) | p[k];
+    }
+    return value;
+}
+
+// --------------------------------------------------------------------------------------
+inline void put_le(uint8_t *p, uint32_t value, size_t n) {
+    for (size_t k = 0; k < n; k++, value >>= 8) {
+        p[k] = value & 0xFF;
+    }
+}
+} // namespace
+
+// --------------------------------------------------------------------------------------
+Store::Store(uint16_t width, uint16_t height) : m_width(width), m_height(height) {}
+
+// --------------------------------------------------------------------------------------
+bool Store::begin() {
+    m_n_entries = 0;
+    File data = LittleFS.open(DATA_PATH, "r");
+    m_data_size = data ? data.size() : 0;
+    data.close();
+
+    File index = LittleFS.open(INDEX_PATH, "r");
+    if (!index) {
+        return false;
+    }
+    uint8_t header[HEADER_SIZE];
+    if (index.read(header, HEADER_SIZE) != HEADER_SIZE || memcmp(header, MAGIC, sizeof(MAGIC)) != 0 ||
+        header[4] > MAX_FRAMES) {
+        Serial.println("Gallery index is invalid");
+        return false;
+    }
+    m_next_id = header[5] ? header[5] : 1;
+    for (size_t k = 0; k < header[4]; k++) {
+        uint8_t raw[ENTRY_SIZE];
+        if (index.read(raw, ENTRY_SIZE) != ENTRY_SIZE) {
+            Serial.println("Gallery index is truncated");
+            break;
+        }
+        Entry &entry = m_entries[m_n_entries];
+        entry.id = raw[0];
+        memcpy(entry.name, raw + 1, NAME_SIZE);
+        entry.name[MAX_NAME_LEN] = '\0';
+        entry.len = get_le(raw + 1 + NAME_SIZE, 2);
+        entry.offset = get_le(raw + 3 + NAME_SIZE, 4);
+        entry.crc = get_le(raw + 7 + NAME_SIZE, 4);
+        if (entry.offset + entry.len <= m_data_size) {
+            m_n_entries++; // Otherwise its data was lost
+        }
+    }
+    return true;
+}
+
+// --------------------------------------------------------------------------------------
+const Entry *Store::find(uint8_t id) const {
+    for (size_t k = 0; k < m_n_entries; k++) {
+        if (m_entries[k].id == id) {
+            return &m_entries[k];
+        }
+    }
+    return nullptr;
+}
+
+// --------------------------------------------------------------------------------------
+const Entry *Store::find(const char *name) const {
+    for (size_t k = 0; k < m_n_entries; k++) {
+        if (!strcmp(m_entries[k].name, name)) {
+            return &m_entries[k];
+        }
+    }
+    return nullptr;
+}
+
+// --------------------------------------------------------------------------------------
+const char *Store::save(const char *name, const uint8_t *pixels, uint8_t &id) {
+    const Entry *found = find(name);
+    Entry *entry = found ? &m_entries[found - m_entries] : nullptr;
+    if (!entry && m_n_entries == MAX_FRAMES) {
+        return "Gallery is full";
+    }
+    const size_t n_pixels = static_cast<size_t>(m_width) * m_height;
+    const size_t capacity = FrameCodec::rle_max_size(n_pixels);
+    std::unique_ptr<uint8_t[]> out(new (std::nothrow) uint8_t[capacity]);
+    if (!out) {
+        return "Not enough memory to save a frame";
+    }
+    const size_t len = FrameCodec::rle_encode(pixels, n_pixels, out.get(), capacity);
+
+    File data = LittleFS.open(DATA_PATH, "a");
+    const bool written = data && data.write(out.get(), len) == len;
+    const uint32_t offset = m_data_size;
+    m_data_size = data ? data.size() : m_data_size;
+    data.close();
+    if (!written) {
+        return "Failed to write the gallery";
+    }
+
+    if (!entry) {
+        entry = &m_entries[m_n_entries++];
+        while (!m_next_id || find(m_next_id)) {
+            m_next_id++; // At most MAX_FRAMES ids are taken, one of the next ones is free
+        }
+        entry->id = m_next_id++;
+        strncpy(entry->name, name, MAX_NAME_LEN);
+        entry->name[MAX_NAME_LEN] = '\0';
+    }
+    entry->len = len;
+    entry->offset = offset;
+    entry->crc = crc32(out.get(), len);
+    id = entry->id;
+    if (!write_index()) {
+        return "Failed to write the gallery index";
+    }
+    compact();
+    return nullptr;
+}
+
+// --------------------------------------------------------------------------------------
+const char *Store::remove(uint8_t id) {
+    const Entry *entry = find(id);
+    if (!entry) {
+        return "No such frame";
+    }
+    const size_t k = entry - m_entries;
+    memmove(&m_entries[k], &m_entries[k + 1], (m_n_entries - k - 1) * sizeof(Entry));
+    m_n_entries--;
+    if (!write_index()) {
+        return "Failed to write the gallery index";
+    }
+    compact();
+    return nullptr;
+}
+
+// --------------------------------------------------------------------------------------
+std::unique_ptr<uint8_t[]> Store::read(const Entry &entry, const char *&error) const {
+    std::unique_ptr<uint8_t[]> data(new (std::nothrow) uint8_t[entry.len]);
+    if (!data) {
+        error = "Not enough memory to read a frame";
+        return nullptr;
+    }
+    File file = LittleFS.open(DATA_PATH, "r");
+    if (!file || !file.seek(entry.offset) || file.read(data.get(), entry.len) != entry.len ||
+        crc32(data.get(), entry.len) != entry.crc) {
+        error = "Stored frame is damaged";
+        return nullptr;
+    }
+    return data;
+}
+
+// --------------------------------------------------------------------------------------
+void Store::recalled(uint32_t us) {
+    m_stats.recalls++;
+    m_stats.recall_us = us;
+    m_stats.recall_max_us = us > m_stats.recall_max_us ? us : m_stats.recall_max_us;
+}
+
+// --------------------------------------------------------------------------------------
+bool Store::write_index() {
+    File index = LittleFS.open(INDEX_TEMP_PATH, "w");
+    if (!index) {
+        return false;
+    }
+    uint8_t header[HEADER_SIZE] = {MAGIC[0], MAGIC[1], MAGIC[2], MAGIC[3], static_cast<uint8_t>(m_n_entries),
+                                   m_next_id};
+    bool written = index.write(header, HEADER_SIZE) == HEADER_SIZE;
+    for (size_t k = 0; k < m_n_entries && written; k++) {
+        const Entry &entry = m_entries[k];
+        uint8_t raw[ENTRY_SIZE] = {entry.id};
+        memcpy(raw + 1, entry.name, NAME_SIZE);
+        put_le(raw + 1 + NAME_SIZE, entry.len, 2);
+        put_le(raw + 3 + NAME_SIZE, entry.offset, 4);
+        put_le(raw + 7 + NAME_SIZE, entry.crc, 4);
+        written = index.write(raw, ENTRY_SIZE) == ENTRY_SIZE;
+    }
+    index.close();
+    if (!written || !LittleFS.rename(INDEX_TEMP_PATH, INDEX_PATH)) {
+        LittleFS.remove(INDEX_TEMP_PATH);
+        return false;
+    }
+    return true;
+}
+
+// --------------------------------------------------------------------------------------
+void Store::compact() {
+    uint32_t live = 0;
+    for (size_t k = 0; k < m_n_entries; k++) {
+        live += m_entries[k].len;
+    }
+    if (m_data_size - live <= live) {
+        return;
+    }
+
+    // Frames are copied one at a time, in index order; their offsets change once the new file is in place
+    File out = LittleFS.open(DATA_TEMP_PATH, "w");
+    bool written = static_cast<bool>(out);
+    for (size_t k = 0; k < m_n_entries && written; k++) {
+        const char *error = nullptr;
+        std::unique_ptr<uint8_t[]> data = read(m_entries[k], error);
+        written = data && out.write(data.get(), m_entries[k].len) == m_entries[k].len;
+    }
+    out.close();
+    if (!written || !LittleFS.rename(DATA_TEMP_PATH, DATA_PATH)) {
+        LittleFS.remove(DATA_TEMP_PATH);
+        Serial.println("Failed to compact the gallery");
+        return;
+    }
+    // A power cut before the index is rewritten leaves old offsets over the new data: the CRCs reject those frames
+    m_data_size = 0;
+    for (size_t k = 0; k < m_n_entries; k++) {
+        m_entries[k].offset = m_data_size;
+        m_data_size += m_entries[k].len;
+    }
+    if (!write_index()) {
+        Serial.println("Failed to write the gallery index");
+    }
+}
+
+} // namespace Gallery
@@ -0,0 +1,131 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      Gallery.hpp                                                                                              *
+ * @brief     Named frames stored compressed in LittleFS, found through one index file                                 *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#ifndef DRAWMATRIX_GALLERY
+#define DRAWMATRIX_GALLERY
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/**
+ * @brief Two files: DATA_PATH, the frames in FrameCodec RLE one after the other, and INDEX_PATH, a header ("DMG1",
+ * count, next id, 2 reserved bytes) followed by one 36-byte entry per frame (id, name padded to 25 bytes, then length,
+ * offset and CRC-32 of its data, little-endian). The index lives in RAM, so a recall is a lookup, a seek and one read
+ * of a few hundred bytes: no directory scan, no parsing.
+ *
+ * Saving appends the frame and rewrites the index (temporary file, then rename). Replaced and deleted frames leave
+ * dead bytes behind; the data file is compacted once they outweigh the live ones.
+ */
+namespace Gallery {
+
+// Frames, back to back
+constexpr const char *DATA_PATH = "/gallery.dat";
+// Where each frame is
+constexpr const char *INDEX_PATH = "/gallery.idx";
+// Frames the gallery holds
+constexpr size_t MAX_FRAMES = 24;
+// Longest name; names follow the rules of animation names (Animation::valid_name)
+constexpr size_t MAX_NAME_LEN = 24;
+
+struct Entry {
+    uint8_t id = 0;                   ///< Stable identifier, 1-255
+    char name[MAX_NAME_LEN + 1] = {}; ///< NUL-terminated
+    uint16_t len = 0;                 ///< Bytes of RLE data
+    uint32_t offset = 0;              ///< Where they start in DATA_PATH
+    uint32_t crc = 0;                 ///< CRC-32 of the data
+};
+
+/**
+ * @brief Recall timings, for /info.
+ */
+struct Stats {
+    uint32_t recalls = 0;       ///< Frames recalled since boot
+    uint32_t recall_us = 0;     ///< Last recall, from the request to the frame shown
+    uint32_t recall_max_us = 0; ///< Slowest recall
+};
+
+class Store {
+  public:
+    /**
+     * @brief Construct an empty gallery for frames of the given size.
+     */
+    Store(uint16_t width, uint16_t height);
+
+    /**
+     * @brief Load the index (LittleFS must be mounted).
+     * @return false if there is none or it is invalid; the gallery is then empty.
+     */
+    bool begin();
+
+    size_t size() const { return m_n_entries; }
+    const Entry &operator[](size_t k) const { return m_entries[k]; }
+
+    /**
+     * @brief Look a frame up, nullptr if there is none.
+     */
+    const Entry *find(uint8_t id) const;
+    const Entry *find(const char *name) const;
+
+    /**
+     * @brief Store a frame, replacing the one of the same name (which keeps its id).
+     * @param name Valid name, at most MAX_NAME_LEN characters.
+     * @param pixels width x height pixels, 3 bytes each.
+     * @param id Set to the frame's id.
+     * @return nullptr on success, otherwise why it failed.
+     */
+    const char *save(const char *name, const uint8_t *pixels, uint8_t &id);
+
+    /**
+     * @brief Delete a frame.
+     * @return nullptr on success, otherwise why it failed.
+     */
+    const char *remove(uint8_t id);
+
+    /**
+     * @brief Read the data of a frame, checked against its CRC.
+     * @param error Set to why it failed when nullptr is returned.
+     * @return entry.len bytes of RLE, to decode with FrameCodec.
+     */
+    std::unique_ptr<uint8_t[]> read(const Entry &entry, const char *&error) const;
+
+    /**
+     * @brief Bytes in the data file, dead ones included.
+     */
+    uint32_t data_size() const { return m_data_size; }
+
+    /**
+     * @brief Account for a recall that took `us` from the request to the frame shown.
+     */
+    void recalled(uint32_t us);
+
+    const Stats &stats() const { return m_stats; }
+
+  private:
+    bool write_index();
+
+    /**
+     * @brief Rewrite the data file without dead bytes, if they outweigh the live ones.
+     */
+    void compact();
+
+    uint16_t m_width;
+    uint16_t m_height;
+    Entry m_entries[MAX_FRAMES];
+    size_t m_n_entries = 0;
+    uint8_t m_next_id = 1;
+    uint32_t m_data_size = 0;
+    Stats m_stats;
+};
+
+} // namespace Gallery
+
+#endif /* DRAWMATRIX_GALLERY */
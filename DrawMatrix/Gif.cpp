@@ -0,0 +1,568 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      Gif.cpp                                                                                                  *
+ * @brief     Streaming GIF decoder and player writing straight into the canvas                                        *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#include "Gif.hpp"
+
+#include <LittleFS.h>
+
+#include <cstring>
+#include <new>
+
+namespace Gif {
+namespace {
+constexpr size_t HEADER_SIZE = 13;
+constexpr size_t DESCRIPTOR_SIZE = 9;
+constexpr size_t PALETTE_SIZE = 256 * 3;
+constexpr uint8_t BLOCK_EXTENSION = 0x21;
+constexpr uint8_t BLOCK_IMAGE = 0x2C;
+constexpr uint8_t BLOCK_TRAILER = 0x3B;
+constexpr uint8_t LABEL_GRAPHIC_CONTROL = 0xF9;
+constexpr uint8_t LABEL_APPLICATION = 0xFF;
+constexpr uint8_t DISPOSE_BACKGROUND = 2;
+constexpr uint8_t DISPOSE_PREVIOUS = 3;
+constexpr uint16_t MAX_CODES = 4096;
+constexpr uint8_t MAX_CODE_SIZE = 12;
+constexpr uint16_t NO_CODE = 0xFFFF;
+// Bytes read from the file per call to the decoder
+constexpr size_t READ_CHUNK = 128;
+
+// --------------------------------------------------------------------------------------
+inline uint16_t le16(const uint8_t *p) { return static_cast<uint16_t>(p[0] | (p[1] << 8)); }
+
+// --------------------------------------------------------------------------------------
+inline size_t palette_bytes(uint8_t flags) { return (2u << (flags & 0x07)) * 3; }
+
+// --------------------------------------------------------------------------------------
+// Row of the image holding the n-th row of an interlaced stream (passes every 8th from 0, every 8th from 4, every
+// 4th from 2, every 2nd from 1)
+uint16_t interlaced_row(uint16_t n, uint16_t height) {
+    const uint16_t pass1 = (height + 7) / 8;
+    if (n < pass1) {
+        return n * 8;
+    }
+    n -= pass1;
+    const uint16_t pass2 = (height + 3) / 8;
+    if (n < pass2) {
+        return 4 + n * 8;
+    }
+    n -= pass2;
+    const uint16_t pass3 = (height + 1) / 4;
+    if (n < pass3) {
+        return 2 + n * 4;
+    }
+    return 1 + (n - pass3) * 2;
+}
+} // namespace
+
+// --------------------------------------------------------------------------------------
+bool is_gif(const uint8_t *data, size_t len) {
+    return len >= 6 && (memcmp(data, "GIF87a", 6) == 0 || memcmp(data, "GIF89a", 6) == 0);
+}
+
+// --------------------------------------------------------------------------------------
+const char *check_header(const uint8_t *data, size_t len, uint16_t width, uint16_t height) {
+    if (len < HEADER_SIZE || !is_gif(data, len)) {
+        return "Not a GIF file";
+    }
+    const uint16_t gif_width = le16(data + 6);
+    const uint16_t gif_height = le16(data + 8);
+    if (!gif_width || !gif_height || gif_width > width || gif_height > height) {
+        return "GIF is larger than the display";
+    }
+    return nullptr;
+}
+
+// --------------------------------------------------------------------------------------
+Decoder::Decoder(Compositor::Canvas &canvas, uint16_t width, uint16_t height)
+    : m_canvas(canvas), m_width(width), m_height(height) {}
+
+// --------------------------------------------------------------------------------------
+bool Decoder::collect(const uint8_t *data, size_t len, size_t &i, size_t size) {
+    const size_t n = size - m_have < len - i ? size - m_have : len - i;
+    memcpy(m_field + m_have, data + i, n);
+    m_have += n;
+    i += n;
+    if (m_have < size) {
+        return false;
+    }
+    m_have = 0;
+    return true;
+}
+
+// --------------------------------------------------------------------------------------
+size_t Decoder::feed(const uint8_t *data, size_t len) {
+    m_frame_done = false;
+    size_t i = 0;
+    while (i < len && !m_error && !m_frame_done && m_state != State::DONE) {
+        switch (m_state) {
+        case State::HEADER:
+            if (collect(data, len, i, HEADER_SIZE) && start(m_field)) {
+                m_state = m_need ? State::GLOBAL_PALETTE : State::BLOCK;
+                m_frames_offset = m_offset + i;
+            }
+            break;
+
+        case State::GLOBAL_PALETTE:
+        case State::LOCAL_PALETTE: {
+            // Colour tables go straight to their buffers, not through m_field
+            uint8_t *table = m_state == State::GLOBAL_PALETTE ? m_global.get() : m_local.get();
+            const size_t n = m_need - m_have < len - i ? m_need - m_have : len - i;
+            memcpy(table + m_have, data + i, n);
+            m_have += n;
+            i += n;
+            if (m_have == m_need) {
+                m_have = 0;
+                if (m_state == State::GLOBAL_PALETTE) {
+                    m_state = State::BLOCK;
+                    m_frames_offset = m_offset + i;
+                } else {
+                    m_state = State::LZW_MIN_SIZE;
+                }
+            }
+            break;
+        }
+
+        case State::BLOCK: {
+            const uint8_t block = data[i++];
+            if (block == BLOCK_EXTENSION) {
+                m_state = State::EXTENSION_LABEL;
+            } else if (block == BLOCK_IMAGE) {
+                m_state = State::IMAGE;
+            } else if (block == BLOCK_TRAILER) {
+                m_state = State::DONE;
+            } else {
+                m_error = "GIF has an unknown block";
+            }
+            break;
+        }
+
+        case State::EXTENSION_LABEL:
+            m_label = data[i++];
+            m_block = 0;
+            m_netscape = false;
+            m_state = State::EXTENSION_LEN;
+            break;
+
+        case State::EXTENSION_LEN:
+            m_need = data[i++];
+            m_have = 0;
+            m_state = m_need ? State::EXTENSION_DATA : State::BLOCK;
+            break;
+
+        case State::EXTENSION_DATA: {
+            // Only the first bytes of a sub-block matter; the rest is skipped
+            const size_t n = m_need - m_have < len - i ? m_need - m_have : len - i;
+            const size_t keep = m_have < sizeof(m_field) ? sizeof(m_field) - m_have : 0;
+            memcpy(m_field + m_have, data + i, n < keep ? n : keep);
+            m_have += n;
+            i += n;
+            if (m_have == m_need) {
+                extension_block();
+                m_block++;
+                m_have = 0;
+                m_state = State::EXTENSION_LEN;
+            }
+            break;
+        }
+
+        case State::IMAGE:
+            if (collect(data, len, i, DESCRIPTOR_SIZE) && image(m_field)) {
+                m_state = m_need ? State::LOCAL_PALETTE : State::LZW_MIN_SIZE;
+            }
+            break;
+
+        case State::LZW_MIN_SIZE: {
+            const uint8_t min_size = data[i++];
+            if (min_size < 2 || min_size > 8) {
+                m_error = "GIF frame has an invalid code size";
+                break;
+            }
+            lzw_start(min_size);
+            m_state = State::IMAGE_LEN;
+            break;
+        }
+
+        case State::IMAGE_LEN:
+            m_need = data[i++];
+            m_have = 0;
+            if (m_need) {
+                m_state = State::IMAGE_DATA;
+                break;
+            }
+            // End of the frame: it is shown now and disposed of before the next one
+            m_previous = m_frame;
+            m_delay_ms = m_next_delay_ms;
+            m_disposal = 0;
+            m_next_delay_ms = 0;
+            m_transparent = -1;
+            m_frame_done = true;
+            m_state = State::BLOCK;
+            break;
+
+        case State::IMAGE_DATA:
+            for (; i < len && m_have < m_need && !m_error; i++, m_have++) {
+                if (m_lzw_end) {
+                    continue;
+                }
+                m_bits |= static_cast<uint32_t>(data[i]) << m_n_bits;
+                m_n_bits += 8;
+                while (m_n_bits >= m_code_size && !m_lzw_end && !m_error) {
+                    const uint16_t code = m_bits & ((1u << m_code_size) - 1);
+                    m_bits >>= m_code_size;
+                    m_n_bits -= m_code_size;
+                    lzw_code(code);
+                }
+            }
+            if (m_have == m_need) {
+                m_state = State::IMAGE_LEN;
+            }
+            break;
+
+        case State::DONE:
+            break;
+        }
+    }
+    m_offset += i;
+    return i;
+}
+
+// --------------------------------------------------------------------------------------
+void Decoder::rewind() {
+    m_state = State::BLOCK;
+    m_have = 0;
+    m_offset = m_frames_offset;
+    m_disposal = 0;
+    m_next_delay_ms = 0;
+    m_transparent = -1;
+}
+
+// --------------------------------------------------------------------------------------
+bool Decoder::start(const uint8_t *header) {
+    if ((m_error = check_header(header, HEADER_SIZE, m_width, m_height))) {
+        return false;
+    }
+    const uint16_t width = le16(header + 6);
+    const uint16_t height = le16(header + 8);
+    const uint8_t flags = header[10];
+
+    // A frame fits the image, so it never adds more dictionary entries than it has pixels
+    m_capacity = static_cast<size_t>(width) * height;
+    m_capacity = m_capacity < MAX_CODES ? m_capacity : MAX_CODES;
+    m_prefix.reset(new (std::nothrow) uint16_t[m_capacity]);
+    m_suffix.reset(new (std::nothrow) uint8_t[m_capacity]);
+    m_need = flags & 0x80 ? palette_bytes(flags) : 0;
+    if (m_need) {
+        m_global.reset(new (std::nothrow) uint8_t[PALETTE_SIZE]());
+    }
+    if (!m_prefix || !m_suffix || (m_need && !m_global)) {
+        m_error = "Not enough memory to decode a GIF";
+        return false;
+    }
+    m_x0 = (m_width - width) / 2;
+    m_y0 = (m_height - height) / 2;
+    m_canvas.fill(0, 0, 0);
+    return true;
+}
+
+// --------------------------------------------------------------------------------------
+void Decoder::extension_block() {
+    const size_t len = m_need < sizeof(m_field) ? m_need : sizeof(m_field);
+    if (m_label == LABEL_GRAPHIC_CONTROL && m_block == 0 && len >= 4) {
+        m_disposal = (m_field[0] >> 2) & 0x07;
+        m_next_delay_ms = le16(m_field + 1) * 10u;
+        m_transparent = m_field[0] & 0x01 ? m_field[3] : -1;
+    } else if (m_label == LABEL_APPLICATION && m_block == 0) {
+        m_netscape = len == 11 && (memcmp(m_field, "NETSCAPE2.0", 11) == 0 || memcmp(m_field, "ANIMEXTS1.0", 11) == 0);
+    } else if (m_label == LABEL_APPLICATION && m_block == 1 && m_netscape && len >= 3 && m_field[0] == 1) {
+        // Repeat count: 0 is forever, otherwise the animation plays once more than that, as browsers do
+        const uint16_t repeats = le16(m_field + 1);
+        m_plays = repeats ? static_cast<uint16_t>(repeats < 0xFFFF ? repeats + 1 : repeats) : 0;
+    }
+}
+
+// --------------------------------------------------------------------------------------
+bool Decoder::image(const uint8_t *descriptor) {
+    Frame frame;
+    frame.x = le16(descriptor);
+    frame.y = le16(descriptor + 2);
+    frame.width = le16(descriptor + 4);
+    frame.height = le16(descriptor + 6);
+    frame.disposal = m_disposal;
+    const uint8_t flags = descriptor[8];
+    if (!frame.width || !frame.height || m_x0 + frame.x + frame.width > m_width ||
+        m_y0 + frame.y + frame.height > m_height ||
+        static_cast<size_t>(frame.width) * frame.height > m_capacity) {
+        m_error = "GIF frame is outside the image";
+        return false;
+    }
+
+    dispose();
+    m_frame = frame;
+    m_interlaced = flags & 0x40;
+    if (frame.disposal == DISPOSE_PREVIOUS) {
+        // Without memory for it, the frame simply stays
+        m_saved.reset(new (std::nothrow) uint8_t[static_cast<size_t>(frame.width) * frame.height * 3]);
+        if (m_saved) {
+            uint8_t *saved = m_saved.get();
+            for (uint16_t y = 0; y < frame.height; y++, saved += frame.width * 3) {
+                const size_t first = static_cast<size_t>(m_y0 + frame.y + y) * m_width + m_x0 + frame.x;
+                memcpy(saved, m_canvas.pixels() + first * 3, frame.width * 3);
+            }
+        }
+    }
+
+    m_need = flags & 0x80 ? palette_bytes(flags) : 0;
+    if (m_need && !m_local) {
+        m_local.reset(new (std::nothrow) uint8_t[PALETTE_SIZE]);
+        if (!m_local) {
+            m_error = "Not enough memory to decode a GIF";
+            return false;
+        }
+    }
+    if (m_need) {
+        memset(m_local.get(), 0, PALETTE_SIZE);
+    }
+    m_palette = m_need ? m_local.get() : m_global.get();
+    if (!m_palette) {
+        m_error = "GIF frame has no colour table";
+        return false;
+    }
+    return true;
+}
+
+// --------------------------------------------------------------------------------------
+void Decoder::dispose() {
+    const Frame frame = m_previous;
+    const uint8_t *saved = m_saved.get();
+    m_previous = Frame();
+    if (frame.disposal != DISPOSE_BACKGROUND && !(frame.disposal == DISPOSE_PREVIOUS && saved)) {
+        return;
+    }
+    // The background is black: what is around the image on the display
+    for (uint16_t y = 0; y < frame.height; y++) {
+        const size_t first = static_cast<size_t>(m_y0 + frame.y + y) * m_width + m_x0 + frame.x;
+        for (uint16_t x = 0; x < frame.width; x++) {
+            if (frame.disposal == DISPOSE_PREVIOUS) {
+                m_canvas.set(first + x, saved[0], saved[1], saved[2]);
+                saved += 3;
+            } else {
+                m_canvas.set(first + x, 0, 0, 0);
+            }
+        }
+    }
+    m_saved.reset();
+}
+
+// --------------------------------------------------------------------------------------
+void Decoder::lzw_start(uint8_t min_size) {
+    m_min_size = min_size;
+    m_code_size = min_size + 1;
+    m_next = (1u << min_size) + 2;
+    m_prev = NO_CODE;
+    m_bits = 0;
+    m_n_bits = 0;
+    m_pixel = 0;
+    m_lzw_end = false;
+}
+
+// --------------------------------------------------------------------------------------
+void Decoder::lzw_code(uint16_t code) {
+    const uint16_t clear = 1u << m_min_size;
+    const uint16_t first_free = clear + 2;
+    if (code == clear) {
+        m_code_size = m_min_size + 1;
+        m_next = first_free;
+        m_prev = NO_CODE;
+        return;
+    }
+    if (code == clear + 1) {
+        m_lzw_end = true;
+        return;
+    }
+    if (m_prev == NO_CODE) {
+        if (code > clear) {
+            m_error = "GIF frame data is corrupt";
+            return;
+        }
+        emit(code);
+        m_prev = code;
+        return;
+    }
+    if (code > m_next) {
+        m_error = "GIF frame data is corrupt";
+        return;
+    }
+    if (m_next < MAX_CODES) {
+        if (static_cast<size_t>(m_next - first_free) >= m_capacity) {
+            m_error = "GIF frame data is corrupt"; // More entries than the frame has pixels
+            return;
+        }
+        // The new entry is the previous string plus the first index of this one; for a code not yet in the
+        // dictionary (code == m_next), that is the first index of the previous string
+        m_prefix[m_next - first_free] = m_prev;
+        m_suffix[m_next - first_free] = static_cast<uint8_t>(first_of(code == m_next ? m_prev : code));
+        m_next++;
+        if (m_next == (1u << m_code_size) && m_code_size < MAX_CODE_SIZE) {
+            m_code_size++;
+        }
+    }
+    emit(code);
+    m_prev = code;
+}
+
+// --------------------------------------------------------------------------------------
+uint16_t Decoder::first_of(uint16_t code) const {
+    const uint16_t first_free = (1u << m_min_size) + 2;
+    while (code >= first_free) {
+        code = m_prefix[code - first_free];
+    }
+    return code;
+}
+
+// --------------------------------------------------------------------------------------
+void Decoder::emit(uint16_t code) {
+    // Strings are stored last index first: measure, then write them backwards from their last pixel
+    const uint16_t first_free = (1u << m_min_size) + 2;
+    size_t len = 1;
+    for (uint16_t c = code; c >= first_free; c = m_prefix[c - first_free]) {
+        len++;
+    }
+    size_t p = m_pixel + len;
+    for (uint16_t c = code; c >= first_free; c = m_prefix[c - first_free]) {
+        put(--p, m_suffix[c - first_free]);
+    }
+    put(--p, static_cast<uint8_t>(first_of(code)));
+    m_pixel += len;
+    if (m_pixel >= static_cast<size_t>(m_frame.width) * m_frame.height) {
+        m_lzw_end = true; // Anything after the last pixel is ignored
+    }
+}
+
+// --------------------------------------------------------------------------------------
+void Decoder::put(size_t p, uint8_t index) {
+    if (p >= static_cast<size_t>(m_frame.width) * m_frame.height || index == m_transparent) {
+        return;
+    }
+    const uint16_t x = p % m_frame.width;
+    const uint16_t n = p / m_frame.width;
+    const uint16_t y = m_interlaced ? interlaced_row(n, m_frame.height) : n;
+    const uint8_t *rgb = m_palette + index * 3;
+    m_canvas.set(static_cast<size_t>(m_y0 + m_frame.y + y) * m_width + m_x0 + m_frame.x + x, rgb[0], rgb[1], rgb[2]);
+}
+
+// --------------------------------------------------------------------------------------
+Player::Player(Compositor::Canvas &canvas, uint16_t width, uint16_t height)
+    : m_canvas(canvas), m_width(width), m_height(height) {}
+
+// --------------------------------------------------------------------------------------
+const char *Player::play(const String &path) {
+    stop();
+    m_file = LittleFS.open(path, "r");
+    if (!m_file) {
+        return "Animation not found";
+    }
+    uint8_t header[HEADER_SIZE];
+    const size_t len = m_file.read(header, sizeof(header));
+    if (const char *error = check_header(header, len, m_width, m_height)) {
+        stop();
+        return error;
+    }
+    m_file.seek(0);
+    m_decoder.reset(new (std::nothrow) Decoder(m_canvas, m_width, m_height));
+    if (!m_decoder) {
+        stop();
+        return "Not enough memory to decode a GIF";
+    }
+    m_path = path;
+    m_played = 0;
+    m_due_ms = millis();
+    return nullptr;
+}
+
+// --------------------------------------------------------------------------------------
+void Player::stop() {
+    m_file.close();
+    m_path = String();
+    m_decoder.reset();
+}
+
+// --------------------------------------------------------------------------------------
+bool Player::next_frame() {
+    uint8_t chunk[READ_CHUNK];
+    bool rewound = false;
+    while (true) {
+        const size_t n = m_file.read(chunk, sizeof(chunk));
+        if (!n) {
+            Serial.printf("Animation %s: truncated GIF\n", m_path.c_str());
+            return false;
+        }
+        const size_t used = m_decoder->feed(chunk, n);
+        if (used < n) {
+            m_file.seek(m_file.position() - (n - used)); // Next frame, read when it is due
+        }
+        if (m_decoder->error()) {
+            Serial.printf("Animation %s: %s\n", m_path.c_str(), m_decoder->error());
+            return false;
+        }
+        if (m_decoder->frame_done()) {
+            return true;
+        }
+        if (m_decoder->finished()) {
+            m_played++;
+            const uint16_t plays = m_decoder->plays();
+            if ((plays && m_played >= plays) || rewound) {
+                return false; // Played out, or no frame at all
+            }
+            m_decoder->rewind();
+            m_file.seek(m_decoder->frames_offset());
+            rewound = true;
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------
+bool Player::run(uint32_t now_ms, uint32_t &wait_ms) {
+    wait_ms = IDLE_POLL_MS;
+    if (!playing()) {
+        return false;
+    }
+    const int32_t early = static_cast<int32_t>(m_due_ms - now_ms);
+    if (early > 0) {
+        wait_ms = static_cast<uint32_t>(early);
+        return false;
+    }
+
+    // Decoded at its deadline, not ahead: the canvas is the only frame buffer and must keep the frame on display
+    const uint32_t start_us = micros();
+    const bool decoded = next_frame();
+    m_stats.decode_us = micros() - start_us;
+    if (!decoded) {
+        Serial.printf("Animation %s finished\n", m_path.c_str());
+        stop(); // The last frame stays
+        return true;
+    }
+    if (static_cast<uint32_t>(-early) > LATE_TOLERANCE_MS) {
+        m_stats.late++;
+    }
+    m_stats.frames++;
+
+    uint32_t delay = m_decoder->delay_ms() ? m_decoder->delay_ms() : DEFAULT_DELAY_MS;
+    delay = delay > MIN_DELAY_MS ? delay : MIN_DELAY_MS;
+    m_due_ms += delay;
+    if (static_cast<int32_t>(m_due_ms - now_ms) <= 0) {
+        m_due_ms = now_ms + delay;
+    }
+    const int32_t left = static_cast<int32_t>(m_due_ms - millis());
+    wait_ms = left > 0 ? static_cast<uint32_t>(left) : 0;
+    return true;
+}
+
+} // namespace Gif
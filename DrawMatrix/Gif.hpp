@@ -0,0 +1,274 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      Gif.hpp                                                                                                  *
+ * @brief     Streaming GIF decoder and player writing straight into the canvas                                        *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#ifndef DRAWMATRIX_GIF
+#define DRAWMATRIX_GIF
+
+#include <Arduino.h>
+#include <FS.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "Compositor.hpp"
+
+/**
+ * @brief GIF87a/89a decoding without a frame buffer: bytes are pushed as they arrive (file reads or HTTP body chunks)
+ * and every decoded pixel goes straight to the canvas, which keeps the previous frame for the disposal modes.
+ *
+ * The image must fit the display (it is centred on it). As a frame has at most width x height pixels, its LZW
+ * dictionary never holds more entries than that, which bounds the decoder to about 4 KB for 32x24 instead of the
+ * 12 KB a general-purpose decoder needs for 4096 codes.
+ */
+namespace Gif {
+
+// Extension of stored GIF animations (next to the .dma ones, see Animation::path)
+constexpr const char *EXTENSION = ".gif";
+// Played when a frame has no delay, as browsers do
+constexpr uint32_t DEFAULT_DELAY_MS = 100;
+// Shortest frame delay honoured
+constexpr uint32_t MIN_DELAY_MS = 20;
+// Presented later than this after its time, a frame counts as late
+constexpr uint32_t LATE_TOLERANCE_MS = 5;
+// How often the player looks for work while stopped
+constexpr uint32_t IDLE_POLL_MS = 100;
+
+/**
+ * @brief Whether data starts like a GIF.
+ */
+bool is_gif(const uint8_t *data, size_t len);
+
+/**
+ * @brief Check the start of a GIF.
+ * @param data First bytes of the file.
+ * @param len Length of data; must cover the 13-byte header.
+ * @param width Width of the display.
+ * @param height Height of the display.
+ * @return nullptr if it can be played, otherwise why not.
+ */
+const char *check_header(const uint8_t *data, size_t len, uint16_t width, uint16_t height);
+
+/**
+ * @brief Push decoder.
+ */
+class Decoder {
+  public:
+    /**
+     * @brief Construct a decoder expecting the start of a GIF.
+     * @param canvas Where frames are drawn.
+     * @param width Width of the canvas.
+     * @param height Height of the canvas.
+     */
+    Decoder(Compositor::Canvas &canvas, uint16_t width, uint16_t height);
+
+    /**
+     * @brief Decode the next bytes; stops right after a frame is complete so it can be shown.
+     * @return Bytes consumed: less than len after a frame, at the trailer or on error.
+     */
+    size_t feed(const uint8_t *data, size_t len);
+
+    /**
+     * @brief Whether the last feed() completed a frame.
+     */
+    bool frame_done() const { return m_frame_done; }
+
+    /**
+     * @brief Delay of the last completed frame.
+     */
+    uint32_t delay_ms() const { return m_delay_ms; }
+
+    /**
+     * @brief Whether the trailer was reached.
+     */
+    bool finished() const { return m_state == State::DONE; }
+
+    /**
+     * @brief Why decoding stopped, nullptr while fine.
+     */
+    const char *error() const { return m_error; }
+
+    /**
+     * @brief Times the animation is meant to be played, 0 for forever (NETSCAPE2.0 extension; once without it).
+     */
+    uint16_t plays() const { return m_plays; }
+
+    /**
+     * @brief Offset of the first frame in the stream, where rewind() expects the bytes to resume.
+     */
+    size_t frames_offset() const { return m_frames_offset; }
+
+    /**
+     * @brief Expect the first frame again, to loop; the palette and the canvas are kept.
+     */
+    void rewind();
+
+  private:
+    enum class State : uint8_t {
+        HEADER,
+        GLOBAL_PALETTE,
+        BLOCK,
+        EXTENSION_LABEL,
+        EXTENSION_LEN,
+        EXTENSION_DATA,
+        IMAGE,
+        LOCAL_PALETTE,
+        LZW_MIN_SIZE,
+        IMAGE_LEN,
+        IMAGE_DATA,
+        DONE
+    };
+
+    struct Frame {
+        uint16_t x = 0;
+        uint16_t y = 0;
+        uint16_t width = 0;
+        uint16_t height = 0;
+        uint8_t disposal = 0;
+    };
+
+    /**
+     * @brief Accumulate a fixed-size field; true once it is complete.
+     */
+    bool collect(const uint8_t *data, size_t len, size_t &i, size_t size);
+
+    bool start(const uint8_t *header);
+    void extension_block();
+    bool image(const uint8_t *descriptor);
+    void dispose();
+    void lzw_start(uint8_t min_size);
+    void lzw_code(uint16_t code);
+    uint16_t first_of(uint16_t code) const;
+    void emit(uint16_t code);
+    void put(size_t p, uint8_t index);
+
+    Compositor::Canvas &m_canvas;
+    uint16_t m_width;
+    uint16_t m_height;
+    State m_state = State::HEADER;
+    const char *m_error = nullptr;
+    uint8_t m_field[16]; // Header, descriptor or extension sub-block being collected
+    size_t m_have = 0;
+    size_t m_need = 0;
+    size_t m_offset = 0; // Bytes consumed since the start
+    size_t m_frames_offset = 0;
+    uint16_t m_plays = 1;
+    bool m_frame_done = false;
+
+    // Image
+    uint16_t m_x0 = 0; // Where the image is placed on the canvas
+    uint16_t m_y0 = 0;
+    std::unique_ptr<uint8_t[]> m_global; // Colour tables, 256 entries each, allocated when present
+    std::unique_ptr<uint8_t[]> m_local;
+    const uint8_t *m_palette = nullptr; // Table of the current frame
+
+    // Extensions
+    uint8_t m_label = 0;
+    uint8_t m_block = 0;         // Sub-block index
+    bool m_netscape = false;     // Application extension carrying the loop count
+    uint8_t m_disposal = 0;      // Graphic control of the next frame
+    uint32_t m_next_delay_ms = 0;
+    int16_t m_transparent = -1;
+
+    // Frames
+    Frame m_frame;
+    bool m_interlaced = false;
+    uint32_t m_delay_ms = 0;            // Of the last completed frame
+    Frame m_previous;                   // Disposed of before the next frame
+    std::unique_ptr<uint8_t[]> m_saved; // Canvas under m_previous, for "restore to previous"
+
+    // LZW
+    std::unique_ptr<uint16_t[]> m_prefix; // Entries from the first free code: prefix code and last index
+    std::unique_ptr<uint8_t[]> m_suffix;
+    size_t m_capacity = 0;
+    uint8_t m_min_size = 0;
+    uint8_t m_code_size = 0;
+    uint16_t m_next = 0;
+    uint16_t m_prev = 0;
+    uint32_t m_bits = 0;
+    uint8_t m_n_bits = 0;
+    size_t m_pixel = 0; // Pixels of the frame decoded
+    bool m_lzw_end = false;
+};
+
+/**
+ * @brief Counters since boot, for /info.
+ */
+struct Stats {
+    uint32_t frames = 0;    ///< Frames presented
+    uint32_t late = 0;      ///< Frames presented after their time
+    uint32_t decode_us = 0; ///< Time taken to decode the last frame
+};
+
+/**
+ * @brief Plays a GIF file from LittleFS, decoding each frame into the canvas when it is due.
+ */
+class Player {
+  public:
+    /**
+     * @brief Construct a stopped player.
+     * @param canvas Where frames are decoded.
+     * @param width Width of the canvas.
+     * @param height Height of the canvas.
+     */
+    Player(Compositor::Canvas &canvas, uint16_t width, uint16_t height);
+
+    /**
+     * @brief Start playing a file; stops the current one.
+     * @return nullptr on success, otherwise why it cannot be played.
+     */
+    const char *play(const String &path);
+
+    /**
+     * @brief Stop playing and free the decoder; the last frame stays on the canvas.
+     */
+    void stop();
+
+    bool playing() const { return m_decoder != nullptr; }
+
+    /**
+     * @brief Path of the file playing, empty when stopped.
+     */
+    const String &current() const { return m_path; }
+
+    /**
+     * @brief Decode the frame due (if any) into the canvas; call from the scheduler.
+     * @param now_ms Current millis().
+     * @param wait_ms Set to the milliseconds until the next frame is due.
+     * @return Whether a frame was decoded (the canvas needs showing).
+     */
+    bool run(uint32_t now_ms, uint32_t &wait_ms);
+
+    /**
+     * @brief Counters since boot.
+     */
+    const Stats &stats() const { return m_stats; }
+
+  private:
+    /**
+     * @brief Read the file into the decoder until a frame is complete, looping as the file says.
+     */
+    bool next_frame();
+
+    Compositor::Canvas &m_canvas;
+    uint16_t m_width;
+    uint16_t m_height;
+    File m_file;
+    String m_path;
+    std::unique_ptr<Decoder> m_decoder;
+    uint16_t m_played = 0; // Plays completed
+    uint32_t m_due_ms = 0;
+    Stats m_stats;
+};
+
+} // namespace Gif
+
+#endif /* DRAWMATRIX_GIF */
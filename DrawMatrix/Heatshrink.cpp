@@ -0,0 +1,98 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      Heatshrink.cpp                                                                                           *
+ * @brief     Streaming heatshrink decompression of frame payloads straight to the display                             *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#include "Heatshrink.hpp"
+
+#include <cstring>
+
+namespace Heatshrink {
+
+// --------------------------------------------------------------------------------------
+void Decoder::reset() {
+    // Back references reaching before the start of the stream read zeros, like the reference decoder
+    memset(m_window, 0, sizeof(m_window));
+    m_head = 0;
+    m_state = State::TAG;
+    m_bits = 0;
+    m_n_bits = 0;
+}
+
+// --------------------------------------------------------------------------------------
+int Decoder::get_bits(uint8_t count, const uint8_t *in, size_t len, size_t &pos) {
+    while (m_n_bits < count) {
+        if (pos == len) {
+            return -1;
+        }
+        m_bits = static_cast<uint16_t>((m_bits << 8) | in[pos++]);
+        m_n_bits += 8;
+    }
+    m_n_bits -= count;
+    const int value = (m_bits >> m_n_bits) & ((1 << count) - 1);
+    m_bits &= (1 << m_n_bits) - 1;
+    return value;
+}
+
+// --------------------------------------------------------------------------------------
+size_t Decoder::decode(const uint8_t *in, size_t len, size_t &consumed, uint8_t *out, size_t capacity) {
+    size_t pos = 0;
+    size_t o = 0;
+    bool starved = false;
+    while (o < capacity && !starved) {
+        switch (m_state) {
+        case State::TAG: {
+            const int tag = get_bits(1, in, len, pos);
+            starved = tag < 0;
+            if (!starved) {
+                m_state = tag ? State::LITERAL : State::INDEX;
+            }
+            break;
+        }
+        case State::LITERAL: {
+            const int c = get_bits(8, in, len, pos);
+            starved = c < 0;
+            if (!starved) {
+                emit(static_cast<uint8_t>(c), out, o);
+                m_state = State::TAG;
+            }
+            break;
+        }
+        case State::INDEX: {
+            const int index = get_bits(WINDOW_BITS, in, len, pos);
+            starved = index < 0;
+            if (!starved) {
+                m_offset = static_cast<uint16_t>(index + 1);
+                m_state = State::COUNT;
+            }
+            break;
+        }
+        case State::COUNT: {
+            const int count = get_bits(LOOKAHEAD_BITS, in, len, pos);
+            starved = count < 0;
+            if (!starved) {
+                m_count = static_cast<uint8_t>(count + 1);
+                m_state = State::BACKREF;
+            }
+            break;
+        }
+        case State::BACKREF:
+            // Byte by byte: a reference may overlap the bytes it produces (runs)
+            emit(m_window[(m_head - m_offset) & (sizeof(m_window) - 1)], out, o);
+            if (--m_count == 0) {
+                m_state = State::TAG;
+            }
+            break;
+        }
+    }
+    consumed = pos;
+    return o;
+}
+
+} // namespace Heatshrink
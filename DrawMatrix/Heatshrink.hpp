@@ -0,0 +1,137 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      Heatshrink.hpp                                                                                           *
+ * @brief     Streaming heatshrink decompression of frame payloads straight to the display                             *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#ifndef DRAWMATRIX_HEATSHRINK
+#define DRAWMATRIX_HEATSHRINK
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief heatshrink (LZSS) decompression with window 2^8 and lookahead 2^4, the parameters senders must use.
+ *
+ * Bit stream, most significant bit first: `1` + 8-bit literal, or `0` + 8-bit (offset - 1) + 4-bit (count - 1) back
+ * reference into the last 256 output bytes. Compatible with the reference heatshrink encoder (`-w 8 -l 4`) and with
+ * tools/heatshrink.py. Flat colours and text shrink 10-30x; all the decoder needs is its 256-byte window.
+ */
+namespace Heatshrink {
+
+// Window size (log2)
+constexpr uint8_t WINDOW_BITS = 8;
+// Lookahead size (log2)
+constexpr uint8_t LOOKAHEAD_BITS = 4;
+// Content-Type of heatshrink-compressed HTTP bodies
+constexpr const char *CONTENT_TYPE = "application/x-heatshrink";
+
+/**
+ * @brief Byte-oriented decoder; input can be fed in pieces of any size.
+ */
+class Decoder {
+  public:
+    /**
+     * @brief Start a new stream: empty (zeroed) window, no pending bits.
+     */
+    void reset();
+
+    /**
+     * @brief Decompress as much as fits in the output.
+     * @param in Compressed input.
+     * @param len Length of the input.
+     * @param consumed Set to the input bytes used; call again with the rest once the output is drained.
+     * @param out Output buffer.
+     * @param capacity Size of the output buffer.
+     * @return Bytes written to out.
+     */
+    size_t decode(const uint8_t *in, size_t len, size_t &consumed, uint8_t *out, size_t capacity);
+
+  private:
+    enum class State : uint8_t { TAG, LITERAL, INDEX, COUNT, BACKREF };
+
+    /**
+     * @brief Next `count` bits of the input, or -1 when the input ran out first.
+     */
+    int get_bits(uint8_t count, const uint8_t *in, size_t len, size_t &pos);
+
+    void emit(uint8_t c, uint8_t *out, size_t &o) {
+        m_window[m_head++ & (sizeof(m_window) - 1)] = c;
+        out[o++] = c;
+    }
+
+    uint8_t m_window[1 << WINDOW_BITS];
+    uint16_t m_head = 0;
+    State m_state = State::TAG;
+    uint16_t m_bits = 0; // Input bits not consumed yet, right aligned
+    uint8_t m_n_bits = 0;
+    uint16_t m_offset = 0; // Back reference being copied
+    uint8_t m_count = 0;
+};
+
+/**
+ * @brief Decompresses a stream of RGB pixels and hands them over in small batches.
+ */
+class FrameStream {
+  public:
+    /**
+     * @brief Start a new stream.
+     * @param first Logical index the first decoded pixel goes to.
+     */
+    void begin(size_t first = 0) {
+        m_decoder.reset();
+        m_next = first;
+        m_fill = 0;
+    }
+
+    /**
+     * @brief Decompress a piece of the stream.
+     * @param write Called as `write(first, rgb, count)` with consecutive decoded pixels, 3 bytes each.
+     */
+    template <typename Write> void feed(const uint8_t *in, size_t len, Write &&write) {
+        size_t pos = 0;
+        for (;;) {
+            size_t consumed = 0;
+            const size_t n =
+                m_decoder.decode(in + pos, len - pos, consumed, m_batch + m_fill, sizeof(m_batch) - m_fill);
+            pos += consumed;
+            m_fill += n;
+            const size_t count = m_fill / BYTES_PER_PIXEL;
+            if (count) {
+                write(m_next, m_batch, count);
+                m_next += count;
+                // Keep the incomplete pixel, if any
+                for (size_t i = count * BYTES_PER_PIXEL; i < m_fill; i++) {
+                    m_batch[i - count * BYTES_PER_PIXEL] = m_batch[i];
+                }
+                m_fill -= count * BYTES_PER_PIXEL;
+            }
+            if (!n) {
+                return; // Input exhausted
+            }
+        }
+    }
+
+    /**
+     * @brief Index of the pixel the next decoded one goes to.
+     */
+    size_t next() const { return m_next; }
+
+  private:
+    static constexpr size_t BYTES_PER_PIXEL = 3;
+    static constexpr size_t BATCH_PIXELS = 32;
+
+    Decoder m_decoder;
+    uint8_t m_batch[BATCH_PIXELS * BYTES_PER_PIXEL];
+    size_t m_fill = 0;
+    size_t m_next = 0;
+};
+
+} // namespace Heatshrink
+
+#endif /* DRAWMATRIX_HEATSHRINK */
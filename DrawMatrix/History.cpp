@@ -0,0 +1,164 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      History.cpp                                                                                              *
+ * @brief     Undo/redo of canvas edits, kept as pixel deltas in a fixed ring arena                                    *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#include "History.hpp"
+
+#include <new>
+
+namespace History {
+
+// --------------------------------------------------------------------------------------
+Journal::Journal(Compositor::Canvas &canvas, size_t budget)
+    : m_canvas(canvas), m_arena(budget ? new (std::nothrow) uint8_t[budget] : nullptr) {
+    m_stats.budget = m_arena ? budget : 0;
+    m_canvas.set_recorder(this);
+}
+
+// --------------------------------------------------------------------------------------
+void Journal::begin() {
+    if (m_recording || !m_stats.budget) {
+        return;
+    }
+    // A new edit replaces the ones undone
+    m_end = m_cursor;
+    m_stats.redo = 0;
+    m_open = m_end;
+    m_open_count = 0;
+    m_recording = true;
+    m_overflow = false;
+}
+
+// --------------------------------------------------------------------------------------
+void Journal::commit() {
+    if (!m_recording) {
+        return;
+    }
+    m_recording = false;
+    if (!m_overflow && m_open_count && reserve(COUNT_SIZE)) {
+        write16(m_open, m_open_count);
+        write16(m_end, m_open_count);
+        m_end += COUNT_SIZE;
+        m_cursor = m_end;
+        m_stats.undo++;
+        m_stats.recorded++;
+    } else if (m_overflow || m_open_count) {
+        // The canvas no longer matches the records before it
+        m_stats.too_large++;
+        clear();
+    }
+    m_stats.used = m_end - m_begin;
+}
+
+// --------------------------------------------------------------------------------------
+bool Journal::undo() {
+    commit();
+    if (m_cursor == m_begin) {
+        return false;
+    }
+    const uint16_t count = read16(m_cursor - COUNT_SIZE);
+    const uint32_t start = m_cursor - COUNT_SIZE * 2 - count * ENTRY_SIZE;
+    m_applying = true;
+    for (uint16_t k = count; k--;) {
+        swap(start + COUNT_SIZE + k * ENTRY_SIZE);
+    }
+    m_applying = false;
+    m_cursor = start;
+    m_stats.undo--;
+    m_stats.redo++;
+    return true;
+}
+
+// --------------------------------------------------------------------------------------
+bool Journal::redo() {
+    commit();
+    if (m_cursor == m_end) {
+        return false;
+    }
+    const uint16_t count = read16(m_cursor);
+    m_applying = true;
+    for (uint16_t k = 0; k < count; k++) {
+        swap(m_cursor + COUNT_SIZE + k * ENTRY_SIZE);
+    }
+    m_applying = false;
+    m_cursor += COUNT_SIZE * 2 + count * ENTRY_SIZE;
+    m_stats.undo++;
+    m_stats.redo--;
+    return true;
+}
+
+// --------------------------------------------------------------------------------------
+void Journal::clear() {
+    m_begin = m_cursor = m_end = m_open = 0;
+    m_open_count = 0;
+    m_overflow = m_recording; // The rest of an edit being recorded cannot be undone either
+    m_stats.undo = m_stats.redo = 0;
+    m_stats.used = 0;
+}
+
+// --------------------------------------------------------------------------------------
+void Journal::changing(size_t i, const uint8_t rgb[3]) {
+    if (m_applying) {
+        return;
+    }
+    if (!m_recording) {
+        if (m_end != m_begin) {
+            clear();
+        }
+        return;
+    }
+    if (m_overflow) {
+        return;
+    }
+    // The count is written on commit; its place is taken with the first entry
+    const size_t len = (m_open_count ? 0 : COUNT_SIZE) + ENTRY_SIZE;
+    if (m_open_count == UINT16_MAX || !reserve(len)) {
+        m_overflow = true;
+        return;
+    }
+    m_end += len - ENTRY_SIZE;
+    write16(m_end, static_cast<uint16_t>(i));
+    at(m_end + 2) = rgb[0];
+    at(m_end + 3) = rgb[1];
+    at(m_end + 4) = rgb[2];
+    m_end += ENTRY_SIZE;
+    m_open_count++;
+}
+
+// --------------------------------------------------------------------------------------
+void Journal::write16(uint32_t pos, uint16_t value) {
+    at(pos) = value & 0xFF;
+    at(pos + 1) = value >> 8;
+}
+
+// --------------------------------------------------------------------------------------
+bool Journal::reserve(size_t len) {
+    while (m_end + len - m_begin > m_stats.budget) {
+        if (m_begin == m_open) {
+            return false;
+        }
+        m_begin += COUNT_SIZE * 2 + read16(m_begin) * ENTRY_SIZE;
+        m_stats.undo--;
+    }
+    return true;
+}
+
+// --------------------------------------------------------------------------------------
+void Journal::swap(uint32_t pos) {
+    const uint16_t i = read16(pos);
+    const uint8_t *current = m_canvas.pixels() + i * 3;
+    const uint8_t r = at(pos + 2), g = at(pos + 3), b = at(pos + 4);
+    at(pos + 2) = current[0];
+    at(pos + 3) = current[1];
+    at(pos + 4) = current[2];
+    m_canvas.set(i, r, g, b);
+}
+
+} // namespace History
@@ -0,0 +1,120 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      History.hpp                                                                                              *
+ * @brief     Undo/redo of canvas edits, kept as pixel deltas in a fixed ring arena                                    *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#ifndef DRAWMATRIX_HISTORY
+#define DRAWMATRIX_HISTORY
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "Compositor.hpp"
+
+/**
+ * @brief Every edit (what changes between begin() and commit()) is recorded as the pixels it changed: a record of
+ * `count`, then `count` x (16-bit index, previous RGB), then `count` again so the ring can be walked both ways. A click
+ * costs 9 bytes, a full repaint of 32x24 pixels 3.8 KB.
+ *
+ * Undo writes the recorded colours back in reverse order and keeps the colours they replace in the same entries, so
+ * the record becomes its own redo: both are O(changed pixels) and need no extra memory. The oldest edits are dropped
+ * when the arena is full; a new edit drops the ones undone. Canvas changes outside an edit (streams, animations)
+ * make the recorded colours meaningless, so they clear the history.
+ */
+namespace History {
+
+/**
+ * @brief Counters and occupancy, for /info.
+ */
+struct Stats {
+    size_t budget = 0;      ///< Arena size (bytes)
+    size_t used = 0;        ///< Bytes held by records, undone ones included
+    uint16_t undo = 0;      ///< Edits that can be undone
+    uint16_t redo = 0;      ///< Edits that can be redone
+    uint32_t recorded = 0;  ///< Edits recorded since boot
+    uint32_t too_large = 0; ///< Edits larger than the arena, not recorded
+};
+
+class Journal : public Compositor::Recorder {
+  public:
+    /**
+     * @brief Construct the journal and attach it to the canvas.
+     * @param canvas Canvas whose edits are recorded (at most 65536 pixels); must outlive the journal.
+     * @param budget Arena size in bytes; 0 (or no memory for it) disables the history.
+     */
+    Journal(Compositor::Canvas &canvas, size_t budget);
+
+    /**
+     * @brief Record the canvas changes from now on as one edit, until commit(); nothing if already recording.
+     */
+    void begin();
+
+    /**
+     * @brief Close the edit being recorded; an edit that changed nothing is not kept.
+     */
+    void commit();
+
+    /**
+     * @brief Revert the last edit (after committing the one being recorded).
+     * @return false if there is none.
+     */
+    bool undo();
+
+    /**
+     * @brief Apply the last edit undone again.
+     * @return false if there is none.
+     */
+    bool redo();
+
+    /**
+     * @brief Forget every edit.
+     */
+    void clear();
+
+    const Stats &stats() const { return m_stats; }
+
+    void changing(size_t i, const uint8_t rgb[3]) override;
+
+  private:
+    static constexpr size_t COUNT_SIZE = 2;
+    static constexpr size_t ENTRY_SIZE = 5;
+
+    uint8_t &at(uint32_t pos) { return m_arena[pos % m_stats.budget]; }
+    uint16_t read16(uint32_t pos) { return at(pos) | (at(pos + 1) << 8); }
+    void write16(uint32_t pos, uint16_t value);
+
+    /**
+     * @brief Make room for `len` more bytes at m_end by dropping the oldest edits.
+     * @return false if only the edit being recorded could be dropped.
+     */
+    bool reserve(size_t len);
+
+    /**
+     * @brief Swap the canvas colour with the one recorded in the entry at pos.
+     */
+    void swap(uint32_t pos);
+
+    Compositor::Canvas &m_canvas;
+    std::unique_ptr<uint8_t[]> m_arena;
+    // Positions grow forever (the arena index is pos % budget): m_begin <= m_cursor <= m_end
+    uint32_t m_begin = 0;  // First byte of the oldest record
+    uint32_t m_cursor = 0; // End of the last record applied; records after it were undone
+    uint32_t m_end = 0;    // End of the last record
+    uint32_t m_open = 0;   // Start of the record being written
+    uint16_t m_open_count = 0;
+    bool m_recording = false;
+    bool m_overflow = false; // The edit being recorded does not fit
+    bool m_applying = false; // Undo or redo is changing the canvas
+    Stats m_stats;
+};
+
+} // namespace History
+
+#endif /* DRAWMATRIX_HISTORY */
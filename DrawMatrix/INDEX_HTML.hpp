@@ -1 +0,0 @@
-data/index.html
\ No newline at end of file
@@ -0,0 +1,211 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      JitterBuffer.cpp                                                                                         *
+ * @brief     Jitter buffer of compressed, timestamped frames presented on the sender's timeline                       *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#include "JitterBuffer.hpp"
+
+#include <new>
+
+#include "FrameCodec.hpp"
+
+namespace JitterBuffer {
+namespace {
+// Each packet (or decompressed batch) of a frame is encoded on its own: every boundary can cost one control byte more
+// than a whole-frame encode
+constexpr size_t PACKET_SLACK = 32;
+static_assert(ARENA_SIZE <= UINT16_MAX, "slot offsets are 16 bit");
+
+// --------------------------------------------------------------------------------------
+inline bool reached(uint32_t now_ms, uint32_t t_ms) { return static_cast<int32_t>(now_ms - t_ms) >= 0; }
+
+// --------------------------------------------------------------------------------------
+inline int32_t timecode_to_ms(int32_t ticks) {
+    return static_cast<int32_t>((static_cast<int64_t>(ticks) * 1000) >> 16);
+}
+} // namespace
+
+// --------------------------------------------------------------------------------------
+Queue::Queue(size_t n_pixels)
+    : m_n_pixels(n_pixels), m_reserve(FrameCodec::rle_max_size(n_pixels) + PACKET_SLACK) {}
+
+// --------------------------------------------------------------------------------------
+void Queue::write(uint32_t timecode, size_t first, const uint8_t *rgb, size_t count, uint32_t now_ms) {
+    m_last_write_ms = now_ms;
+    if (m_build == Build::NONE || timecode != m_build_timecode) {
+        if (m_build == Build::BUILDING) {
+            m_stats.dropped++; // Never pushed
+        }
+        m_build_timecode = timecode;
+        m_build = Build::FAILED;
+        if (first != 0 || !start_frame()) {
+            m_stats.dropped++; // Its first packet was lost, or no memory
+            return;
+        }
+        m_build = Build::BUILDING;
+        m_build_len = 0;
+        m_build_next = 0;
+    }
+    if (m_build != Build::BUILDING || !count) {
+        return;
+    }
+    size_t len = 0;
+    if (first == m_build_next) {
+        uint8_t *out = m_arena.get() + m_build_offset + m_build_len;
+        len = FrameCodec::rle_encode(rgb, count, out, m_reserve - m_build_len);
+    }
+    if (!len) {
+        // A packet was lost or reordered
+        m_build = Build::FAILED;
+        m_stats.dropped++;
+        return;
+    }
+    m_build_len += len;
+    m_build_next += count;
+}
+
+// --------------------------------------------------------------------------------------
+void Queue::commit(uint32_t timecode, uint32_t now_ms) {
+    const bool complete = m_build == Build::BUILDING && timecode == m_build_timecode;
+    m_build = Build::NONE;
+    if (!complete) {
+        return;
+    }
+
+    uint32_t due_ms = due_time(timecode, now_ms);
+    if (m_count && !reached(due_ms, slot(m_count - 1).due_ms + 1)) {
+        m_stats.dropped++; // Not newer than the last queued frame
+        return;
+    }
+    if (reached(now_ms, due_ms + 1)) {
+        // Arrived after its time: the network delay outgrew the buffer, move the timeline so the frames behind it
+        // are on time again
+        m_anchor_ms += now_ms - due_ms;
+        due_ms = now_ms;
+        m_stats.late++;
+    }
+    Slot &queued = slot(m_count++);
+    queued.due_ms = due_ms;
+    queued.offset = static_cast<uint16_t>(m_build_offset);
+    queued.len = static_cast<uint16_t>(m_build_len);
+    m_stats.queued++;
+}
+
+// --------------------------------------------------------------------------------------
+uint32_t Queue::present_due(uint32_t now_ms, FrameInput::Sink &sink) {
+    // Only the newest of the frames already due is worth showing
+    while (m_count >= 2 && reached(now_ms, slot(1).due_ms)) {
+        pop();
+        m_stats.dropped++;
+    }
+    if (m_count && reached(now_ms, slot(0).due_ms)) {
+        const Slot &frame = slot(0);
+        if (now_ms - frame.due_ms > LATE_TOLERANCE_MS) {
+            m_stats.late++;
+        }
+        FrameCodec::rle_decode_to(m_arena.get() + frame.offset, frame.len, m_n_pixels,
+                                  [&sink](size_t first, const uint8_t *rgb, size_t count) {
+                                      sink.write_pixels(first, rgb, count);
+                                  });
+        sink.present();
+        m_stats.presented++;
+        pop();
+    }
+
+    if (m_count) {
+        const uint32_t wait_ms = slot(0).due_ms - now_ms;
+        return wait_ms < 1 ? 1 : (wait_ms > IDLE_POLL_MS ? IDLE_POLL_MS : wait_ms);
+    }
+    if (m_arena && now_ms - m_last_write_ms > RESYNC_MS) {
+        // The stream stopped: give the memory back, the next one starts a new timeline
+        if (m_build == Build::BUILDING) {
+            m_stats.dropped++; // Never pushed
+        }
+        m_build = Build::NONE;
+        m_arena.reset();
+        m_synced = false;
+    }
+    return IDLE_POLL_MS;
+}
+
+// --------------------------------------------------------------------------------------
+bool Queue::start_frame() {
+    if (!m_arena) {
+        m_arena.reset(new (std::nothrow) uint8_t[ARENA_SIZE]);
+        if (!m_arena) {
+            return false;
+        }
+    }
+    while (!find_space(m_build_offset)) {
+        if (!m_count) {
+            return false;
+        }
+        // Full: the oldest frame makes room for the newest
+        pop();
+        m_stats.dropped++;
+    }
+    return true;
+}
+
+// --------------------------------------------------------------------------------------
+bool Queue::find_space(size_t &offset) const {
+    if (!m_count) {
+        offset = 0;
+        return m_reserve <= ARENA_SIZE;
+    }
+    if (m_count == MAX_FRAMES) {
+        return false;
+    }
+    const size_t start = slot(0).offset;
+    const size_t end = slot(m_count - 1).offset + slot(m_count - 1).len;
+    if (end > start) {
+        // Queued frames are contiguous: room after them, or wrapped around before them
+        if (ARENA_SIZE - end >= m_reserve) {
+            offset = end;
+            return true;
+        }
+        if (start >= m_reserve) {
+            offset = 0;
+            return true;
+        }
+        return false;
+    }
+    // Wrapped: room between the newest and the oldest
+    if (start - end >= m_reserve) {
+        offset = end;
+        return true;
+    }
+    return false;
+}
+
+// --------------------------------------------------------------------------------------
+uint32_t Queue::due_time(uint32_t timecode, uint32_t now_ms) {
+    if (m_synced) {
+        const uint32_t due_ms = m_anchor_ms + timecode_to_ms(static_cast<int32_t>(timecode - m_anchor_timecode));
+        const int32_t ahead_ms = static_cast<int32_t>(due_ms - now_ms);
+        if (ahead_ms > -static_cast<int32_t>(RESYNC_MS) && ahead_ms < static_cast<int32_t>(RESYNC_MS + LATENCY_MS)) {
+            return due_ms;
+        }
+    }
+    // New timeline: what is queued belongs to the old one
+    m_stats.dropped += m_count;
+    m_count = 0;
+    m_synced = true;
+    m_anchor_timecode = timecode;
+    m_anchor_ms = now_ms + LATENCY_MS;
+    return m_anchor_ms;
+}
+
+// --------------------------------------------------------------------------------------
+void Queue::pop() {
+    m_head = (m_head + 1) % MAX_FRAMES;
+    m_count--;
+}
+
+} // namespace JitterBuffer
@@ -0,0 +1,150 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      JitterBuffer.hpp                                                                                         *
+ * @brief     Jitter buffer of compressed, timestamped frames presented on the sender's timeline                       *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#ifndef DRAWMATRIX_JITTERBUFFER
+#define DRAWMATRIX_JITTERBUFFER
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "FrameInput.hpp"
+
+/**
+ * @brief Smooth playback of streamed frames that carry a presentation timestamp.
+ *
+ * Timestamps are DDP timecodes (16.16 fixed-point seconds). The first frame of a stream anchors the sender's timeline
+ * LATENCY_MS in the future; every frame is then shown at its own time, so WiFi jitter up to LATENCY_MS no longer
+ * reaches the display. Frames are RLE compressed (FrameCodec) into one arena as their packets arrive and decoded
+ * straight to the display when due.
+ *
+ * - A frame arriving after its time moves the timeline back by its lateness: the buffer grows to the jitter seen.
+ * - A frame due while a newer one is also due is skipped; a full buffer drops its oldest frame.
+ * - A gap or a jump of RESYNC_MS in the timeline (sender restarted, long outage) starts over with a new anchor.
+ */
+namespace JitterBuffer {
+
+// Delay between a frame's arrival and its presentation at the start of a stream
+constexpr uint32_t LATENCY_MS = 100;
+// Presented later than this after its time, a frame counts as late
+constexpr uint32_t LATE_TOLERANCE_MS = 15;
+// Timeline gap or jump that restarts the stream
+constexpr uint32_t RESYNC_MS = 1000;
+// How often to look for frames when none is queued
+constexpr uint32_t IDLE_POLL_MS = 20;
+// Frames queued at most
+constexpr size_t MAX_FRAMES = 8;
+// Compressed frames queued at most, in bytes (allocated while a stream plays)
+constexpr size_t ARENA_SIZE = 12288;
+
+/**
+ * @brief Counters since boot, for /info.
+ */
+struct Stats {
+    uint32_t queued = 0;    ///< Frames received complete and queued
+    uint32_t presented = 0; ///< Frames shown
+    uint32_t late = 0;      ///< Frames that arrived or were shown after their time
+    uint32_t dropped = 0;   ///< Frames never shown: incomplete, out of order, skipped or overflowed
+};
+
+/**
+ * @brief Frames waiting for their presentation time.
+ */
+class Queue {
+  public:
+    /**
+     * @brief Construct the queue.
+     * @param n_pixels Pixels per frame.
+     */
+    explicit Queue(size_t n_pixels);
+
+    /**
+     * @brief Add pixels of the frame with the given timecode; a new timecode starts a new frame.
+     * @param timecode Presentation timestamp of the frame.
+     * @param first Logical index of the first pixel; pixels must arrive in order.
+     * @param rgb Pixels, 3 bytes each.
+     * @param count Number of pixels.
+     * @param now_ms Current millis().
+     */
+    void write(uint32_t timecode, size_t first, const uint8_t *rgb, size_t count, uint32_t now_ms);
+
+    /**
+     * @brief The frame with the given timecode is complete: queue it for its presentation time.
+     */
+    void commit(uint32_t timecode, uint32_t now_ms);
+
+    /**
+     * @brief Write the frame due now (if any) to the sink and present it; call from the scheduler.
+     * @return Milliseconds until the next frame is due.
+     */
+    uint32_t present_due(uint32_t now_ms, FrameInput::Sink &sink);
+
+    /**
+     * @brief Frames currently queued.
+     */
+    size_t depth() const { return m_count; }
+
+    /**
+     * @brief Counters since boot.
+     */
+    const Stats &stats() const { return m_stats; }
+
+  private:
+    struct Slot {
+        uint32_t due_ms; ///< millis() at which to present
+        uint16_t offset; ///< Compressed frame in the arena
+        uint16_t len;
+    };
+
+    enum class Build : uint8_t { NONE, BUILDING, FAILED };
+
+    /**
+     * @brief Reserve arena space for a new frame, dropping the oldest frames if needed.
+     */
+    bool start_frame();
+
+    /**
+     * @brief Arena offset with room for a whole frame after the queued ones, if any.
+     */
+    bool find_space(size_t &offset) const;
+
+    /**
+     * @brief Presentation time of a timecode, anchoring a new timeline when it does not fit the current one.
+     */
+    uint32_t due_time(uint32_t timecode, uint32_t now_ms);
+
+    Slot &slot(size_t i) { return m_slots[(m_head + i) % MAX_FRAMES]; }
+    const Slot &slot(size_t i) const { return m_slots[(m_head + i) % MAX_FRAMES]; }
+    void pop();
+
+    size_t m_n_pixels;
+    size_t m_reserve; // Worst-case compressed frame
+    std::unique_ptr<uint8_t[]> m_arena;
+    Slot m_slots[MAX_FRAMES];
+    size_t m_head = 0;
+    size_t m_count = 0;
+
+    Build m_build = Build::NONE;
+    uint32_t m_build_timecode = 0;
+    size_t m_build_offset = 0;
+    size_t m_build_len = 0;
+    size_t m_build_next = 0; // Next pixel expected
+
+    bool m_synced = false;       // A timeline is anchored
+    uint32_t m_anchor_timecode = 0;
+    uint32_t m_anchor_ms = 0;    // When the anchor timecode is due
+    uint32_t m_last_write_ms = 0;
+    Stats m_stats;
+};
+
+} // namespace JitterBuffer
+
+#endif /* DRAWMATRIX_JITTERBUFFER */
@@ -1 +0,0 @@
-data/music.html
\ No newline at end of file
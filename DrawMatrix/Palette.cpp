@@ -0,0 +1,56 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      Palette.cpp                                                                                              *
+ * @brief     Indexed-colour frame: one byte per pixel into a 256-colour palette                                       *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#include "Palette.hpp"
+
+#include <cstring>
+#include <new>
+
+namespace Palette {
+
+// --------------------------------------------------------------------------------------
+IndexedFrame::IndexedFrame(size_t n_pixels) : m_n_pixels(n_pixels) {}
+
+// --------------------------------------------------------------------------------------
+bool IndexedFrame::begin() {
+    if (active()) {
+        return true;
+    }
+    const size_t size = N_COLORS * 3 + m_n_pixels;
+    m_data.reset(new (std::nothrow) uint8_t[size]);
+    if (!m_data) {
+        return false;
+    }
+    memset(m_data.get(), 0, size);
+    return true;
+}
+
+// --------------------------------------------------------------------------------------
+void IndexedFrame::rotate(uint8_t first, size_t count, bool reverse) {
+    count = count < N_COLORS - first ? count : N_COLORS - first;
+    if (count < 2) {
+        return;
+    }
+    uint8_t *range = colors() + first * 3;
+    const size_t last = (count - 1) * 3;
+    uint8_t saved[3];
+    if (reverse) {
+        memcpy(saved, range, 3);
+        memmove(range, range + 3, last);
+        memcpy(range + last, saved, 3);
+    } else {
+        memcpy(saved, range + last, 3);
+        memmove(range + 3, range, last);
+        memcpy(range, saved, 3);
+    }
+}
+
+} // namespace Palette
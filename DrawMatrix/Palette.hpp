@@ -0,0 +1,107 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      Palette.hpp                                                                                              *
+ * @brief     Indexed-colour frame: one byte per pixel into a 256-colour palette                                       *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#ifndef DRAWMATRIX_PALETTE
+#define DRAWMATRIX_PALETTE
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/**
+ * @brief Indexed-colour mode for content made of a handful of colours (signage, pixel art).
+ *
+ * The frame is an index plane (one byte per logical pixel, row-major) plus a palette of N_COLORS RGB entries; it is
+ * expanded to the strip only when shown. Recolouring or palette cycling rewrites the palette and re-expands, never
+ * the plane. Upload body (Content-Type CONTENT_TYPE), all optional parts back to back:
+ *
+ *     uint16 LE  colors         palette entries that follow (0..N_COLORS)
+ *     colors * 3 RGB            palette entries 0 .. colors-1; the others keep their value
+ *     n_pixels   indices        the index plane; left out, the current plane is recoloured
+ */
+namespace Palette {
+
+// Palette entries
+constexpr size_t N_COLORS = 256;
+// Content-Type of indexed frame uploads
+constexpr const char *CONTENT_TYPE = "application/x-indexed";
+// Bytes before the palette entries in an upload
+constexpr size_t HEADER_SIZE = 2;
+
+/**
+ * @brief Index plane and palette, allocated together while indexed mode is in use.
+ */
+class IndexedFrame {
+  public:
+    /**
+     * @brief Construct the frame; nothing is allocated yet.
+     * @param n_pixels Pixels in the display.
+     */
+    explicit IndexedFrame(size_t n_pixels);
+
+    /**
+     * @brief Enter indexed mode: allocate a black plane and palette, unless already active.
+     * @return false when out of memory.
+     */
+    bool begin();
+
+    /**
+     * @brief Leave indexed mode (the display got RGB content) and free the memory.
+     */
+    void end() { m_data.reset(); }
+
+    /**
+     * @brief Whether indexed mode is active.
+     */
+    bool active() const { return m_data != nullptr; }
+
+    /**
+     * @brief Pixels in the plane.
+     */
+    size_t size() const { return m_n_pixels; }
+
+    /**
+     * @brief The index plane, logical row-major; only while active.
+     */
+    uint8_t *indices() { return m_data.get() + N_COLORS * 3; }
+
+    /**
+     * @brief The palette, N_COLORS RGB entries back to back; only while active.
+     */
+    uint8_t *colors() { return m_data.get(); }
+
+    /**
+     * @brief Rotate a palette range by one entry (palette cycling); only while active.
+     * @param first First entry of the range.
+     * @param count Entries in the range, clipped to the palette.
+     * @param reverse Rotate towards lower entries instead.
+     */
+    void rotate(uint8_t first, size_t count, bool reverse);
+
+    /**
+     * @brief Hand every pixel to `write(i, rgb)` in logical order; only while active.
+     */
+    template <typename Write> void expand(Write &&write) {
+        const uint8_t *palette = colors();
+        const uint8_t *index = indices();
+        for (size_t i = 0; i < m_n_pixels; i++) {
+            write(i, palette + index[i] * 3);
+        }
+    }
+
+  private:
+    size_t m_n_pixels;
+    std::unique_ptr<uint8_t[]> m_data; // Palette, then index plane
+};
+
+} // namespace Palette
+
+#endif /* DRAWMATRIX_PALETTE */
@@ -0,0 +1,119 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      Qoi.cpp                                                                                                  *
+ * @brief     Incremental QOI ("Quite OK Image") decoder                                                               *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#include "Qoi.hpp"
+
+#include <cstring>
+
+namespace Qoi {
+namespace {
+constexpr uint8_t OP_INDEX = 0x00; // 00xxxxxx
+constexpr uint8_t OP_DIFF = 0x40;  // 01xxxxxx
+constexpr uint8_t OP_LUMA = 0x80;  // 10xxxxxx
+constexpr uint8_t OP_RUN = 0xC0;   // 11xxxxxx
+constexpr uint8_t OP_RGB = 0xFE;
+constexpr uint8_t OP_RGBA = 0xFF;
+constexpr uint8_t MASK_2 = 0xC0;
+
+// --------------------------------------------------------------------------------------
+inline uint32_t be32(const uint8_t *p) {
+    return (static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16) | (p[2] << 8) | p[3];
+}
+
+// --------------------------------------------------------------------------------------
+inline uint8_t op_size(uint8_t op) {
+    if (op == OP_RGB) {
+        return 4;
+    }
+    if (op == OP_RGBA) {
+        return 5;
+    }
+    return (op & MASK_2) == OP_LUMA ? 2 : 1;
+}
+} // namespace
+
+// --------------------------------------------------------------------------------------
+const char *check_header(const uint8_t *data, size_t len, uint16_t width, uint16_t height) {
+    if (len < HEADER_SIZE || memcmp(data, "qoif", 4) != 0) {
+        return "Not a QOI image";
+    }
+    const uint32_t image_width = be32(data + 4);
+    const uint32_t image_height = be32(data + 8);
+    if (!image_width || !image_height || image_width > width || image_height > height) {
+        return "Image is larger than the display";
+    }
+    if (data[12] != 3 && data[12] != 4) {
+        return "QOI image has an invalid channel count";
+    }
+    return nullptr;
+}
+
+// --------------------------------------------------------------------------------------
+void Decoder::reset() {
+    memset(m_cache, 0, sizeof(m_cache));
+    m_px[0] = m_px[1] = m_px[2] = 0;
+    m_px[3] = 255;
+    m_op_have = 0;
+    m_header_have = 0;
+    m_width = m_height = 0;
+    m_n_pixels = 0;
+    m_pixel = 0;
+    m_error = nullptr;
+}
+
+// --------------------------------------------------------------------------------------
+uint8_t Decoder::push(uint8_t byte) {
+    if (m_header_have < HEADER_SIZE) {
+        m_header[m_header_have++] = byte;
+        if (m_header_have == HEADER_SIZE) {
+            // Callers check the size against theirs; this only guards the pixel counter
+            if (memcmp(m_header, "qoif", 4) != 0 || be32(m_header + 4) > 0xFFFF || be32(m_header + 8) > 0xFFFF) {
+                m_error = "Not a QOI image";
+                return 0;
+            }
+            m_width = static_cast<uint16_t>(be32(m_header + 4));
+            m_height = static_cast<uint16_t>(be32(m_header + 8));
+            m_n_pixels = static_cast<size_t>(m_width) * m_height;
+        }
+        return 0;
+    }
+
+    m_op[m_op_have++] = byte;
+    if (m_op_have < op_size(m_op[0])) {
+        return 0;
+    }
+    m_op_have = 0;
+
+    const uint8_t op = m_op[0];
+    uint8_t count = 1;
+    if (op == OP_RGB) {
+        memcpy(m_px, m_op + 1, 3);
+    } else if (op == OP_RGBA) {
+        memcpy(m_px, m_op + 1, 4);
+    } else if ((op & MASK_2) == OP_INDEX) {
+        memcpy(m_px, m_cache[op & 0x3F], 4);
+    } else if ((op & MASK_2) == OP_DIFF) {
+        m_px[0] += ((op >> 4) & 0x03) - 2;
+        m_px[1] += ((op >> 2) & 0x03) - 2;
+        m_px[2] += (op & 0x03) - 2;
+    } else if ((op & MASK_2) == OP_LUMA) {
+        const int dg = (op & 0x3F) - 32;
+        m_px[0] += dg + ((m_op[1] >> 4) & 0x0F) - 8;
+        m_px[1] += dg;
+        m_px[2] += dg + (m_op[1] & 0x0F) - 8;
+    } else {
+        count = (op & 0x3F) + 1; // OP_RUN: the previous pixel again
+    }
+    memcpy(m_cache[(m_px[0] * 3 + m_px[1] * 5 + m_px[2] * 7 + m_px[3] * 11) % 64], m_px, 4);
+    return count;
+}
+
+} // namespace Qoi
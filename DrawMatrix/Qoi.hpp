@@ -0,0 +1,100 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      Qoi.hpp                                                                                                  *
+ * @brief     Incremental QOI ("Quite OK Image") decoder                                                               *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#ifndef DRAWMATRIX_QOI
+#define DRAWMATRIX_QOI
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief QOI images (https://qoiformat.org): a 14-byte header, then one pass of byte-aligned ops against the previous
+ * pixel and a 64-entry cache of recent colours. All the decoder keeps is that cache, so a body can be decoded chunk by
+ * chunk as it arrives; ops split across chunks are completed with the next one.
+ */
+namespace Qoi {
+
+// Content-Type of QOI bodies
+constexpr const char *CONTENT_TYPE = "image/qoi";
+// Bytes of the header
+constexpr size_t HEADER_SIZE = 14;
+
+/**
+ * @brief Check the start of a QOI image.
+ * @param data First bytes of the image.
+ * @param len Length of data; must cover the header.
+ * @param width Largest width accepted.
+ * @param height Largest height accepted.
+ * @return nullptr if acceptable, otherwise why not.
+ */
+const char *check_header(const uint8_t *data, size_t len, uint16_t width, uint16_t height);
+
+/**
+ * @brief Byte-oriented decoder; input can be fed in pieces of any size.
+ */
+class Decoder {
+  public:
+    /**
+     * @brief Expect a new image, header first.
+     */
+    void reset();
+
+    /**
+     * @brief Decode the next bytes, handing each pixel over as `write(x, y, rgba)`.
+     * @return Bytes consumed: all of them, unless the image is complete (the end marker is not needed) or invalid.
+     */
+    template <typename Write> size_t feed(const uint8_t *in, size_t len, Write &&write) {
+        size_t i = 0;
+        for (; i < len && !m_error && !done(); i++) {
+            for (uint8_t n = push(in[i]); n && !done(); n--, m_pixel++) {
+                write(static_cast<uint16_t>(m_pixel % m_width), static_cast<uint16_t>(m_pixel / m_width),
+                      static_cast<const uint8_t *>(m_px));
+            }
+        }
+        return i;
+    }
+
+    /**
+     * @brief Whether every pixel was decoded.
+     */
+    bool done() const { return m_header_have == HEADER_SIZE && m_pixel == m_n_pixels; }
+
+    /**
+     * @brief Why the image is invalid, nullptr while fine.
+     */
+    const char *error() const { return m_error; }
+
+    uint16_t width() const { return m_width; }
+    uint16_t height() const { return m_height; }
+
+  private:
+    /**
+     * @brief Take one byte.
+     * @return Number of times m_px is to be output: 0 while in the header or in an op, up to 62 for a run.
+     */
+    uint8_t push(uint8_t byte);
+
+    uint8_t m_cache[64][4];
+    uint8_t m_px[4];   // Previous pixel, RGBA
+    uint8_t m_op[5];   // Op being received
+    uint8_t m_op_have = 0;
+    uint8_t m_header[HEADER_SIZE];
+    size_t m_header_have = 0;
+    uint16_t m_width = 0;
+    uint16_t m_height = 0;
+    size_t m_n_pixels = 0;
+    size_t m_pixel = 0; // Pixels output
+    const char *m_error = nullptr;
+};
+
+} // namespace Qoi
+
+#endif /* DRAWMATRIX_QOI */
@@ -0,0 +1,71 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      Router.cpp                                                                                               *
+ * @brief     Single web handler dispatching the app's API through a compile-time sorted route table                   *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#include "Router.hpp"
+
+#include <cstring>
+
+namespace Router {
+
+// --------------------------------------------------------------------------------------
+const Route *Dispatcher::find(AsyncWebServerRequest *request) const {
+    const char *path = request->url().c_str();
+    size_t lo = 0;
+    size_t hi = m_n_routes;
+    while (lo < hi) {
+        const size_t mid = (lo + hi) / 2;
+        const int cmp = strcmp(path, m_routes[mid].path);
+        if (cmp == 0) {
+            return (m_routes[mid].methods & request->method()) ? &m_routes[mid] : nullptr;
+        }
+        if (cmp < 0) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return nullptr;
+}
+
+// --------------------------------------------------------------------------------------
+bool Dispatcher::canHandle(AsyncWebServerRequest *request) {
+    if (!find(request)) {
+        return false;
+    }
+    // Handlers may look at any header (e.g. If-None-Match), keep them all like the callback handlers do
+    request->addInterestingHeader("ANY");
+    return true;
+}
+
+// --------------------------------------------------------------------------------------
+void Dispatcher::handleRequest(AsyncWebServerRequest *request) {
+    const Route *route = find(request);
+    if (!route) {
+        request->send(500);
+        return;
+    }
+    if (m_on_activity) {
+        m_on_activity(route->activity);
+    }
+    if (route->on_request) {
+        route->on_request(request);
+    }
+}
+
+// --------------------------------------------------------------------------------------
+void Dispatcher::handleBody(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+    const Route *route = find(request);
+    if (route && route->on_body) {
+        route->on_body(request, data, len, index, total);
+    }
+}
+
+} // namespace Router
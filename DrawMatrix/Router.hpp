@@ -0,0 +1,100 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      Router.hpp                                                                                               *
+ * @brief     Single web handler dispatching the app's API through a compile-time sorted route table                   *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#ifndef DRAWMATRIX_ROUTER
+#define DRAWMATRIX_ROUTER
+
+#include <ESPAsyncWebServer.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Router {
+
+/**
+ * @brief What a request to a route counts as for the idle/clock-mode logic.
+ */
+enum class Activity : uint8_t {
+    CLIENT,  ///< Someone is using the UI
+    DISPLAY, ///< Someone is drawing: keeps the clock off
+};
+
+/**
+ * @brief One API route. Tables of routes must be sorted by path (checked with is_sorted()).
+ */
+struct Route {
+    const char *path;                   ///< Exact path (no wildcards)
+    WebRequestMethodComposite methods;  ///< Accepted methods (e.g. HTTP_ANY, HTTP_POST)
+    Activity activity;                  ///< Reported once the request is complete
+    void (*on_request)(AsyncWebServerRequest *request); ///< Called once the request is complete, may be null
+    void (*on_body)(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index,
+                    size_t total); ///< Called for each body chunk, may be null
+};
+
+/**
+ * @brief Compare two paths like strcmp(), usable at compile time.
+ */
+constexpr int compare(const char *a, const char *b) {
+    while (*a && *a == *b) {
+        a++;
+        b++;
+    }
+    return static_cast<unsigned char>(*a) - static_cast<unsigned char>(*b);
+}
+
+/**
+ * @brief Whether a route table is strictly sorted by path (no duplicates), as the dispatcher's lookup requires.
+ */
+template <size_t N> constexpr bool is_sorted(const Route (&routes)[N]) {
+    for (size_t i = 1; i < N; i++) {
+        if (compare(routes[i - 1].path, routes[i].path) >= 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Web handler serving every route of a table.
+ *
+ * Replaces one AsyncCallbackWebHandler per route: the server asks a single handler, which finds the route with a
+ * binary search over the sorted table, so routing stays O(log n) without per-route String copies.
+ */
+class Dispatcher : public AsyncWebHandler {
+  public:
+    /**
+     * @brief Construct the dispatcher.
+     * @param routes Route table, sorted by path; must outlive the dispatcher.
+     * @param on_activity Called with the route's activity when a request completes.
+     */
+    template <size_t N>
+    Dispatcher(const Route (&routes)[N], void (*on_activity)(Activity))
+        : m_routes(routes), m_n_routes(N), m_on_activity(on_activity) {}
+
+    bool canHandle(AsyncWebServerRequest *request) override;
+    void handleRequest(AsyncWebServerRequest *request) override;
+    void handleBody(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) override;
+    bool isRequestHandlerTrivial() override { return false; }
+
+  private:
+    /**
+     * @brief Route for the request's path and method, nullptr if none.
+     */
+    const Route *find(AsyncWebServerRequest *request) const;
+
+    const Route *m_routes;
+    size_t m_n_routes;
+    void (*m_on_activity)(Activity);
+};
+
+} // namespace Router
+
+#endif /* DRAWMATRIX_ROUTER */
@@ -0,0 +1,68 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      RtcState.cpp                                                                                             *
+ * @brief     Display/time checkpoint kept in RTC user memory so warm restarts recover instantly                       *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#include "RtcState.hpp"
+
+#include <Arduino.h>
+#include <coredecls.h> // crc32
+
+namespace RtcState {
+namespace {
+constexpr uint32_t MAGIC = 0x444D5232; // "DMR2": the frame is the canvas, no longer the strip buffer
+// Header words (magic, crc) precede the snapshot fields
+constexpr size_t PREFIX_SIZE = 2 * sizeof(uint32_t);
+constexpr size_t SNAPSHOT_HEADER_SIZE = HEADER_SIZE - PREFIX_SIZE;
+
+static_assert(offsetof(Snapshot, frame) == SNAPSHOT_HEADER_SIZE, "Snapshot header layout changed");
+static_assert(sizeof(Snapshot) == CAPACITY - PREFIX_SIZE, "Snapshot must fill the RTC area exactly");
+static_assert(FRAME_CAPACITY % 4 == 0, "RTC memory is accessed in 4-byte blocks");
+
+// --------------------------------------------------------------------------------------
+inline size_t padded_frame_len(uint16_t frame_len) { return (static_cast<size_t>(frame_len) + 3) & ~size_t(3); }
+
+// --------------------------------------------------------------------------------------
+uint32_t snapshot_crc(const Snapshot &snapshot) {
+    return crc32(&snapshot, SNAPSHOT_HEADER_SIZE + snapshot.frame_len);
+}
+} // namespace
+
+// --------------------------------------------------------------------------------------
+bool warm_boot() { return ESP.getResetInfoPtr()->reason != REASON_DEFAULT_RST; }
+
+// --------------------------------------------------------------------------------------
+bool load(Snapshot &snapshot) {
+    uint32_t prefix[2];
+    if (!ESP.rtcUserMemoryRead(FIRST_BLOCK, prefix, sizeof(prefix)) || prefix[0] != MAGIC) {
+        return false;
+    }
+    auto *words = reinterpret_cast<uint32_t *>(&snapshot);
+    const uint32_t block = FIRST_BLOCK + PREFIX_SIZE / 4;
+    if (!ESP.rtcUserMemoryRead(block, words, SNAPSHOT_HEADER_SIZE) || snapshot.frame_len > FRAME_CAPACITY) {
+        return false;
+    }
+    if (snapshot.frame_len &&
+        !ESP.rtcUserMemoryRead(block + SNAPSHOT_HEADER_SIZE / 4, reinterpret_cast<uint32_t *>(snapshot.frame),
+                               padded_frame_len(snapshot.frame_len))) {
+        return false;
+    }
+    return snapshot_crc(snapshot) == prefix[1];
+}
+
+// --------------------------------------------------------------------------------------
+void store(const Snapshot &snapshot) {
+    uint32_t prefix[2] = {MAGIC, snapshot_crc(snapshot)};
+    auto *words = reinterpret_cast<uint32_t *>(const_cast<Snapshot *>(&snapshot));
+    ESP.rtcUserMemoryWrite(FIRST_BLOCK + PREFIX_SIZE / 4, words, SNAPSHOT_HEADER_SIZE + padded_frame_len(snapshot.frame_len));
+    // Header last: a reset half-way through leaves a CRC mismatch rather than a torn frame being trusted
+    ESP.rtcUserMemoryWrite(FIRST_BLOCK, prefix, sizeof(prefix));
+}
+
+} // namespace RtcState
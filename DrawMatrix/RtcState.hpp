@@ -0,0 +1,67 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      RtcState.hpp                                                                                             *
+ * @brief     Display/time checkpoint kept in RTC user memory so warm restarts recover instantly                       *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#ifndef DRAWMATRIX_RTCSTATE
+#define DRAWMATRIX_RTCSTATE
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Checkpoint of the volatile display state in RTC user memory.
+ *
+ * RTC user memory survives soft resets, watchdog resets and exceptions (not power loss), so it is the fastest
+ * place to recover from: no flash mount and no network needed. The first 128 bytes are left to the OTA
+ * bootloader command, leaving 384 bytes for us; the frame is stored run-length coded and dropped when it does not
+ * fit.
+ */
+namespace RtcState {
+
+// First RTC user memory block (4 bytes each) we own; blocks before it belong to eboot (OTA)
+constexpr uint32_t FIRST_BLOCK = 32;
+// Bytes of RTC user memory we own
+constexpr size_t CAPACITY = 512 - FIRST_BLOCK * 4;
+// Fixed part of the record: magic, crc, epoch, frame length, brightness, flags
+constexpr size_t HEADER_SIZE = 16;
+// Room left for the run-length coded frame
+constexpr size_t FRAME_CAPACITY = CAPACITY - HEADER_SIZE;
+
+/**
+ * @brief State worth restoring after a warm reset.
+ */
+struct Snapshot {
+    uint32_t epoch = 0;            ///< Local epoch (s) when the checkpoint was taken, 0 if time was unknown
+    uint16_t frame_len = 0;        ///< Length of the coded frame, 0 when no frame is stored
+    uint8_t brightness = 0;        ///< Strip brightness (0-255)
+    bool clock_mode = false;       ///< Whether the clock was showing
+    uint8_t frame[FRAME_CAPACITY]; ///< FrameCodec RLE of the canvas (logical order, before brightness)
+};
+
+/**
+ * @brief Whether the last reset kept RTC memory (anything but power-on).
+ */
+bool warm_boot();
+
+/**
+ * @brief Read and validate the checkpoint.
+ * @param snapshot Filled on success.
+ * @return true if a checkpoint with a valid CRC was found.
+ */
+bool load(Snapshot &snapshot);
+
+/**
+ * @brief Write the checkpoint (only the used part of the frame is written).
+ */
+void store(const Snapshot &snapshot);
+
+} // namespace RtcState
+
+#endif /* DRAWMATRIX_RTCSTATE */
@@ -15,17 +15,25 @@
 #include "Arduino.h"
 #include <LittleFS.h>
 
-#include "ALARM_HTML.hpp"
-#include "DRAW_HTML.hpp"
-#include "MUSIC_HTML.hpp"
-#include "INDEX_HTML.hpp"
+#include "WebAssets.hpp"
 
 #include "AsyncTasker.hpp"
+#include "FrameCodec.hpp"
 
 namespace {
 using namespace std::placeholders;
 constexpr int ws2812_pin = D2;
 constexpr uint8_t MIN_BRIGHTNESS = 6; // Minimum brightness level (0-255)
+constexpr uint32_t CHECKPOINT_PERIOD_MS = 1000; // How often display state and time are copied to RTC memory
+constexpr uint32_t SECONDS_PER_DAY = 86400;
+constexpr const char *MIRROR_PATH = "/mirror"; // WebSocket of the live display mirror
+constexpr uint32_t MIRROR_PERIOD_MS = 100;     // Mirror frame rate cap; unchanged frames cost one compare
+constexpr const char *FRAMES_PATH = "/frames"; // WebSocket frame input
+constexpr uint32_t PALETTE_IDLE_MS = 250;      // How often to check for palette cycling while it is off
+constexpr uint32_t PALETTE_MIN_PERIOD_MS = 20; // Fastest palette cycling; writing the strip takes about as long
+constexpr uint32_t EFFECT_BENCHMARK_SLICE_MS = 1; // One benchmark frame per slice, so loop() runs in between
+constexpr uint8_t EFFECT_BENCHMARK_MAX_FRAMES = 100;
+constexpr size_t EFFECT_BENCHMARK_STEPS = Effects::N_KINDS + 2; // The effects, then hsv_to_rgb and ColorHSV
 File alarms_file;
 
 /**
@@ -49,19 +57,47 @@ bool collectBodyData(uint8_t *data, size_t len, size_t index, size_t total, Stri
     // Return true only when we have received all data
     return (index + len == total);
 }
+
+/**
+ * @brief Send a precompressed page, or 304 when the client already holds this version
+ */
+void send_asset(AsyncWebServerRequest *request, const WebAssets::Asset &asset) {
+    AsyncWebServerResponse *response;
+    const AsyncWebHeader *if_none_match = request->getHeader("If-None-Match");
+    if (if_none_match && if_none_match->value().indexOf(asset.etag) >= 0) {
+        response = request->beginResponse(304);
+    } else {
+        response = request->beginResponse_P(200, asset.content_type, asset.gz, asset.gz_len);
+        response->addHeader("Content-Encoding", "gzip");
+    }
+    response->addHeader("ETag", asset.etag);
+    response->addHeader("Cache-Control", WebAssets::CACHE_CONTROL);
+    request->send(response);
+}
 }
 
 namespace ServerSys {
 // --------------------------------------------------------------------------------------
 App::App(const NTPClient &ntp, std::function<void()> alarm_callback)
     : m_status_led_state(true), task_draw_matrix(), task_heart_beat_blink(m_status_led_state),
-      m_ntp(ntp), m_alarm_callback(alarm_callback) {
+      m_ntp(ntp), m_alarm_callback(alarm_callback), m_autosave(task_draw_matrix.scene.canvas),
+      m_gallery(N_COLS, N_ROWS), m_mirror(MIRROR_PATH, N_PIXELS), m_frame_input(*this, N_PIXELS),
+      m_jitter_buffer(N_PIXELS), m_frame_socket(FRAMES_PATH, *this, N_PIXELS),
+      m_draw_commands(task_draw_matrix.scene.canvas), m_socket_commands(task_draw_matrix.scene.canvas) {
+    // Before anything slow (flash mount, network): a crash should cost milliseconds of blank display, not seconds
+    restore_checkpoint();
 
     if (!LittleFS.begin()) {
         Serial.println("Failed to mount LittleFS");
     }
     else {
         Serial.println("LittleFS mounted successfully");
+        // Cold boot: RTC memory had no frame, the flash copy survived the power cut
+        if (!m_checkpoint.frame_len && m_autosave.restore()) {
+            task_draw_matrix.refresh();
+            Serial.printf("Restored the saved canvas in %u us\n", m_autosave.stats().restore_us);
+        }
+        m_gallery.begin();
         if(LittleFS.exists("/alarms.bin")) {
             alarms_file = LittleFS.open("/alarms.bin", "r");
             if (alarms_file) {
@@ -103,32 +139,44 @@ App::App(const NTPClient &ntp, std::function<void()> alarm_callback)
             if (!m_clock_mode)
                 return;
 
-            task_draw_matrix.matrix.setBrightness(MIN_BRIGHTNESS); // Set brightness to 6 (0-255)
+            if (task_draw_matrix.matrix.getBrightness() != MIN_BRIGHTNESS) {
+                task_draw_matrix.set_brightness(MIN_BRIGHTNESS); // Set brightness to 6 (0-255)
+            }
 
+            // Drawn on its own layer: the picture underneath stays, and only the digits are recomposited
+            auto &clock = task_draw_matrix.scene.clock;
+            if (!clock.active()) {
+                task_draw_matrix.transition_to(m_transition_kind, m_transition_ms, false);
+            }
+            if (!clock.begin()) {
+                return;
+            }
             static uint8_t h_pos_x = 0;
             static uint8_t m_pos_x = 4;
             static uint8_t s_pos_x = 8;
             static uint8_t cnt = 0;
-            task_draw_matrix.matrix.setTextWrap(false);
-            task_draw_matrix.matrix.fillScreen(Adafruit_NeoMatrix::Color(0, 0, 0));
-
-            task_draw_matrix.matrix.setCursor(h_pos_x, 0);
-            task_draw_matrix.matrix.setTextColor(Adafruit_NeoMatrix::Color(120, 0, 0));
-            task_draw_matrix.matrix.printf("%.2u", m_ntp.getHours());
-
-            task_draw_matrix.matrix.setCursor(m_pos_x, 7);
-            task_draw_matrix.matrix.setTextColor(Adafruit_NeoMatrix::Color(0, 120, 0));
-            task_draw_matrix.matrix.printf("%.2u", m_ntp.getMinutes());
-
-            cnt = m_ntp.getSeconds();
-            task_draw_matrix.matrix.setCursor(s_pos_x, 14);
-            task_draw_matrix.matrix.setTextColor(Adafruit_NeoMatrix::Color(0, 0, 200));
-            task_draw_matrix.matrix.printf("%.2u", cnt);
-            AsyncTasker::schedule(100, [&](uint64_t t, uint64_t &d, bool &repeat) {
-                task_draw_matrix.matrix.setCursor(s_pos_x, 14);
-                task_draw_matrix.matrix.setTextColor(Adafruit_NeoMatrix::Color(0, 0, 120));
-                task_draw_matrix.matrix.printf("%.2u ", cnt);
-                task_draw_matrix.matrix.show();
+            const uint32_t now = local_epoch();
+            clock.setTextWrap(false);
+            clock.fillScreen(Compositor::Layer::TRANSPARENT);
+
+            clock.setCursor(h_pos_x, 0);
+            clock.setTextColor(Adafruit_NeoMatrix::Color(120, 0, 0));
+            clock.printf("%.2u", (now % SECONDS_PER_DAY) / 3600);
+
+            clock.setCursor(m_pos_x, 7);
+            clock.setTextColor(Adafruit_NeoMatrix::Color(0, 120, 0));
+            clock.printf("%.2u", (now % 3600) / 60);
+
+            cnt = now % 60;
+            clock.setCursor(s_pos_x, 14);
+            clock.setTextColor(Adafruit_NeoMatrix::Color(0, 0, 200));
+            clock.printf("%.2u", cnt);
+            AsyncTasker::schedule(100, [this](uint64_t t, uint64_t &d, bool &repeat) {
+                auto &clock = task_draw_matrix.scene.clock;
+                clock.setCursor(s_pos_x, 14);
+                clock.setTextColor(Adafruit_NeoMatrix::Color(0, 0, 120));
+                clock.printf("%.2u ", cnt);
+                task_draw_matrix.refresh();
                 (++s_pos_x) > (N_COLS - 11) ? (s_pos_x = 0) : s_pos_x;
             });
 
@@ -153,16 +201,20 @@ App::App(const NTPClient &ntp, std::function<void()> alarm_callback)
             //     task_draw_matrix.matrix.show();
             // });
 
-            task_draw_matrix.matrix.show();
+            task_draw_matrix.refresh();
             // Serial.printf("NTP time: %s\n", m_ntp.getFormattedTime().c_str());
         },
         true);
     // AsyncTasker::schedule(1, std::bind(&DrawMatrix::execute, &task_draw_matrix, _1, _2, _3), true);
     AsyncTasker::schedule(10000, [this](uint64_t t, uint64_t &d, bool &repeat) {
-        String current_time = m_ntp.getFormattedTime().substring(0, 5);
-        int current_day = m_ntp.getDay(); // 0 = Sunday, 1 = Monday, ..., 6 = Saturday
+        const uint32_t now = local_epoch();
+        char current_time[6];
+        snprintf(current_time, sizeof(current_time), "%02u:%02u", static_cast<unsigned>((now % SECONDS_PER_DAY) / 3600),
+                 static_cast<unsigned>((now % 3600) / 60));
+        // 0 = Sunday, 1 = Monday, ..., 6 = Saturday (1970-01-01 was a Thursday)
+        int current_day = ((now / SECONDS_PER_DAY) + 4) % 7;
         
-        Serial.printf("Checking alarms at NTP time: %s (day: %d)\n", current_time.c_str(), current_day);
+        Serial.printf("Checking alarms at NTP time: %s (day: %d)\n", current_time, current_day);
         
         for (const auto &alarm : m_alarms) {
             if (alarm.time == current_time && alarm.isActiveOnDay(current_day)) {
@@ -175,37 +227,163 @@ App::App(const NTPClient &ntp, std::function<void()> alarm_callback)
             }
         }
     }, true);
+    AsyncTasker::schedule(CHECKPOINT_PERIOD_MS, [this](uint64_t t, uint64_t &d, bool &repeat) {
+        checkpoint();
+        m_autosave.poll(task_draw_matrix.frame_seq, millis());
+    }, true);
+    AsyncTasker::schedule(MIRROR_PERIOD_MS, [this](uint64_t t, uint64_t &d, bool &repeat) { publish_mirror(); }, true);
+
+    // Self-timed: sleeps until the next queued frame is due
+    AsyncTasker::schedule(JitterBuffer::IDLE_POLL_MS, [this](uint64_t t, uint64_t &d, bool &repeat) {
+        d = m_jitter_buffer.present_due(millis(), *this);
+    }, true);
+
+    // Self-timed: one palette step per period while an indexed frame is cycling
+    AsyncTasker::schedule(PALETTE_IDLE_MS, [this](uint64_t t, uint64_t &d, bool &repeat) {
+        d = m_palette_cycle.period_ms ? m_palette_cycle.period_ms : PALETTE_IDLE_MS;
+        auto &indexed = task_draw_matrix.indexed;
+        if (!m_palette_cycle.period_ms || !indexed.active()) {
+            return;
+        }
+        indexed.rotate(m_palette_cycle.first, m_palette_cycle.count, m_palette_cycle.reverse);
+        task_draw_matrix.show_indexed();
+    }, true);
+
+    // Self-timed: sleeps until the next animation or effect frame is due (at most one of them is running), or the
+    // next step of the ticker above it or of a transition
+    AsyncTasker::schedule(Animation::IDLE_POLL_MS, [this](uint64_t t, uint64_t &d, bool &repeat) {
+        uint32_t wait_ms;
+        uint32_t gif_wait_ms;
+        uint32_t effect_wait_ms;
+        uint32_t ticker_wait_ms;
+        uint32_t transition_wait_ms;
+        bool shown = task_draw_matrix.player.run(millis(), wait_ms);
+        shown = task_draw_matrix.gif.run(millis(), gif_wait_ms) || shown;
+        shown = task_draw_matrix.effects.run(millis(), effect_wait_ms) || shown;
+        bool changed = task_draw_matrix.ticker.run(millis(), ticker_wait_ms);
+        changed = task_draw_matrix.transition.run(millis(), transition_wait_ms) || changed;
+        if (shown) {
+            task_draw_matrix.show();
+        } else if (changed) {
+            task_draw_matrix.refresh(); // Only the overlay or the blend changed: not a new user frame
+        }
+        wait_ms = gif_wait_ms < wait_ms ? gif_wait_ms : wait_ms;
+        wait_ms = effect_wait_ms < wait_ms ? effect_wait_ms : wait_ms;
+        wait_ms = ticker_wait_ms < wait_ms ? ticker_wait_ms : wait_ms;
+        d = transition_wait_ms < wait_ms ? transition_wait_ms : wait_ms;
+    }, true);
+
+    // Bound on every interface: listening starts as soon as WiFi is up
+    if (!m_frame_input.begin()) {
+        Serial.println("Failed to open the DDP/E1.31 ports");
+    }
 }
 
 // --------------------------------------------------------------------------------------
 App::~App() {}
 
+// --------------------------------------------------------------------------------------
+void App::restore_checkpoint() {
+    if (!RtcState::warm_boot() || !RtcState::load(m_checkpoint)) {
+        return;
+    }
+    auto &canvas = task_draw_matrix.scene.canvas;
+    task_draw_matrix.matrix.setBrightness(m_checkpoint.brightness);
+    m_clock_mode = m_checkpoint.clock_mode; // The clock task redraws its layer within a second
+    if (m_checkpoint.frame_len) {
+        FrameCodec::rle_decode(m_checkpoint.frame, m_checkpoint.frame_len, canvas.pixels(), N_PIXELS);
+        canvas.invalidate();
+    }
+    task_draw_matrix.refresh();
+    m_checkpoint_seq = task_draw_matrix.frame_seq;
+    if (m_checkpoint.epoch) {
+        m_restored_epoch = m_checkpoint.epoch;
+        m_restored_millis = millis();
+    }
+    Serial.printf("Warm boot: restored brightness %u, clock mode %d, %u byte frame, epoch %u\n",
+                  m_checkpoint.brightness, m_clock_mode, m_checkpoint.frame_len, m_checkpoint.epoch);
+}
+
+// --------------------------------------------------------------------------------------
+void App::checkpoint() {
+    // Re-encode only when a new user frame was shown; the canvas alone, the clock is redrawn anyway
+    if (task_draw_matrix.frame_seq != m_checkpoint_seq) {
+        m_checkpoint.frame_len = static_cast<uint16_t>(FrameCodec::rle_encode(
+            task_draw_matrix.scene.canvas.pixels(), N_PIXELS, m_checkpoint.frame, sizeof(m_checkpoint.frame)));
+        m_checkpoint_seq = task_draw_matrix.frame_seq;
+    }
+    m_checkpoint.brightness = task_draw_matrix.matrix.getBrightness();
+    m_checkpoint.clock_mode = m_clock_mode;
+    m_checkpoint.epoch = (m_ntp.isTimeSet() || m_restored_epoch) ? local_epoch() : 0;
+    RtcState::store(m_checkpoint);
+}
+
+// --------------------------------------------------------------------------------------
+uint32_t App::local_epoch() const {
+    if (!m_ntp.isTimeSet() && m_restored_epoch) {
+        return m_restored_epoch + (millis() - m_restored_millis) / 1000;
+    }
+    return m_ntp.getEpochTime();
+}
+
 // --------------------------------------------------------------------------------------
 void App::run() {
-    // Nothing to do here for now
+    // Shown here rather than from the packet callback: the strip blocks interrupts while it is written
+    if (m_present_pending) {
+        m_present_pending = false;
+        clock_mode(false); // A live stream owns the display
+        task_draw_matrix.show();
+    }
 }
 
 // --------------------------------------------------------------------------------------
-void App::clock_mode(bool enable) { m_clock_mode = enable; }
+void App::present() { m_present_pending = true; }
+
+// --------------------------------------------------------------------------------------
+void App::write_timed_pixels(uint32_t timecode, size_t first, const uint8_t *rgb, size_t count) {
+    m_jitter_buffer.write(timecode, first, rgb, count, millis());
+}
+
+// --------------------------------------------------------------------------------------
+void App::present_at(uint32_t timecode) { m_jitter_buffer.commit(timecode, millis()); }
+
+// --------------------------------------------------------------------------------------
+void App::clock_mode(bool enable) {
+    m_clock_mode = enable;
+    auto &clock = task_draw_matrix.scene.clock;
+    if (!enable && clock.active()) {
+        task_draw_matrix.transition_to(m_transition_kind, m_transition_ms, false);
+        clock.end(); // Uncovers the picture
+        task_draw_matrix.refresh();
+    }
+}
+
+// --------------------------------------------------------------------------------------
+bool App::streaming(uint32_t idle_ms) const {
+    const uint32_t now = millis();
+    const auto &udp = m_frame_input.stats();
+    const auto &ws = m_frame_socket.stats();
+    return (udp.frames && now - udp.last_frame_ms < idle_ms) || (ws.frames && now - ws.last_frame_ms < idle_ms);
+}
 
 // --------------------------------------------------------------------------------------
 void App::handle_root(AsyncWebServerRequest *request) {
-    request->send_P(200, "text/html", INDEX_HTML);
+    send_asset(request, WebAssets::INDEX);
 }
 
 // --------------------------------------------------------------------------------------
 void App::handle_draw(AsyncWebServerRequest *request) {
-    request->send_P(200, "text/html", DRAW_HTML);
+    send_asset(request, WebAssets::DRAW);
 }
 
 // --------------------------------------------------------------------------------------
 void App::handle_music(AsyncWebServerRequest *request) {
-    request->send_P(200, "text/html", MUSIC_HTML);
+    send_asset(request, WebAssets::MUSIC);
 }
 
 // --------------------------------------------------------------------------------------
 void App::handle_alarm(AsyncWebServerRequest *request) {
-    request->send_P(200, "text/html", ALARM_HTML);
+    send_asset(request, WebAssets::ALARM);
 }
 
 // --------------------------------------------------------------------------------------
@@ -258,7 +436,10 @@ void App::handle_gif(AsyncWebServerRequest *request) {
     gif_colored[16] = millis() % 256;
     gif_colored[17] = millis() % 256;
     gif_colored[18] = millis() % 256;
-    request->send_P(200, "image/gif", gif_colored, sizeof(gif_colored));
+    // Copied into the response: it is sent after this buffer is gone
+    AsyncResponseStream *response = request->beginResponseStream("image/gif", sizeof(gif_colored));
+    response->write(gif_colored, sizeof(gif_colored));
+    request->send(response);
 }
 
 // --------------------------------------------------------------------------------------
@@ -318,7 +499,7 @@ void App::handle_set_display_color(AsyncWebServerRequest *request) {
     constexpr size_t GIF_WIDTH = 160;
     constexpr size_t GIF_HEIGHT = 160;
 #define LOW_HIGH_BYTES(_v) ((_v) & 0xFF), (((_v) >> 8) & 0xFF)
-    static uint8_t gif[] = {0x47,
+    static const uint8_t gif_template[] PROGMEM = {0x47,
                             0x49,
                             0x46,
                             0x38,
@@ -365,17 +546,239 @@ void App::handle_set_display_color(AsyncWebServerRequest *request) {
                             0x0F,
                             0x00,
                             0x3B};
+    // Per request: concurrent requests used to share (and recolour) one static buffer
+    uint8_t gif[sizeof(gif_template)];
+    memcpy_P(gif, gif_template, sizeof(gif));
     // Set the color table to the requested color (first entry)
     gif[16] = (color >> 16) & 0xFF; // Red
     gif[17] = (color >> 8) & 0xFF;  // Green
     gif[18] = color & 0xFF;         // Blue
 
-    request->send_P(200, "image/gif", gif, sizeof(gif));
+    AsyncResponseStream *response = request->beginResponseStream("image/gif", sizeof(gif));
+    response->write(gif, sizeof(gif));
+    request->send(response);
+}
+
+// --------------------------------------------------------------------------------------
+void App::handle_snapshot(AsyncWebServerRequest *request) {
+    const String layer = request->hasParam("layer") ? request->getParam("layer")->value() : String("scene");
+    if (layer != "scene" && layer != "canvas") {
+        Serial.println("Invalid snapshot layer");
+        request->send(400, "text/plain", "Invalid arguments: layer=scene|canvas");
+        return;
+    }
+    // Each request encodes its own copy while the response is sent; the filler produces the file as it goes
+    const Compositor::Scene &scene = task_draw_matrix.scene;
+    if (layer == "canvas") {
+        // What users drew, without the clock and the overlay: the editor reads it back to keep drawing on it
+        send_image(request, [&scene](size_t i, uint8_t rgb[3]) { memcpy(rgb, scene.canvas.pixels() + 3 * i, 3); });
+        return;
+    }
+    send_image(request, [&scene](size_t i, uint8_t rgb[3]) { scene.pixel(i, rgb); });
+}
+
+// --------------------------------------------------------------------------------------
+void App::send_image(AsyncWebServerRequest *request, Snapshot::Source source) {
+    String error_message;
+
+    const String format = request->hasParam("format") ? request->getParam("format")->value() : String("gif");
+    const long scale = request->hasParam("scale") ? request->getParam("scale")->value().toInt() : 1;
+    if ((format != "gif" && format != "bmp") || scale < 1 || scale > Snapshot::MAX_SCALE) {
+        error_message = "Invalid arguments: format=gif|bmp, scale=1.." + String(Snapshot::MAX_SCALE);
+        Serial.println(error_message.c_str());
+        request->send(400, "text/plain", error_message.c_str());
+        return;
+    }
+
+    const Snapshot::Format snapshot_format = format == "gif" ? Snapshot::Format::GIF : Snapshot::Format::BMP;
+    std::shared_ptr<Snapshot::Encoder> encoder(new (std::nothrow) Snapshot::Encoder(
+        std::move(source), N_COLS, N_ROWS, snapshot_format, static_cast<uint8_t>(scale)));
+    if (!encoder) {
+        error_message = "Not enough memory for a snapshot";
+        Serial.println(error_message.c_str());
+        request->send(500, "text/plain", error_message.c_str());
+        return;
+    }
+    AsyncWebServerResponse *response = request->beginChunkedResponse(
+        Snapshot::content_type(snapshot_format),
+        [encoder](uint8_t *buffer, size_t max_len, size_t index) { return encoder->read(buffer, max_len); });
+    response->addHeader("Cache-Control", "no-store");
+    request->send(response);
+}
+
+// --------------------------------------------------------------------------------------
+const Gallery::Entry *App::gallery_entry(AsyncWebServerRequest *request) const {
+    if (request->hasParam("id")) {
+        const long id = request->getParam("id")->value().toInt();
+        return id > 0 && id <= UINT8_MAX ? m_gallery.find(static_cast<uint8_t>(id)) : nullptr;
+    }
+    return request->hasParam("name") ? m_gallery.find(request->getParam("name")->value().c_str()) : nullptr;
+}
+
+// --------------------------------------------------------------------------------------
+void App::handle_gallery(AsyncWebServerRequest *request) {
+    JsonDocument doc;
+    JsonArray frames = doc["frames"].to<JsonArray>();
+    for (size_t k = 0; k < m_gallery.size(); k++) {
+        JsonObject frame = frames.add<JsonObject>();
+        frame["id"] = m_gallery[k].id;
+        frame["name"] = m_gallery[k].name;
+        frame["bytes"] = m_gallery[k].len;
+    }
+    doc["capacity"] = Gallery::MAX_FRAMES;
+    doc["data_bytes"] = m_gallery.data_size();
+
+    String response;
+    serializeJson(doc, response);
+    request->send(200, "application/json", response);
+}
+
+// --------------------------------------------------------------------------------------
+void App::handle_gallery_save(AsyncWebServerRequest *request) {
+    const String name = request->hasParam("name") ? request->getParam("name")->value() : String();
+    if (!Animation::valid_name(name) || name.length() > Gallery::MAX_NAME_LEN) {
+        Serial.println("Invalid gallery frame name");
+        request->send(400, "text/plain", "Invalid name: letters, digits, '-' and '_', at most " +
+                                             String(Gallery::MAX_NAME_LEN) + " characters");
+        return;
+    }
+    uint8_t id = 0;
+    const char *error = m_gallery.save(name.c_str(), task_draw_matrix.scene.canvas.pixels(), id);
+    if (error) {
+        Serial.println(error);
+        request->send(400, "text/plain", error);
+        return;
+    }
+    request->send(200, "text/plain", "Saved " + name + " as id " + String(id));
+}
+
+// --------------------------------------------------------------------------------------
+void App::handle_gallery_recall(AsyncWebServerRequest *request) {
+    const uint32_t start = micros();
+    const Gallery::Entry *entry = gallery_entry(request);
+    if (!entry) {
+        Serial.println("No such gallery frame");
+        request->send(400, "text/plain", "No such frame: id=<id> or name=<name>");
+        return;
+    }
+    Transition::Kind kind = m_transition_kind;
+    uint16_t duration_ms = m_transition_ms;
+    if (!transition_args(request, kind, duration_ms)) {
+        Serial.println("Invalid gallery transition");
+        request->send(400, "text/plain", "Invalid transition: transition=none|crossfade|wipe|dissolve, ms=1.." +
+                                             String(Transition::MAX_DURATION_MS));
+        return;
+    }
+    const char *error = nullptr;
+    std::unique_ptr<uint8_t[]> data = m_gallery.read(*entry, error);
+    if (!data) {
+        Serial.println(error);
+        request->send(400, "text/plain", error);
+        return;
+    }
+    // An edit like any other: undoable, and only the pixels that differ are recomposited
+    task_draw_matrix.release_canvas();
+    task_draw_matrix.transition_to(kind, duration_ms, true);
+    task_draw_matrix.history.begin();
+    auto &canvas = task_draw_matrix.scene.canvas;
+    FrameCodec::rle_decode_to(data.get(), entry->len, N_PIXELS,
+                              [&canvas](size_t first, const uint8_t *rgb, size_t count) {
+                                  canvas.write(first, rgb, count);
+                              });
+    task_draw_matrix.show();
+    const uint32_t us = micros() - start;
+    m_gallery.recalled(us);
+    request->send(200, "text/plain", "Recalled " + String(entry->name) + " in " + String(us) + " us");
+}
+
+// --------------------------------------------------------------------------------------
+bool App::transition_args(AsyncWebServerRequest *request, Transition::Kind &kind, uint16_t &duration_ms) const {
+    if (request->hasParam("transition") && !Transition::find(request->getParam("transition")->value().c_str(), kind)) {
+        return false;
+    }
+    if (request->hasParam("ms")) {
+        const long ms = request->getParam("ms")->value().toInt();
+        if (ms < 1 || ms > Transition::MAX_DURATION_MS) {
+            return false;
+        }
+        duration_ms = ms;
+    }
+    return true;
+}
+
+// --------------------------------------------------------------------------------------
+void App::handle_gallery_delete(AsyncWebServerRequest *request) {
+    const Gallery::Entry *entry = gallery_entry(request);
+    const char *error = entry ? m_gallery.remove(entry->id) : "No such frame: id=<id> or name=<name>";
+    if (error) {
+        Serial.println(error);
+        request->send(400, "text/plain", error);
+        return;
+    }
+    request->send(200, "text/plain", "Frame deleted");
+}
+
+// --------------------------------------------------------------------------------------
+void App::handle_gallery_thumbnail(AsyncWebServerRequest *request) {
+    const Gallery::Entry *entry = gallery_entry(request);
+    if (!entry) {
+        Serial.println("No such gallery frame");
+        request->send(400, "text/plain", "No such frame: id=<id> or name=<name>");
+        return;
+    }
+    const char *error = nullptr;
+    std::unique_ptr<uint8_t[]> data = m_gallery.read(*entry, error);
+    // Decoded once; the encoder reads it while the response is sent
+    std::shared_ptr<uint8_t> pixels(data ? new (std::nothrow) uint8_t[N_PIXELS * 3] : nullptr,
+                                    std::default_delete<uint8_t[]>());
+    if (data && !pixels) {
+        error = "Not enough memory for a thumbnail";
+    } else if (data && FrameCodec::rle_decode(data.get(), entry->len, pixels.get(), N_PIXELS) != N_PIXELS) {
+        error = "Gallery frame is corrupt"; // Short: the rest of the buffer was never written
+    }
+    if (error) {
+        Serial.println(error);
+        request->send(400, "text/plain", error);
+        return;
+    }
+    send_image(request, [pixels](size_t i, uint8_t rgb[3]) { memcpy(rgb, pixels.get() + i * 3, 3); });
 }
 
 // --------------------------------------------------------------------------------------
 void App::handle_set_display_matrix(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
     String error_message;
+
+    if (request->contentType().equalsIgnoreCase(Heatshrink::CONTENT_TYPE)) {
+        // Compressed row-major RGB: decoded chunk by chunk straight into the display buffer
+        if (index == 0) {
+            m_upload_stream.begin();
+        }
+        m_upload_stream.feed(data, len, [this](size_t first, const uint8_t *rgb, size_t count) {
+            if (first < N_PIXELS) {
+                write_pixels(first, rgb, std::min(count, N_PIXELS - first));
+            }
+        });
+        if (index + len < total) {
+            return; // Still receiving
+        }
+        if (m_upload_stream.next()) {
+            // What was decoded before a mismatch stays drawn, as on /draw_commands
+            task_draw_matrix.show();
+        }
+        if (m_upload_stream.next() != N_PIXELS) {
+            error_message = "Compressed frame has " + String(m_upload_stream.next()) + " pixels, expected " +
+                            String(N_PIXELS);
+            Serial.println(error_message.c_str());
+            request->send(400, "text/plain", error_message.c_str());
+            return;
+        }
+        request->send(200, "text/plain", "Matrix updated successfully");
+        return;
+    }
+    if (request->contentType().equalsIgnoreCase(Palette::CONTENT_TYPE)) {
+        upload_indexed(request, data, len, index, total);
+        return;
+    }
     
     // Collect body data using helper function
     static String body;
@@ -413,7 +816,497 @@ void App::handle_set_display_matrix(AsyncWebServerRequest *request, uint8_t *dat
 }
 
 // --------------------------------------------------------------------------------------
+void App::upload_indexed(AsyncWebServerRequest *request, const uint8_t *data, size_t len, size_t index, size_t total) {
+    auto &indexed = task_draw_matrix.indexed;
+    if (index == 0) {
+        // The header and total length tell whether the body fits: a rejected body never touches the frame
+        m_indexed_error = nullptr;
+        const size_t colors = len >= Palette::HEADER_SIZE ? (data[0] | (data[1] << 8)) : 0;
+        m_indexed_palette_end = Palette::HEADER_SIZE + colors * 3;
+        if (len < Palette::HEADER_SIZE || colors > Palette::N_COLORS) {
+            m_indexed_error = "Invalid palette header";
+        } else if (total != m_indexed_palette_end && total != m_indexed_palette_end + N_PIXELS) {
+            m_indexed_error = "Indexed body must be a palette, optionally followed by one index per pixel";
+        } else if (total == m_indexed_palette_end && !indexed.active()) {
+            m_indexed_error = "No indexed frame to recolour";
+        } else if (!indexed.begin()) {
+            m_indexed_error = "Not enough memory for an indexed frame";
+        }
+    } else if (!m_indexed_error && !indexed.active()) {
+        // Other content released the frame between two chunks: its buffers are gone
+        m_indexed_error = "Indexed frame was replaced during the upload";
+    }
+
+    if (!m_indexed_error) {
+        // Palette entries and indices go straight to their place, wherever the chunks split the body
+        const size_t end = index + len;
+        for (size_t pos = index; pos < end;) {
+            const uint8_t *src = data + (pos - index);
+            if (pos < Palette::HEADER_SIZE) {
+                pos = std::min(end, Palette::HEADER_SIZE);
+            } else if (pos < m_indexed_palette_end) {
+                const size_t n = std::min(end, m_indexed_palette_end) - pos;
+                memcpy(indexed.colors() + (pos - Palette::HEADER_SIZE), src, n);
+                pos += n;
+            } else {
+                memcpy(indexed.indices() + (pos - m_indexed_palette_end), src, end - pos);
+                pos = end;
+            }
+        }
+    }
+    if (index + len < total) {
+        return; // Still receiving
+    }
+
+    if (m_indexed_error) {
+        Serial.println(m_indexed_error);
+        request->send(400, "text/plain", m_indexed_error);
+        return;
+    }
+    task_draw_matrix.stop_renderers(); // Their next frame would land over the indexed one
+    task_draw_matrix.show_indexed();
+    request->send(200, "text/plain", "Matrix updated successfully");
+}
+
+// --------------------------------------------------------------------------------------
+void App::handle_set_palette_cycle(AsyncWebServerRequest *request) {
+    String error_message;
 
+    if (!request->hasParam("period")) {
+        error_message = "Missing 'period' argument";
+        Serial.printf(error_message.c_str());
+        request->send(400, "text/plain", error_message.c_str());
+        return;
+    }
+    const long first = request->hasParam("first") ? request->getParam("first")->value().toInt() : 0;
+    if (first < 0 || first >= static_cast<long>(Palette::N_COLORS)) {
+        error_message = "Invalid 'first' argument, expected 0-" + String(Palette::N_COLORS - 1);
+        Serial.println(error_message.c_str());
+        request->send(400, "text/plain", error_message.c_str());
+        return;
+    }
+    const long period = request->getParam("period")->value().toInt();
+    const long count = request->hasParam("count") ? request->getParam("count")->value().toInt()
+                                                  : static_cast<long>(Palette::N_COLORS) - first;
+
+    m_palette_cycle.first = static_cast<uint8_t>(first);
+    m_palette_cycle.count = static_cast<uint16_t>(std::max(0L, std::min(count, static_cast<long>(Palette::N_COLORS))));
+    m_palette_cycle.reverse = request->hasParam("reverse") && request->getParam("reverse")->value().toInt();
+    m_palette_cycle.period_ms = period > 0 ? std::max(static_cast<uint32_t>(period), PALETTE_MIN_PERIOD_MS) : 0;
+    if (!m_palette_cycle.period_ms) {
+        request->send(200, "text/plain", "Palette cycling stopped");
+        return;
+    }
+    request->send(200, "text/plain", "Palette cycling every " + String(m_palette_cycle.period_ms) + " ms");
+}
+
+// --------------------------------------------------------------------------------------
+void App::handle_set_display_image(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index,
+                                   size_t total) {
+    auto &canvas = task_draw_matrix.scene.canvas;
+    if (index == 0) {
+        m_image_upload.reset();
+        m_image_error = Qoi::check_header(data, len, N_COLS, N_ROWS);
+        m_image_drawn = !m_image_error;
+        if (m_image_drawn) {
+            task_draw_matrix.release_canvas();
+            task_draw_matrix.history.begin();
+            canvas.fill(0, 0, 0); // Around an image smaller than the display
+        }
+    }
+    if (!m_image_error) {
+        // Centred like GIFs; transparency is blended over black
+        m_image_upload.feed(data, len, [&](uint16_t x, uint16_t y, const uint8_t *rgba) {
+            const size_t i = static_cast<size_t>((N_ROWS - m_image_upload.height()) / 2 + y) * N_COLS +
+                             (N_COLS - m_image_upload.width()) / 2 + x;
+            const uint8_t alpha = rgba[3];
+            canvas.set(i, rgba[0] * alpha / 255, rgba[1] * alpha / 255, rgba[2] * alpha / 255);
+        });
+        m_image_error = m_image_upload.error();
+    }
+    if (index + len < total) {
+        return; // Still receiving
+    }
+
+    if (!m_image_error && !m_image_upload.done()) {
+        m_image_error = "QOI image is truncated";
+    }
+    if (m_image_drawn) {
+        // What was decoded before an error stays drawn, as on /draw_commands, and closes the edit
+        task_draw_matrix.show();
+    }
+    if (m_image_error) {
+        Serial.println(m_image_error);
+        request->send(400, "text/plain", m_image_error);
+        return;
+    }
+    request->send(200, "text/plain", "Matrix updated successfully");
+}
+
+// --------------------------------------------------------------------------------------
+void App::handle_draw_commands(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index,
+                               size_t total) {
+    if (index == 0) {
+        task_draw_matrix.release_canvas();
+        task_draw_matrix.history.begin();
+        m_draw_commands.begin();
+    }
+    m_draw_commands.feed(data, len);
+    if (index + len < total) {
+        return; // Still receiving
+    }
+
+    // What ran before an error stays drawn
+    task_draw_matrix.show();
+    const char *error = m_draw_commands.error();
+    if (!error && !m_draw_commands.complete()) {
+        error = "Draw command is truncated";
+    }
+    if (error) {
+        Serial.println(error);
+        request->send(400, "text/plain", error);
+        return;
+    }
+    request->send(200, "text/plain", "Matrix updated successfully");
+}
+
+// --------------------------------------------------------------------------------------
+void App::handle_undo(AsyncWebServerRequest *request) {
+    auto &history = task_draw_matrix.history;
+    history.commit();
+    if (!history.stats().undo) {
+        Serial.println("Nothing to undo");
+        request->send(400, "text/plain", "Nothing to undo");
+        return;
+    }
+    task_draw_matrix.release_canvas();
+    history.undo();
+    task_draw_matrix.show();
+    request->send(200, "text/plain", "Undone");
+}
+
+// --------------------------------------------------------------------------------------
+void App::handle_redo(AsyncWebServerRequest *request) {
+    auto &history = task_draw_matrix.history;
+    history.commit();
+    if (!history.stats().redo) {
+        Serial.println("Nothing to redo");
+        request->send(400, "text/plain", "Nothing to redo");
+        return;
+    }
+    task_draw_matrix.release_canvas();
+    history.redo();
+    task_draw_matrix.show();
+    request->send(200, "text/plain", "Redone");
+}
+
+// --------------------------------------------------------------------------------------
+void App::handle_set_display_gif(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index,
+                                 size_t total) {
+    if (index == 0) {
+        m_gif_shown = false;
+        m_gif_error = Gif::check_header(data, len, N_COLS, N_ROWS);
+        if (!m_gif_error) {
+            m_gif_upload.reset(new (std::nothrow) Gif::Decoder(task_draw_matrix.scene.canvas, N_COLS, N_ROWS));
+            m_gif_error = m_gif_upload ? nullptr : "Not enough memory to decode a GIF";
+        }
+        if (!m_gif_error) {
+            task_draw_matrix.release_canvas();
+            clock_mode(false);
+        }
+    }
+    // No delays here: every frame is shown as soon as it is decoded (stored GIFs play in time, see /animation_play)
+    for (size_t used = 0; !m_gif_error && used < len && !m_gif_upload->finished();) {
+        used += m_gif_upload->feed(data + used, len - used);
+        m_gif_error = m_gif_upload->error();
+        if (m_gif_upload->frame_done()) {
+            task_draw_matrix.show();
+            m_gif_shown = true;
+        }
+    }
+    if (index + len < total) {
+        return; // Still receiving
+    }
+
+    m_gif_upload.reset();
+    if (!m_gif_error && !m_gif_shown) {
+        m_gif_error = "GIF has no complete frame";
+    }
+    if (m_gif_error) {
+        Serial.println(m_gif_error);
+        request->send(400, "text/plain", m_gif_error);
+        return;
+    }
+    request->send(200, "text/plain", "Matrix updated successfully");
+}
+
+// --------------------------------------------------------------------------------------
+void App::handle_animation_upload(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index,
+                                  size_t total) {
+    if (index == 0) {
+        m_animation_name = request->hasParam("name") ? request->getParam("name")->value() : String();
+        m_animation_gif = Gif::is_gif(data, len);
+        if (!Animation::valid_name(m_animation_name)) {
+            m_animation_error = "Missing or invalid 'name' argument (letters, digits, '-' and '_')";
+        } else {
+            m_animation_error = m_animation_gif ? Gif::check_header(data, len, N_COLS, N_ROWS)
+                                                : Animation::check_header(data, len, total, N_COLS, N_ROWS);
+        }
+        if (!m_animation_error) {
+            // Streamed to flash under a temporary name: a failed upload leaves the previous version playable
+            const char *extension = m_animation_gif ? Gif::EXTENSION : Animation::EXTENSION;
+            m_animation_upload = LittleFS.open(Animation::path(m_animation_name, extension) + ".tmp", "w");
+            if (!m_animation_upload) {
+                m_animation_error = "Cannot create the animation file";
+            }
+        }
+    }
+    if (!m_animation_error && m_animation_upload.write(data, len) != len) {
+        m_animation_error = "Not enough flash space for the animation";
+    }
+    if (index + len < total) {
+        return; // Still receiving
+    }
+
+    const String path = Animation::path(m_animation_name, m_animation_gif ? Gif::EXTENSION : Animation::EXTENSION);
+    const bool created = static_cast<bool>(m_animation_upload);
+    m_animation_upload.close();
+    if (m_animation_error) {
+        if (created) {
+            LittleFS.remove(path + ".tmp");
+        }
+        Serial.println(m_animation_error);
+        request->send(400, "text/plain", m_animation_error);
+        return;
+    }
+    if (task_draw_matrix.player.current() == path || task_draw_matrix.gif.current() == path) {
+        task_draw_matrix.release_canvas(); // Replaced under the player
+    }
+    if (!LittleFS.rename(path + ".tmp", path)) {
+        const char *error_message = "Failed to save the animation";
+        Serial.println(error_message);
+        request->send(500, "text/plain", error_message);
+        return;
+    }
+    // A name is either format: the other version, if any, is replaced too
+    const String other = Animation::path(m_animation_name, m_animation_gif ? Animation::EXTENSION : Gif::EXTENSION);
+    if (task_draw_matrix.player.current() == other || task_draw_matrix.gif.current() == other) {
+        task_draw_matrix.release_canvas();
+    }
+    LittleFS.remove(other);
+    Serial.printf("Animation %s saved (%u bytes)\n", path.c_str(), static_cast<unsigned>(total));
+    request->send(200, "text/plain", "Animation " + m_animation_name + " saved");
+}
+
+// --------------------------------------------------------------------------------------
+void App::handle_animation_play(AsyncWebServerRequest *request) {
+    String error_message;
+
+    const String name = request->hasParam("name") ? request->getParam("name")->value() : String();
+    if (!Animation::valid_name(name)) {
+        error_message = "Missing or invalid 'name' argument";
+        Serial.println(error_message.c_str());
+        request->send(400, "text/plain", error_message.c_str());
+        return;
+    }
+    task_draw_matrix.release_canvas();
+    const String gif = Animation::path(name, Gif::EXTENSION);
+    const char *error = LittleFS.exists(gif) ? task_draw_matrix.gif.play(gif)
+                                             : task_draw_matrix.player.play(Animation::path(name));
+    if (error) {
+        Serial.println(error);
+        request->send(400, "text/plain", error);
+        return;
+    }
+    clock_mode(false);
+    request->send(200, "text/plain", "Playing animation " + name);
+}
+
+// --------------------------------------------------------------------------------------
+void App::handle_animation_stop(AsyncWebServerRequest *request) {
+    task_draw_matrix.player.stop();
+    task_draw_matrix.gif.stop();
+    request->send(200, "text/plain", "Animation stopped");
+}
+
+// --------------------------------------------------------------------------------------
+void App::handle_effect(AsyncWebServerRequest *request) {
+    String error_message;
+
+    Effects::Kind kind;
+    const String name = request->hasParam("name") ? request->getParam("name")->value() : String();
+    const long fps = request->hasParam("fps") ? request->getParam("fps")->value().toInt() : Effects::DEFAULT_FPS;
+    const long saturation = request->hasParam("saturation") ? request->getParam("saturation")->value().toInt() : 255;
+    const bool gamma = request->hasParam("gamma") && request->getParam("gamma")->value() == "1";
+    if (!Effects::find(name.c_str(), kind) || fps < 1 || fps > Effects::MAX_FPS || saturation < 0 ||
+        saturation > 255) {
+        error_message = "Invalid arguments: name=rainbow|plasma|fire|noise|gradient, fps=1.." +
+                        String(Effects::MAX_FPS) + ", saturation=0..255, gamma=0|1";
+        Serial.println(error_message.c_str());
+        request->send(400, "text/plain", error_message.c_str());
+        return;
+    }
+    task_draw_matrix.release_canvas();
+    const char *error = task_draw_matrix.effects.start(kind, static_cast<uint8_t>(fps), millis(),
+                                                       static_cast<uint8_t>(saturation), gamma);
+    if (error) {
+        Serial.println(error);
+        request->send(400, "text/plain", error);
+        return;
+    }
+    // Frames are written straight into the canvas, past the recorder: earlier edits can no longer be undone
+    task_draw_matrix.history.clear();
+    clock_mode(false);
+    request->send(200, "text/plain", "Running effect " + name + " at " + String(fps) + " fps");
+}
+
+// --------------------------------------------------------------------------------------
+void App::handle_effect_stop(AsyncWebServerRequest *request) {
+    task_draw_matrix.effects.stop();
+    request->send(200, "text/plain", "Effect stopped");
+}
+
+// --------------------------------------------------------------------------------------
+void App::handle_effect_benchmark(AsyncWebServerRequest *request) {
+    String error_message;
+    auto &bench = m_effect_benchmark;
+
+    if (request->hasParam("frames")) {
+        const long frames = request->getParam("frames")->value().toInt();
+        if (frames < 1 || frames > EFFECT_BENCHMARK_MAX_FRAMES || bench.scratch) {
+            error_message = bench.scratch ? "A benchmark is already running"
+                                          : "Invalid arguments: frames=1.." + String(EFFECT_BENCHMARK_MAX_FRAMES);
+            Serial.println(error_message.c_str());
+            request->send(400, "text/plain", error_message.c_str());
+            return;
+        }
+        bench.scratch.reset(new (std::nothrow) uint8_t[N_PIXELS * 3]);
+        if (!bench.scratch) {
+            error_message = "Not enough memory for the benchmark";
+            Serial.println(error_message.c_str());
+            request->send(500, "text/plain", error_message.c_str());
+            return;
+        }
+        bench.frames = frames;
+        bench.step = 0;
+        bench.frame = 0;
+        bench.done = false;
+        memset(bench.total_us, 0, sizeof(bench.total_us));
+        // A frame at a time: a whole run would hold up loop() and the network for most of a second
+        AsyncTasker::schedule(EFFECT_BENCHMARK_SLICE_MS, [this](uint64_t t, uint64_t &d, bool &repeat) {
+            repeat = effect_benchmark_step();
+        }, true);
+    }
+
+    JsonDocument doc;
+    doc["running"] = static_cast<bool>(bench.scratch);
+    doc["cpu_mhz"] = ESP.getCpuFreqMHz();
+    doc["frames"] = bench.frames;
+    if (bench.done) {
+        JsonObject us_per_frame = doc["us_per_frame"].to<JsonObject>();
+        for (size_t k = 0; k < Effects::N_KINDS; k++) {
+            us_per_frame[Effects::name(static_cast<Effects::Kind>(k))] = bench.total_us[k] / bench.frames;
+        }
+        us_per_frame["hsv_to_rgb"] = bench.total_us[Effects::N_KINDS] / bench.frames;
+        us_per_frame["color_hsv"] = bench.total_us[Effects::N_KINDS + 1] / bench.frames;
+    }
+
+    String response;
+    serializeJson(doc, response);
+    request->send(200, "application/json", response);
+}
+
+// --------------------------------------------------------------------------------------
+bool App::effect_benchmark_step() {
+    auto &bench = m_effect_benchmark;
+    // Rendering only, into a scratch frame: compositing and the strip are the same for every source. Every frame is
+    // rendered at effect time 0 (fire from a cold heat map), which does not change what it costs.
+    if (bench.step < Effects::N_KINDS) {
+        const Effects::Kind kind = static_cast<Effects::Kind>(bench.step);
+        bench.total_us[bench.step] += task_draw_matrix.effects.benchmark(kind, bench.scratch.get(), 1);
+    } else {
+        // A frame of HSV with gamma: the batch kernel effects use against ColorHSV and gamma32 per pixel
+        bench.total_us[bench.step] += Effects::benchmark_hsv(N_PIXELS, 1, bench.step == Effects::N_KINDS);
+    }
+    if (++bench.frame == bench.frames) {
+        bench.frame = 0;
+        bench.step++;
+    }
+    if (bench.step < EFFECT_BENCHMARK_STEPS) {
+        return true;
+    }
+    bench.scratch.reset();
+    bench.done = true;
+    return false;
+}
+
+// --------------------------------------------------------------------------------------
+void App::handle_ticker(AsyncWebServerRequest *request) {
+    String error_message;
+
+    auto arg = [request](const char *name, long fallback) {
+        return request->hasParam(name) ? request->getParam(name)->value().toInt() : fallback;
+    };
+    const String text = request->hasParam("text") ? request->getParam("text")->value() : String();
+    const long font = arg("font", 0);
+    const long color = arg("color", 0xFFFFFF);
+    const long speed = arg("speed", Ticker::DEFAULT_SPEED);
+    const long y = arg("y", -1);
+    const long fps = arg("fps", Ticker::DEFAULT_FPS);
+    const long loops = arg("loops", 0);
+    Ticker::Options options;
+    options.color = Adafruit_NeoMatrix::Color(color >> 16, color >> 8, color);
+    if (text.isEmpty() || text.length() > Ticker::MAX_TEXT || font < 0 || font >= Ticker::N_FONTS || color < 0 ||
+        color > 0xFFFFFF || options.color == Compositor::Layer::TRANSPARENT || speed < 1 || speed > Ticker::MAX_SPEED ||
+        y < -1 || y >= N_ROWS || fps < 1 || fps > Ticker::MAX_FPS || loops < 0 || loops > UINT16_MAX) {
+        error_message = "Invalid arguments: text (1.." + String(Ticker::MAX_TEXT) + " characters), font=0.." +
+                        String(Ticker::N_FONTS - 1) + ", color=0xRRGGBB (not black), speed=1.." +
+                        String(Ticker::MAX_SPEED) + ", y=-1.." + String(N_ROWS - 1) + ", fps=1.." +
+                        String(Ticker::MAX_FPS) + ", loops (0 for ever), smooth=0|1";
+        Serial.println(error_message.c_str());
+        request->send(400, "text/plain", error_message.c_str());
+        return;
+    }
+    options.font = Ticker::font(font);
+    options.speed = speed;
+    options.y = y;
+    options.fps = fps;
+    options.loops = loops;
+    options.smooth = !request->hasParam("smooth") || request->getParam("smooth")->value() != "0";
+    const char *error = task_draw_matrix.ticker.start(text.c_str(), options, millis());
+    if (error) {
+        Serial.println(error);
+        request->send(400, "text/plain", error);
+        return;
+    }
+    request->send(200, "text/plain", "Scrolling " + String(task_draw_matrix.ticker.stats().columns) + " columns");
+}
+
+// --------------------------------------------------------------------------------------
+void App::handle_ticker_stop(AsyncWebServerRequest *request) {
+    task_draw_matrix.ticker.stop();
+    task_draw_matrix.refresh();
+    request->send(200, "text/plain", "Ticker stopped");
+}
+
+// --------------------------------------------------------------------------------------
+void App::handle_transition(AsyncWebServerRequest *request) {
+    Transition::Kind kind = m_transition_kind;
+    uint16_t duration_ms = m_transition_ms;
+    if (!transition_args(request, kind, duration_ms)) {
+        String error_message = "Invalid arguments: transition=none|crossfade|wipe|dissolve, ms=1.." +
+                               String(Transition::MAX_DURATION_MS);
+        Serial.println(error_message.c_str());
+        request->send(400, "text/plain", error_message.c_str());
+        return;
+    }
+    m_transition_kind = kind;
+    m_transition_ms = duration_ms;
+    request->send(200, "text/plain",
+                  "Transition: " + String(Transition::name(kind)) + ", " + String(duration_ms) + " ms");
+}
+
+// --------------------------------------------------------------------------------------
 void App::handle_set_alarm(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
     String error_message;
     
@@ -677,7 +1570,10 @@ DrawMatrix::DrawMatrix()
     : matrix(MATRIX_WIDTH, MATRIX_HEIGHT, N_TILES_X, N_TILES_Y, (uint8_t)ws2812_pin,
              (uint8_t)(NEO_TILE_TOP + NEO_TILE_RIGHT + NEO_TILE_COLUMNS + NEO_MATRIX_TOP + NEO_MATRIX_LEFT +
                        NEO_MATRIX_ROWS),
-             (neoPixelType)(NEO_GRB + NEO_KHZ800)) {
+             (neoPixelType)(NEO_GRB + NEO_KHZ800)),
+      scene(N_COLS, N_ROWS), indexed(N_PIXELS), player(scene.canvas, N_COLS, N_ROWS),
+      gif(scene.canvas, N_COLS, N_ROWS), effects(scene.canvas), ticker(scene.overlay),
+      history(scene.canvas, UNDO_BUDGET), transition(scene) {
     matrix.begin();                       // Initialize the NeoPixel strip
     matrix.setBrightness(MIN_BRIGHTNESS); // Set brightness to 15 (0-255)
     matrix.clear();                       // Clear the strip
@@ -687,13 +1583,16 @@ DrawMatrix::DrawMatrix()
 // --------------------------------------------------------------------------------------
 void DrawMatrix::set_brightness(uint8_t brightness) {
     matrix.setBrightness(brightness);
-    matrix.show();
+    scene.invalidate(); // Recomposite at the new scale rather than rescaling the strip buffer (lossy)
+    refresh();          // Not a new frame: a running transition goes on, and the checkpoint stores brightness anyway
 }
 
 // --------------------------------------------------------------------------------------
 void DrawMatrix::set_color(uint32_t color) {
-    matrix.fill(color, 0, N_PIXELS); // Fill the matrix with the specified color
-    matrix.show();
+    release_canvas();
+    history.begin();
+    scene.canvas.fill(color >> 16, color >> 8, color); // Fill the matrix with the specified color
+    show();
     this->color = color;
 }
 
@@ -709,14 +1608,7 @@ inline uint16_t prev_pixel(uint16_t pixel, uint16_t less_pixels = 1) {
 
 // --------------------------------------------------------------------------------------
 void DrawMatrix::execute(uint64_t t, uint64_t &d, bool &repeat) {
-    // static uint16_t p = 0;  // Current pixel index
-
-    // if (!matrix.canShow()) {
-    //     Serial.println("Matrix not ready to show, skipping update");
-    //     return;  // If the matrix is not ready to show, skip the update
-    // }
-    // matrix.fill(matrix.ColorHSV(p += 20, 255, 255), 0, N_PIXELS);  // Fill the matrix with a color based on hue
-    // matrix.show();
+    // Procedural content (rainbow and the like) is rendered by Effects::Engine, from the animation task
 }
 
 // --------------------------------------------------------------------------------------
@@ -759,25 +1651,131 @@ inline constexpr size_t pixel_index(size_t col, size_t row) {
 // --------------------------------------------------------------------------------------
 void DrawMatrix::set_matrix(uint32_t matrix_disp[N_COLS][N_ROWS]) {
     // Serial.println("Setting matrix from arrays");
+    release_canvas();
+    history.begin();
     for (int col = 0; col < N_COLS; col++) {
         for (int row = 0; row < N_ROWS; row++) {
             uint32_t color = matrix_disp[col][row];
-            matrix.setPixelColor(pixel_index(col, row), color);
+            scene.canvas.set(row * N_COLS + col, color >> 16, color >> 8, color);
         }
     }
-    matrix.show();
+    show();
 }
 
 // --------------------------------------------------------------------------------------
 void DrawMatrix::set_matrix(const JsonDocument &matrix_disp) {
     // Serial.println("Setting matrix from JSON document");
+    release_canvas();
+    history.begin();
     for (size_t col = 0; col < N_COLS; col++) {
         for (size_t row = 0; row < N_ROWS; row++) {
             uint32_t rgb = matrix_disp[col][row].as<uint32_t>();
-            matrix.setPixelColor(pixel_index(col, row), rgb);
+            scene.canvas.set(row * N_COLS + col, rgb >> 16, rgb >> 8, rgb);
         }
     }
+    show();
+}
+
+// --------------------------------------------------------------------------------------
+void DrawMatrix::show_indexed() {
+    if (!indexed.active()) {
+        return;
+    }
+    // Only the pixels whose colour changed since the last expansion (palette cycling) are recomposited
+    indexed.expand([this](size_t i, const uint8_t *rgb) { scene.canvas.set(i, rgb[0], rgb[1], rgb[2]); });
+    show();
+}
+
+// --------------------------------------------------------------------------------------
+void DrawMatrix::refresh() {
+    const uint32_t start = micros();
+    const bool blending = transition.running();
+    // Brightness is applied here: the layers keep full-scale colours
+    scene.compose([this, blending](size_t i, const uint8_t *rgb) {
+        uint8_t mixed[3];
+        if (blending) {
+            transition.mix(i, rgb, mixed);
+            rgb = mixed;
+        }
+        matrix.setPixelColor(pixel_index(i % N_COLS, i / N_COLS), rgb[0], rgb[1], rgb[2]);
+    });
     matrix.show();
+    if (blending) {
+        transition.presented(micros() - start);
+    }
+}
+
+// --------------------------------------------------------------------------------------
+void DrawMatrix::show() {
+    history.commit();
+    if (transition_target) {
+        transition_target = false;
+    } else {
+        transition.cancel(); // Any later frame arrives mid-transition: cut to it
+    }
+    refresh();
+    frame_seq++;
+}
+
+// --------------------------------------------------------------------------------------
+void DrawMatrix::transition_to(Transition::Kind kind, uint16_t duration_ms, bool new_frame) {
+    const char *error = transition.start(kind, duration_ms);
+    if (error) {
+        Serial.println(error); // The change is a cut
+    }
+    transition_target = new_frame && transition.running();
+}
+
+// --------------------------------------------------------------------------------------
+void DrawMatrix::release_canvas() {
+    indexed.end();
+    stop_renderers();
+}
+
+// --------------------------------------------------------------------------------------
+void DrawMatrix::stop_renderers() {
+    player.stop();
+    gif.stop();
+    effects.stop();
+}
+
+// --------------------------------------------------------------------------------------
+void App::publish_mirror() {
+    uint8_t *rgb = m_mirror.frame();
+    if (!rgb) {
+        return; // Nobody watching
+    }
+    // Viewers want the picture, not the strip: the composite in logical order, before brightness scaling
+    for (size_t i = 0; i < N_PIXELS; i++, rgb += 3) {
+        task_draw_matrix.scene.pixel(i, rgb);
+    }
+    m_mirror.publish();
+}
+
+// --------------------------------------------------------------------------------------
+void App::write_pixels(size_t first, const uint8_t *rgb, size_t count) {
+    task_draw_matrix.release_canvas(); // Streamed content replaces the indexed frame or animation
+    task_draw_matrix.scene.canvas.write(first, rgb, count);
+}
+
+// --------------------------------------------------------------------------------------
+bool App::write_commands(const uint8_t *data, size_t len, bool start, bool end) {
+    task_draw_matrix.release_canvas();
+    if (start) {
+        task_draw_matrix.history.begin(); // Committed when present() shows it
+        m_socket_commands.begin();
+    }
+    const char *error = m_socket_commands.feed(data, len) ? nullptr : m_socket_commands.error();
+    if (!error && end && !m_socket_commands.complete()) {
+        error = "Draw command is truncated";
+    }
+    if (error) {
+        // What ran before the error stays drawn, as on /draw_commands; the message is not counted as a frame
+        task_draw_matrix.show();
+        Serial.println(error);
+        return false;
+    }
+    return true;
 }
 
 } // namespace ServerSys
@@ -20,9 +20,26 @@
 #include <list>
 #include <cstdint>
 
+#include "Animation.hpp"
+#include "Autosave.hpp"
+#include "Compositor.hpp"
+#include "DrawCommands.hpp"
+#include "Effects.hpp"
+#include "FrameInput.hpp"
+#include "FrameMirror.hpp"
+#include "Gallery.hpp"
+#include "Gif.hpp"
+#include "History.hpp"
+#include "JitterBuffer.hpp"
 #include "IMatrixApp.hpp"
 #include "IServer.hpp"
 #include "ITask.hpp"
+#include "Palette.hpp"
+#include "Qoi.hpp"
+#include "Snapshot.hpp"
+#include "Ticker.hpp"
+#include "Transition.hpp"
+#include "RtcState.hpp"
 
 namespace ServerSys {
 
@@ -41,6 +58,9 @@ constexpr size_t N_COLS = MATRIX_WIDTH * N_TILES_X;
 constexpr size_t N_ROWS = MATRIX_HEIGHT * N_TILES_Y;
 // Total number of pixels (N_COLS * N_ROWS)
 constexpr size_t N_PIXELS = N_COLS * N_ROWS;
+// Bytes of undo history: 5 per pixel an edit changes, plus 4 per edit (a repaint of every pixel takes 3.8 KB); 0
+// disables undo
+constexpr size_t UNDO_BUDGET = 6144;
 
 /**
  * @brief Task for blinking a heartbeat LED.
@@ -113,7 +133,51 @@ struct DrawMatrix : public ITask {
      */
     void set_matrix(const JsonDocument &matrix_disp);
 
+    /**
+     * @brief Expand the indexed frame through its palette onto the canvas, and show it.
+     */
+    void show_indexed();
+
+    /**
+     * @brief Composite the changed regions of the scene into the strip buffer (through the pixel map) and push it.
+     */
+    void refresh();
+
+    /**
+     * @brief Refresh and count it as a new user frame (checkpointed on warm restarts). A frame shown while a
+     * transition runs cuts to it, unless it is the target the transition was started for.
+     */
+    void show();
+
+    /**
+     * @brief Blend from what shows now to what the layers show next, instead of cutting to it.
+     * @param new_frame The caller shows a new frame next, as the target; otherwise the target is a change of the upper
+     * layers, and any frame shown meanwhile cancels the transition.
+     */
+    void transition_to(Transition::Kind kind, uint16_t duration_ms, bool new_frame);
+
+    /**
+     * @brief Stop whatever draws on the canvas (indexed frame, animation) before other content replaces it.
+     */
+    void release_canvas();
+
+    /**
+     * @brief Stop the sources that render into the canvas on their own (animations, effects); release_canvas() minus
+     * the indexed frame, for content that becomes the indexed frame.
+     */
+    void stop_renderers();
+
     Adafruit_NeoMatrix matrix;
+    Compositor::Scene scene;       // What is shown: user canvas, clock and overlay; the strip buffer is its output
+    Palette::IndexedFrame indexed; // Source of the canvas while indexed mode is active; RGB content ends it
+    Animation::Player player;      // Source of the canvas while an animation plays; other content stops it
+    Gif::Player gif;               // Same for GIF animations
+    Effects::Engine effects;       // Same for procedural effects
+    Ticker::Scroller ticker;       // Scrolling text on the overlay, over whatever the canvas shows
+    History::Journal history;      // Undo/redo of user edits; show() commits the edit being recorded
+    Transition::Engine transition; // Mixes every composite with the previous picture while it runs
+    bool transition_target = false; // The next show() brings the running transition's target
+    uint32_t frame_seq = 0; // Bumped on every user frame; lets the checkpoint skip re-encoding unchanged frames
     uint8_t hue;
     uint32_t color;
     uint8_t pixel;
@@ -122,7 +186,7 @@ struct DrawMatrix : public ITask {
 /**
  * @brief Main application class for DrawMatrix server.
  */
-class App : public IMatrixApp {
+class App : public IMatrixApp, public FrameInput::Sink {
   public:
     /**
      * @brief Construct the App.
@@ -211,12 +275,223 @@ class App : public IMatrixApp {
      */
     virtual void handle_modify_alarm(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total);
 
+    /**
+     * @brief Handle palette cycling requests (indexed mode).
+     */
+    virtual void handle_set_palette_cycle(AsyncWebServerRequest *request);
+
+    /**
+     * @brief Handle requests for an image of what the display shows, or of the canvas alone (GIF or BMP, optionally
+     * scaled up).
+     */
+    virtual void handle_snapshot(AsyncWebServerRequest *request);
+
+    /**
+     * @brief Handle QOI images, decoded onto the display as they arrive.
+     */
+    virtual void handle_set_display_image(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index,
+                                          size_t total);
+
+    /**
+     * @brief Handle GIF bodies, decoded onto the display as they arrive.
+     */
+    virtual void handle_set_display_gif(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index,
+                                        size_t total);
+
+    /**
+     * @brief Handle batches of drawing commands (DrawCommands.hpp), run on the display as they arrive.
+     */
+    virtual void handle_draw_commands(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index,
+                                      size_t total);
+
+    /**
+     * @brief Handle requests to revert the last edit.
+     */
+    virtual void handle_undo(AsyncWebServerRequest *request);
+
+    /**
+     * @brief Handle requests to apply the last edit undone again.
+     */
+    virtual void handle_redo(AsyncWebServerRequest *request);
+
+    /**
+     * @brief Handle requests for the list of gallery frames (JSON).
+     */
+    virtual void handle_gallery(AsyncWebServerRequest *request);
+
+    /**
+     * @brief Handle requests to store the canvas in the gallery under a name.
+     */
+    virtual void handle_gallery_save(AsyncWebServerRequest *request);
+
+    /**
+     * @brief Handle requests to show a gallery frame (by id or name), optionally with its own transition and ms.
+     */
+    virtual void handle_gallery_recall(AsyncWebServerRequest *request);
+
+    /**
+     * @brief Handle requests to delete a gallery frame (by id or name).
+     */
+    virtual void handle_gallery_delete(AsyncWebServerRequest *request);
+
+    /**
+     * @brief Handle requests for an image of a gallery frame (by id or name), as /snapshot sends the display.
+     */
+    virtual void handle_gallery_thumbnail(AsyncWebServerRequest *request);
+
+    /**
+     * @brief Handle animation file uploads (.dma or GIF), written to LittleFS as they arrive.
+     */
+    virtual void handle_animation_upload(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index,
+                                         size_t total);
+
+    /**
+     * @brief Handle requests to play a stored animation.
+     */
+    virtual void handle_animation_play(AsyncWebServerRequest *request);
+
+    /**
+     * @brief Handle requests to stop the animation.
+     */
+    virtual void handle_animation_stop(AsyncWebServerRequest *request);
+
+    /**
+     * @brief Handle requests to run a procedural effect (name, optional fps).
+     */
+    virtual void handle_effect(AsyncWebServerRequest *request);
+
+    /**
+     * @brief Handle requests to stop the effect.
+     */
+    virtual void handle_effect_stop(AsyncWebServerRequest *request);
+
+    /**
+     * @brief Handle requests to time every effect on the device: with `frames`, start timing them in the background;
+     * either way, reply with the state and the last results (JSON, microseconds per frame).
+     */
+    virtual void handle_effect_benchmark(AsyncWebServerRequest *request);
+
+    /**
+     * @brief Handle requests to scroll a message over the display (text, font, color, speed, y, fps, loops, smooth).
+     */
+    virtual void handle_ticker(AsyncWebServerRequest *request);
+
+    /**
+     * @brief Handle requests to remove the scrolling message.
+     */
+    virtual void handle_ticker_stop(AsyncWebServerRequest *request);
+
+    /**
+     * @brief Handle requests to set how the display changes between pictures (transition, ms); replies the setting.
+     */
+    virtual void handle_transition(AsyncWebServerRequest *request);
+
+    /**
+     * @brief Animation player state and counters, for /info.
+     */
+    const Animation::Player &animation() const { return task_draw_matrix.player; }
+    const Gif::Player &gif() const { return task_draw_matrix.gif; }
+    const Effects::Engine &effects() const { return task_draw_matrix.effects; }
+    const Ticker::Scroller &ticker() const { return task_draw_matrix.ticker; }
+    const Transition::Engine &transition() const { return task_draw_matrix.transition; }
+
+    /**
+     * @brief Drawing commands run since boot (HTTP and WebSocket), for /info.
+     */
+    uint32_t draw_commands() const { return m_draw_commands.executed() + m_socket_commands.executed(); }
+
+    /**
+     * @brief Undo history occupancy and counters, for /info.
+     */
+    const History::Stats &history() const { return task_draw_matrix.history.stats(); }
+
+    /**
+     * @brief Canvas autosave counters, for /info.
+     */
+    const Autosave::Stats &autosave() const { return m_autosave.stats(); }
+
+    /**
+     * @brief Gallery frames and recall timings, for /info.
+     */
+    const Gallery::Store &gallery() const { return m_gallery; }
+
     /**
      * @brief Enable or disable clock mode.
      * @param enable True to enable clock mode, false to disable.
      */
     void clock_mode(bool enable);
 
+    /**
+     * @brief WebSocket handler streaming the display to viewers; register it with the server.
+     */
+    AsyncWebHandler &mirror_handler() { return m_mirror.handler(); }
+
+    /**
+     * @brief Live mirror counters and viewer count, for /info.
+     */
+    const FrameMirror::Broadcaster &mirror() const { return m_mirror; }
+
+    /**
+     * @brief UDP frame input (DDP, E1.31) counters, for /info.
+     */
+    const FrameInput::Receiver &frame_input() const { return m_frame_input; }
+
+    /**
+     * @brief WebSocket frame input; register it with the server.
+     */
+    AsyncWebHandler &frame_socket_handler() { return m_frame_socket.handler(); }
+
+    /**
+     * @brief WebSocket frame input counters, for /info.
+     */
+    const FrameInput::SocketReceiver &frame_socket() const { return m_frame_socket; }
+
+    /**
+     * @brief Whether a UDP or WebSocket stream completed a frame recently; a stream counts as display activity.
+     * @param idle_ms How recent.
+     */
+    bool streaming(uint32_t idle_ms) const;
+
+    /**
+     * @brief Whether an animation is playing; playback counts as display activity.
+     */
+    bool animating() const { return task_draw_matrix.player.playing() || task_draw_matrix.gif.playing(); }
+
+    /**
+     * @brief Timestamped stream counters (late, dropped...) and queue depth, for /info.
+     */
+    const JitterBuffer::Queue &jitter_buffer() const { return m_jitter_buffer; }
+
+    /**
+     * @brief Whether the display shows an indexed (palette) frame, for /info.
+     */
+    bool indexed_mode() const { return task_draw_matrix.indexed.active(); }
+
+    /**
+     * @brief Write streamed pixels (logical row-major RGB) to the display buffer through the pixel map.
+     */
+    void write_pixels(size_t first, const uint8_t *rgb, size_t count) override;
+
+    /**
+     * @brief Show the streamed frame on the next run(); frames arriving in between are merged.
+     */
+    void present() override;
+
+    /**
+     * @brief Run drawing commands sent over the WebSocket on the display buffer.
+     */
+    bool write_commands(const uint8_t *data, size_t len, bool start, bool end) override;
+
+    /**
+     * @brief Queue pixels of a timestamped frame in the jitter buffer.
+     */
+    void write_timed_pixels(uint32_t timecode, size_t first, const uint8_t *rgb, size_t count) override;
+
+    /**
+     * @brief Schedule the timestamped frame for its presentation time.
+     */
+    void present_at(uint32_t timecode) override;
+
   private:
     /**
      * @brief Save all alarms to file
@@ -224,6 +499,53 @@ class App : public IMatrixApp {
      */
     bool save_alarms_to_file();
 
+    /**
+     * @brief Restore brightness, frame, clock mode and time base from RTC memory after a warm reset.
+     */
+    void restore_checkpoint();
+
+    /**
+     * @brief Write the current display state and time to RTC memory.
+     */
+    void checkpoint();
+
+    /**
+     * @brief Local epoch time (s): NTP once synced, otherwise the restored time base, 0 if unknown.
+     */
+    uint32_t local_epoch() const;
+
+    /**
+     * @brief Copy the display (logical order, without brightness scaling) to the mirror and publish it.
+     */
+    void publish_mirror();
+
+    /**
+     * @brief Receive an indexed frame or palette (Palette::CONTENT_TYPE body) for handle_set_display_matrix.
+     */
+    void upload_indexed(AsyncWebServerRequest *request, const uint8_t *data, size_t len, size_t index, size_t total);
+
+    /**
+     * @brief Send an image of `source` in the format and scale the request asks for (handle_snapshot's arguments).
+     */
+    void send_image(AsyncWebServerRequest *request, Snapshot::Source source);
+
+    /**
+     * @brief The gallery frame named by the request's `id` or `name` argument, nullptr if there is none.
+     */
+    const Gallery::Entry *gallery_entry(AsyncWebServerRequest *request) const;
+
+    /**
+     * @brief Read the request's `transition` and `ms` arguments, leaving out the missing ones.
+     * @return false if one is invalid.
+     */
+    bool transition_args(AsyncWebServerRequest *request, Transition::Kind &kind, uint16_t &duration_ms) const;
+
+    /**
+     * @brief Time one frame of the effect benchmark under way; run from its own task, a frame per call.
+     * @return Whether frames are left.
+     */
+    bool effect_benchmark_step();
+
   private:
     /**
      * @brief Structure to hold alarm configuration
@@ -245,9 +567,51 @@ class App : public IMatrixApp {
     HeartBeatBlink task_heart_beat_blink;
     DrawMatrix task_draw_matrix;
     bool m_status_led_state;
-    bool m_clock_mode;
+    bool m_clock_mode = false;
     std::list<AlarmConfig> m_alarms;
     std::function<void()> m_alarm_callback;
+    RtcState::Snapshot m_checkpoint;   // Last state written to RTC memory
+    uint32_t m_checkpoint_seq = 0;     // DrawMatrix::frame_seq encoded in m_checkpoint
+    uint32_t m_restored_epoch = 0;     // Epoch recovered from RTC memory, used until NTP syncs
+    uint32_t m_restored_millis = 0;    // millis() when m_restored_epoch was recovered
+    Autosave::Saver m_autosave;        // Canvas kept in flash across power cycles
+    Gallery::Store m_gallery;          // Named frames kept in flash
+    Transition::Kind m_transition_kind = Transition::Kind::CROSSFADE; // Between gallery frames and the clock
+    uint16_t m_transition_ms = Transition::DEFAULT_DURATION_MS;
+    FrameMirror::Broadcaster m_mirror; // Live display stream for viewer phones
+    FrameInput::Receiver m_frame_input; // Frames streamed by lighting software
+    bool m_present_pending = false;    // A streamed frame waits for run() to show it
+    JitterBuffer::Queue m_jitter_buffer; // Timestamped frames waiting for their time
+    FrameInput::SocketReceiver m_frame_socket; // Frames sent by browsers
+    Heatshrink::FrameStream m_upload_stream;   // Compressed frame being POSTed
+    Qoi::Decoder m_image_upload;               // QOI image being POSTed
+    const char *m_image_error = nullptr;       // Why it is rejected
+    bool m_image_drawn = false;                // Its header was accepted: the canvas was cleared for it
+    DrawCommands::Interpreter m_draw_commands;   // Command batch being POSTed
+    DrawCommands::Interpreter m_socket_commands; // Command batch arriving over the WebSocket
+    size_t m_indexed_palette_end = 0;          // Upload offset where the index plane starts
+    const char *m_indexed_error = nullptr;     // Why the indexed upload being received is rejected
+    struct {
+        uint8_t first = 0;
+        uint16_t count = 0;
+        bool reverse = false;
+        uint32_t period_ms = 0; // 0: not cycling
+    } m_palette_cycle;
+    struct {
+        std::unique_ptr<uint8_t[]> scratch; // Frame rendered into, allocated while a run is under way
+        uint8_t frames = 0;                 // Per effect
+        uint8_t step = 0;                   // Effect being timed, then the batch and per-pixel HSV conversions
+        uint8_t frame = 0;
+        uint32_t total_us[Effects::N_KINDS + 2] = {};
+        bool done = false; // total_us holds a complete run
+    } m_effect_benchmark;
+    File m_animation_upload;                   // Animation file being POSTed (temporary name)
+    String m_animation_name;                   // Its name
+    bool m_animation_gif = false;              // Its format: GIF or .dma
+    const char *m_animation_error = nullptr;   // Why it is rejected
+    std::unique_ptr<Gif::Decoder> m_gif_upload; // GIF body being decoded onto the display
+    const char *m_gif_error = nullptr;
+    bool m_gif_shown = false;                   // A frame of it was shown
 };
 
 } // namespace ServerSys
@@ -0,0 +1,229 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      Snapshot.cpp                                                                                             *
+ * @brief     What the display shows, encoded as GIF or BMP a few bytes at a time                                      *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#include "Snapshot.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace Snapshot {
+namespace {
+constexpr size_t BMP_HEADER_SIZE = 54;
+constexpr size_t GIF_SCREEN_SIZE = 13;
+constexpr size_t GIF_PALETTE_SIZE = 256 * 3;
+constexpr size_t GIF_DESCRIPTOR_SIZE = 11; // Image descriptor and LZW minimum code size
+constexpr uint8_t GIF_MIN_CODE_SIZE = 8;
+constexpr uint8_t GIF_CODE_BITS = GIF_MIN_CODE_SIZE + 1;
+constexpr uint16_t GIF_CLEAR = 1 << GIF_MIN_CODE_SIZE;
+constexpr uint16_t GIF_END = GIF_CLEAR + 1;
+// Literals between clear codes: the decoder's dictionary then stops one entry short of needing 10-bit codes
+constexpr size_t GIF_LITERALS_PER_CLEAR = (1 << GIF_CODE_BITS) - GIF_CLEAR - 2;
+constexpr size_t GIF_SUB_BLOCK = 255;
+
+// --------------------------------------------------------------------------------------
+inline void put16(uint8_t *p, uint32_t v) {
+    p[0] = v & 0xFF;
+    p[1] = (v >> 8) & 0xFF;
+}
+
+// --------------------------------------------------------------------------------------
+inline void put32(uint8_t *p, uint32_t v) {
+    put16(p, v);
+    put16(p + 2, v >> 16);
+}
+
+// --------------------------------------------------------------------------------------
+inline uint32_t pack(const uint8_t rgb[3]) { return (rgb[0] << 16) | (rgb[1] << 8) | rgb[2]; }
+} // namespace
+
+// --------------------------------------------------------------------------------------
+const char *content_type(Format format) { return format == Format::GIF ? "image/gif" : "image/bmp"; }
+
+// --------------------------------------------------------------------------------------
+Encoder::Encoder(Source source, uint16_t width, uint16_t height, Format format, uint8_t scale)
+    : m_source(std::move(source)), m_width(width), m_height(height), m_format(format), m_scale(scale),
+      m_out_width(static_cast<uint32_t>(width) * scale), m_out_height(static_cast<uint32_t>(height) * scale) {
+    if (format == Format::BMP) {
+        m_size = BMP_HEADER_SIZE + ((m_out_width * 3 + 3) & ~3u) * m_out_height;
+        return;
+    }
+
+    // Palette: the colours of the frame, sorted for lookups, unless there are too many
+    const size_t n_pixels = static_cast<size_t>(width) * height;
+    uint8_t rgb[3];
+    for (size_t i = 0; i < n_pixels && !m_rgb332; i++) {
+        m_source(i, rgb);
+        const uint32_t color = pack(rgb);
+        uint32_t *end = m_colors + m_n_colors;
+        uint32_t *at = std::lower_bound(m_colors, end, color);
+        if (at != end && *at == color) {
+            continue;
+        }
+        if (m_n_colors == 256) {
+            m_rgb332 = true;
+            break;
+        }
+        memmove(at + 1, at, (end - at) * sizeof(uint32_t));
+        *at = color;
+        m_n_colors++;
+    }
+
+    const size_t n_out = static_cast<size_t>(m_out_width) * m_out_height;
+    m_n_codes = n_out + (n_out + GIF_LITERALS_PER_CLEAR - 1) / GIF_LITERALS_PER_CLEAR + 1;
+    m_data_size = (m_n_codes * GIF_CODE_BITS + 7) / 8;
+    m_header_size = GIF_SCREEN_SIZE + GIF_PALETTE_SIZE + GIF_DESCRIPTOR_SIZE;
+    m_size = m_header_size + m_data_size + (m_data_size + GIF_SUB_BLOCK - 1) / GIF_SUB_BLOCK + 2;
+}
+
+// --------------------------------------------------------------------------------------
+size_t Encoder::read(uint8_t *out, size_t max_len) {
+    size_t n = 0;
+    for (; n < max_len && m_pos < m_size; n++, m_pos++) {
+        out[n] = m_format == Format::GIF ? gif_byte(m_pos) : bmp_byte(m_pos);
+    }
+    return n;
+}
+
+// --------------------------------------------------------------------------------------
+const uint8_t *Encoder::pixel(uint32_t x, uint32_t y) {
+    const size_t i = static_cast<size_t>(y / m_scale) * m_width + x / m_scale;
+    if (i != m_cached) {
+        m_source(i, m_rgb);
+        m_cached = i;
+    }
+    return m_rgb;
+}
+
+// --------------------------------------------------------------------------------------
+uint8_t Encoder::bmp_byte(size_t pos) {
+    if (pos < BMP_HEADER_SIZE) {
+        uint8_t header[BMP_HEADER_SIZE] = {'B', 'M'};
+        put32(header + 2, m_size);
+        put32(header + 10, BMP_HEADER_SIZE);
+        put32(header + 14, 40); // BITMAPINFOHEADER
+        put32(header + 18, m_out_width);
+        put32(header + 22, m_out_height); // Positive: rows bottom-up
+        put16(header + 26, 1);
+        put16(header + 28, 24);
+        put32(header + 34, m_size - BMP_HEADER_SIZE);
+        put32(header + 38, 2835); // 72 dpi
+        put32(header + 42, 2835);
+        return header[pos];
+    }
+    const size_t row_bytes = (m_out_width * 3 + 3) & ~3u;
+    const size_t offset = pos - BMP_HEADER_SIZE;
+    const size_t col = offset % row_bytes;
+    if (col >= m_out_width * 3) {
+        return 0; // Row padding
+    }
+    const uint32_t y = m_out_height - 1 - offset / row_bytes;
+    return pixel(col / 3, y)[2 - col % 3]; // BGR
+}
+
+// --------------------------------------------------------------------------------------
+uint8_t Encoder::gif_byte(size_t pos) {
+    if (pos < GIF_SCREEN_SIZE) {
+        uint8_t screen[GIF_SCREEN_SIZE] = {'G', 'I', 'F', '8', '9', 'a'};
+        put16(screen + 6, m_out_width);
+        put16(screen + 8, m_out_height);
+        screen[10] = 0xF7; // Global colour table of 256 entries, 8 bits per primary
+        return screen[pos];
+    }
+    pos -= GIF_SCREEN_SIZE;
+    if (pos < GIF_PALETTE_SIZE) {
+        const size_t entry = pos / 3;
+        const size_t primary = pos % 3;
+        if (m_rgb332) {
+            static constexpr uint8_t shift[3] = {5, 2, 0};
+            static constexpr uint8_t mask[3] = {7, 7, 3};
+            return ((entry >> shift[primary]) & mask[primary]) * 255 / mask[primary];
+        }
+        return entry < m_n_colors ? (m_colors[entry] >> (16 - 8 * primary)) & 0xFF : 0;
+    }
+    pos -= GIF_PALETTE_SIZE;
+    if (pos < GIF_DESCRIPTOR_SIZE) {
+        uint8_t descriptor[GIF_DESCRIPTOR_SIZE] = {0x2C};
+        put16(descriptor + 5, m_out_width);
+        put16(descriptor + 7, m_out_height);
+        descriptor[10] = GIF_MIN_CODE_SIZE;
+        return descriptor[pos];
+    }
+    pos -= GIF_DESCRIPTOR_SIZE;
+
+    // Sub-blocks: a length byte, then up to 255 LZW bytes
+    const size_t blocks_size = m_data_size + (m_data_size + GIF_SUB_BLOCK - 1) / GIF_SUB_BLOCK;
+    if (pos < blocks_size) {
+        const size_t block = pos / (GIF_SUB_BLOCK + 1);
+        if (pos % (GIF_SUB_BLOCK + 1) == 0) {
+            const size_t left = m_data_size - block * GIF_SUB_BLOCK;
+            return left < GIF_SUB_BLOCK ? left : GIF_SUB_BLOCK;
+        }
+        return gif_data_byte();
+    }
+    return pos == blocks_size ? 0x00 : 0x3B; // Block terminator, trailer
+}
+
+// --------------------------------------------------------------------------------------
+uint8_t Encoder::gif_data_byte() {
+    // Bytes are asked for in order: codes are packed as they are needed, least significant bit first
+    while (m_n_bits < 8 && m_code < m_n_codes) {
+        m_bits |= static_cast<uint32_t>(gif_code(m_code++)) << m_n_bits;
+        m_n_bits += GIF_CODE_BITS;
+    }
+    const uint8_t byte = m_bits & 0xFF;
+    m_bits >>= 8;
+    m_n_bits = m_n_bits > 8 ? m_n_bits - 8 : 0;
+    return byte;
+}
+
+// --------------------------------------------------------------------------------------
+uint16_t Encoder::gif_code(size_t k) {
+    if (k == m_n_codes - 1) {
+        return GIF_END;
+    }
+    const size_t group = k / (GIF_LITERALS_PER_CLEAR + 1);
+    const size_t in_group = k % (GIF_LITERALS_PER_CLEAR + 1);
+    if (in_group == 0) {
+        return GIF_CLEAR;
+    }
+    const size_t n = group * GIF_LITERALS_PER_CLEAR + in_group - 1;
+    return gif_index(pixel(n % m_out_width, n / m_out_width));
+}
+
+// --------------------------------------------------------------------------------------
+uint8_t Encoder::gif_index(const uint8_t rgb[3]) const {
+    if (m_rgb332) {
+        return (rgb[0] & 0xE0) | ((rgb[1] >> 3) & 0x1C) | (rgb[2] >> 6);
+    }
+    const uint32_t color = pack(rgb);
+    const uint32_t *end = m_colors + m_n_colors;
+    const uint32_t *at = std::lower_bound(m_colors, end, color);
+    if (at != end && *at == color) {
+        return at - m_colors;
+    }
+    // Drawn after the palette was made (the source changed between two chunks): nearest colour
+    uint8_t best = 0;
+    uint32_t best_distance = UINT32_MAX;
+    for (uint16_t i = 0; i < m_n_colors; i++) {
+        const int dr = static_cast<int>((m_colors[i] >> 16) & 0xFF) - rgb[0];
+        const int dg = static_cast<int>((m_colors[i] >> 8) & 0xFF) - rgb[1];
+        const int db = static_cast<int>(m_colors[i] & 0xFF) - rgb[2];
+        const uint32_t distance = dr * dr + dg * dg + db * db;
+        if (distance < best_distance) {
+            best_distance = distance;
+            best = i;
+        }
+    }
+    return best;
+}
+
+} // namespace Snapshot
@@ -0,0 +1,108 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      Snapshot.hpp                                                                                             *
+ * @brief     What the display shows, encoded as GIF or BMP a few bytes at a time                                      *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#ifndef DRAWMATRIX_SNAPSHOT
+#define DRAWMATRIX_SNAPSHOT
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+/**
+ * @brief Image encoders that produce their output on demand (an AsyncWebServer chunked response filler) by reading
+ * their source (the composited scene, a stored frame) pixel by pixel: no image buffer, whatever the scale.
+ *
+ * GIFs use the frame's own colours when there are at most 256 of them, RGB 3-3-2 otherwise. Their LZW stream is
+ * "uncompressed": 9-bit literal codes with a clear code every 254 of them, so the dictionary never grows and the size
+ * is known in advance. A picture is a few KB, comparable to the BMP, and any browser shows it.
+ */
+namespace Snapshot {
+
+enum class Format : uint8_t { GIF, BMP };
+
+// Largest scale factor (256x192 for 32x24)
+constexpr uint8_t MAX_SCALE = 8;
+
+// Pixels to encode: `source(i, rgb)` sets rgb to the colour of logical pixel i
+using Source = std::function<void(size_t i, uint8_t rgb[3])>;
+
+/**
+ * @brief MIME type of a format.
+ */
+const char *content_type(Format format);
+
+class Encoder {
+  public:
+    /**
+     * @brief Prepare an image of the source as it is now (GIFs take their palette from it).
+     * @param source Pixels, e.g. what the display shows before brightness; must stay valid while encoding.
+     * @param width Width of the source.
+     * @param height Height of the source.
+     * @param format Output format.
+     * @param scale Each pixel becomes scale x scale pixels, 1 to MAX_SCALE.
+     */
+    Encoder(Source source, uint16_t width, uint16_t height, Format format, uint8_t scale);
+
+    /**
+     * @brief Produce the next bytes of the file.
+     * @return Bytes written, 0 once complete.
+     */
+    size_t read(uint8_t *out, size_t max_len);
+
+    /**
+     * @brief Size of the whole file.
+     */
+    size_t size() const { return m_size; }
+
+  private:
+    uint8_t bmp_byte(size_t pos);
+    uint8_t gif_byte(size_t pos);
+    uint8_t gif_data_byte();
+    uint16_t gif_code(size_t k);
+
+    /**
+     * @brief Palette index of a colour: exact when in the palette, otherwise the nearest entry.
+     */
+    uint8_t gif_index(const uint8_t rgb[3]) const;
+
+    /**
+     * @brief Colour of an output pixel (scaled coordinates); the last source pixel read is kept.
+     */
+    const uint8_t *pixel(uint32_t x, uint32_t y);
+
+    Source m_source;
+    uint16_t m_width;
+    uint16_t m_height;
+    Format m_format;
+    uint8_t m_scale;
+    uint32_t m_out_width;
+    uint32_t m_out_height;
+    size_t m_size = 0;
+    size_t m_pos = 0;
+
+    size_t m_cached = SIZE_MAX; // Source pixel in m_rgb
+    uint8_t m_rgb[3];
+
+    // GIF
+    uint32_t m_colors[256]; // 0xRRGGBB, sorted, when the frame has at most 256 colours
+    uint16_t m_n_colors = 0;
+    bool m_rgb332 = false;
+    size_t m_header_size = 0; // Bytes before the image data sub-blocks
+    size_t m_data_size = 0;   // LZW bytes, excluding the sub-block lengths
+    size_t m_n_codes = 0;
+    size_t m_code = 0; // Next code to pack
+    uint32_t m_bits = 0;
+    uint8_t m_n_bits = 0;
+};
+
+} // namespace Snapshot
+
+#endif /* DRAWMATRIX_SNAPSHOT */
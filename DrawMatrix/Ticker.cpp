@@ -0,0 +1,219 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      Ticker.cpp                                                                                               *
+ * @brief     Scrolling text on the overlay layer, rendered once into a column bitmap                                  *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#include "Ticker.hpp"
+
+#include <Arduino.h>
+#include <Fonts/FreeSans9pt7b.h>
+#include <Fonts/FreeSansBold9pt7b.h>
+#include <Fonts/Org_01.h>
+#include <Fonts/Picopixel.h>
+#include <Fonts/TomThumb.h>
+
+#include <cstring>
+#include <new>
+
+namespace Ticker {
+namespace {
+const GFXfont *const FONTS[N_FONTS] = {nullptr, &TomThumb, &Picopixel, &Org_01, &FreeSans9pt7b, &FreeSansBold9pt7b};
+
+// Rows a column holds (its bits)
+constexpr uint8_t MAX_ROWS = 32;
+
+/**
+ * @brief Adafruit_GFX surface over the column bitmap; with no bitmap yet, it only measures text.
+ */
+class ColumnBitmap : public Adafruit_GFX {
+  public:
+    ColumnBitmap() : Adafruit_GFX(MAX_COLUMNS, MAX_ROWS) {}
+
+    void target(uint8_t *bits, uint16_t columns, uint8_t rows, uint8_t column_bytes) {
+        m_bits = bits;
+        m_columns = columns;
+        m_rows = rows;
+        m_column_bytes = column_bytes;
+    }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t) override {
+        if (!m_bits || x < 0 || y < 0 || x >= m_columns || y >= m_rows) {
+            return;
+        }
+        m_bits[x * m_column_bytes + (y >> 3)] |= 1 << (y & 7);
+    }
+
+  private:
+    uint8_t *m_bits = nullptr;
+    uint16_t m_columns = 0;
+    uint8_t m_rows = 0;
+    uint8_t m_column_bytes = 0;
+};
+
+// --------------------------------------------------------------------------------------
+// RGB565 colour at level/256 of its intensity
+inline uint16_t dim(uint16_t color, uint16_t level) {
+    const uint16_t r = ((color >> 11) * level) >> 8;
+    const uint16_t g = (((color >> 5) & 0x3F) * level) >> 8;
+    const uint16_t b = ((color & 0x1F) * level) >> 8;
+    return (r << 11) | (g << 5) | b;
+}
+} // namespace
+
+// --------------------------------------------------------------------------------------
+const GFXfont *font(uint8_t index) { return index < N_FONTS ? FONTS[index] : nullptr; }
+
+// --------------------------------------------------------------------------------------
+Scroller::Scroller(Compositor::Layer &layer) : m_layer(layer), m_width(layer.width()), m_height(layer.height()) {}
+
+// --------------------------------------------------------------------------------------
+const char *Scroller::start(const char *text, const Options &options, uint32_t now_ms) {
+    const size_t len = strnlen(text, MAX_TEXT + 1);
+    if (!len || len > MAX_TEXT) {
+        return "The text must have 1 to 64 characters";
+    }
+    if (!options.fps || options.fps > MAX_FPS || !options.speed || options.speed > MAX_SPEED ||
+        options.color == Compositor::Layer::TRANSPARENT) {
+        return "Invalid ticker options";
+    }
+
+    const uint32_t start = micros();
+    ColumnBitmap bitmap;
+    bitmap.setFont(options.font);
+    bitmap.setTextWrap(false);
+    int16_t x1, y1;
+    uint16_t w, h;
+    bitmap.getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
+    if (!w) {
+        return "Nothing to show";
+    }
+    if (w > MAX_COLUMNS) {
+        return "The text is too wide";
+    }
+    // Rows beyond the display (or a column's bits) are cut off at the bottom
+    const uint8_t rows = h < m_height && h < MAX_ROWS ? h : m_height < MAX_ROWS ? m_height : MAX_ROWS;
+    const uint8_t column_bytes = (rows + 7) / 8;
+    std::unique_ptr<uint8_t[]> bits(new (std::nothrow) uint8_t[w * column_bytes]());
+    if (!bits || !m_layer.begin()) {
+        return "Not enough memory for the ticker";
+    }
+    bitmap.target(bits.get(), w, rows, column_bytes);
+    bitmap.setCursor(-x1, -y1); // The bounds' top-left corner lands on (0, 0)
+    bitmap.print(text);
+
+    m_bits = std::move(bits);
+    m_columns = w;
+    m_rows = rows;
+    m_column_bytes = column_bytes;
+    m_y = options.y < 0 ? (m_height - rows) / 2 : options.y;
+    m_options = options;
+    m_period_ms = 1000 / options.fps;
+    m_due_ms = m_last_ms = now_ms;
+    m_position = m_remainder = 0;
+    m_loop = 0;
+    m_layer.fillScreen(Compositor::Layer::TRANSPARENT); // The previous message
+    m_stats.columns = w;
+    m_stats.render_us = micros() - start;
+    m_stats.blit_max_us = 0;
+    return nullptr;
+}
+
+// --------------------------------------------------------------------------------------
+void Scroller::stop() {
+    if (!running()) {
+        return;
+    }
+    m_bits.reset();
+    m_stats.columns = 0;
+    m_layer.end();
+}
+
+// --------------------------------------------------------------------------------------
+bool Scroller::run(uint32_t now_ms, uint32_t &wait_ms) {
+    wait_ms = IDLE_POLL_MS;
+    if (!running()) {
+        return false;
+    }
+    const int32_t early = static_cast<int32_t>(m_due_ms - now_ms);
+    if (early > 0) {
+        wait_ms = static_cast<uint32_t>(early);
+        return false;
+    }
+
+    // Distance follows elapsed time, whatever the frame rate achieved; a stall of over a second is not caught up
+    const uint32_t elapsed_ms = now_ms - m_last_ms < 1000 ? now_ms - m_last_ms : 1000;
+    m_last_ms = now_ms;
+    m_remainder += elapsed_ms * m_options.speed * 256;
+    m_position += m_remainder / 1000;
+    m_remainder %= 1000;
+    // A pass runs from the message's first column entering on the right to its last one leaving on the left
+    const uint32_t pass = static_cast<uint32_t>(m_columns + m_width) << 8;
+    if (m_position >= pass) {
+        if (m_options.loops && ++m_loop >= m_options.loops) {
+            stop();
+            return true;
+        }
+        m_position %= pass;
+    }
+
+    const uint32_t start = micros();
+    blit();
+    m_stats.blit_us = micros() - start;
+    m_stats.blit_max_us = m_stats.blit_us > m_stats.blit_max_us ? m_stats.blit_us : m_stats.blit_max_us;
+    m_stats.frames++;
+
+    m_due_ms += m_period_ms;
+    if (static_cast<int32_t>(m_due_ms - now_ms) <= 0) {
+        m_due_ms = now_ms + m_period_ms;
+    }
+    const int32_t left = static_cast<int32_t>(m_due_ms - millis());
+    wait_ms = left > 0 ? static_cast<uint32_t>(left) : 0;
+    return true;
+}
+
+// --------------------------------------------------------------------------------------
+uint32_t Scroller::column(int32_t c) const {
+    if (c < 0 || c >= m_columns) {
+        return 0;
+    }
+    const uint8_t *bytes = m_bits.get() + c * m_column_bytes;
+    uint32_t value = 0;
+    for (uint8_t k = 0; k < m_column_bytes; k++) {
+        value |= static_cast<uint32_t>(bytes[k]) << (8 * k);
+    }
+    return value;
+}
+
+// --------------------------------------------------------------------------------------
+void Scroller::blit() {
+    m_layer.fillScreen(Compositor::Layer::TRANSPARENT);
+
+    // Display column x shows message column first + x, plus `fraction` of the next one
+    const int32_t first = static_cast<int32_t>(m_position >> 8) - m_width;
+    const uint16_t fraction = m_options.smooth ? m_position & 0xFF : 0;
+    const uint16_t full = m_options.color;
+    const uint16_t trailing = fraction ? dim(full, 256 - fraction) : full;
+    const uint16_t leading = dim(full, fraction);
+    uint32_t next = column(first);
+    for (uint16_t x = 0; x < m_width; x++) {
+        const uint32_t current = next;
+        next = column(first + x + 1);
+        const uint32_t lit = current | (fraction ? next : 0);
+        for (uint8_t row = 0; row < m_rows; row++) {
+            if (!(lit >> row & 1)) {
+                continue;
+            }
+            const bool here = current >> row & 1;
+            const bool after = fraction && (next >> row & 1);
+            m_layer.drawPixel(x, m_y + row, here && after ? full : here ? trailing : leading);
+        }
+    }
+}
+
+} // namespace Ticker
@@ -0,0 +1,142 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      Ticker.hpp                                                                                               *
+ * @brief     Scrolling text on the overlay layer, rendered once into a column bitmap                                  *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#ifndef DRAWMATRIX_TICKER
+#define DRAWMATRIX_TICKER
+
+#include <Adafruit_GFX.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "Compositor.hpp"
+
+/**
+ * @brief The message is drawn once, with any Adafruit_GFX font, into a bitmap of one bit per pixel stored column by
+ * column (the band's height rounded up to bytes per column). A frame is then a window of display-width columns read
+ * from it: the cost depends on the display, not on the font or the length of the message.
+ *
+ * The position advances with time at `speed` pixels per second, in 1/256 pixel steps. With `smooth`, the fraction
+ * blends each lit pixel between its two neighbouring columns, so motion stays even when the speed is not a multiple of
+ * the frame rate. The ticker draws on the overlay, above the canvas and the clock, whatever shows underneath.
+ */
+namespace Ticker {
+
+// Longest message, in characters
+constexpr size_t MAX_TEXT = 64;
+// Widest rendered message, in pixels
+constexpr uint16_t MAX_COLUMNS = 1024;
+// Frame rate used when none is requested
+constexpr uint8_t DEFAULT_FPS = 40;
+// Highest frame rate accepted
+constexpr uint8_t MAX_FPS = 100;
+// Scrolling speed used when none is requested, in pixels per second
+constexpr uint16_t DEFAULT_SPEED = 20;
+// Fastest scrolling accepted
+constexpr uint16_t MAX_SPEED = 1000;
+// How often the ticker looks for work while stopped
+constexpr uint32_t IDLE_POLL_MS = 100;
+
+// Fonts selectable by index: 0 the classic 6x8 font, 1 TomThumb, 2 Picopixel, 3 Org_01, 4 FreeSans9pt7b,
+// 5 FreeSansBold9pt7b
+constexpr uint8_t N_FONTS = 6;
+
+/**
+ * @brief Font with the given index, nullptr for the classic font.
+ */
+const GFXfont *font(uint8_t index);
+
+struct Options {
+    const GFXfont *font = nullptr;  ///< nullptr for the classic font
+    uint16_t color = 0xFFFF;        ///< RGB565; must not be Compositor::Layer::TRANSPARENT
+    uint16_t speed = DEFAULT_SPEED; ///< Pixels per second, 1 to MAX_SPEED
+    int16_t y = -1;                 ///< Top row of the text, -1 to centre it
+    uint8_t fps = DEFAULT_FPS;      ///< Frame rate, 1 to MAX_FPS
+    uint16_t loops = 0;             ///< Times the message goes by, 0 for ever
+    bool smooth = true;             ///< Blend between columns at sub-pixel positions
+};
+
+/**
+ * @brief Counters, for /info.
+ */
+struct Stats {
+    uint32_t frames = 0;      ///< Frames drawn since boot
+    uint16_t columns = 0;     ///< Width of the current message
+    uint32_t render_us = 0;   ///< Time the current message took to render into the bitmap
+    uint32_t blit_us = 0;     ///< Time the last frame took to draw
+    uint32_t blit_max_us = 0; ///< Slowest frame of the current message
+};
+
+class Scroller {
+  public:
+    /**
+     * @brief Construct a stopped ticker.
+     * @param layer Where it draws; activated while the ticker runs. Must outlive the ticker.
+     */
+    explicit Scroller(Compositor::Layer &layer);
+
+    /**
+     * @brief Render a message and start scrolling it in from the right; replaces the current one.
+     * @param now_ms Current millis(); the first frame is due now.
+     * @return nullptr on success, otherwise why it cannot run.
+     */
+    const char *start(const char *text, const Options &options, uint32_t now_ms);
+
+    /**
+     * @brief Stop and free the bitmap and the layer; the caller refreshes the display.
+     */
+    void stop();
+
+    bool running() const { return static_cast<bool>(m_bits); }
+
+    /**
+     * @brief Draw the frame due (if any) on the layer; call from the scheduler.
+     * @param now_ms Current millis().
+     * @param wait_ms Set to the milliseconds until the next frame is due.
+     * @return Whether the layer changed (the display needs refreshing).
+     */
+    bool run(uint32_t now_ms, uint32_t &wait_ms);
+
+    const Stats &stats() const { return m_stats; }
+
+  private:
+    /**
+     * @brief Bits of column c of the message, bit k for row k of the band; 0 outside the message.
+     */
+    uint32_t column(int32_t c) const;
+
+    /**
+     * @brief Draw the window at the current position.
+     */
+    void blit();
+
+    Compositor::Layer &m_layer;
+    uint16_t m_width;
+    uint16_t m_height;
+    std::unique_ptr<uint8_t[]> m_bits; // Column after column, m_column_bytes each
+    uint16_t m_columns = 0;
+    uint8_t m_rows = 0; // Height of the band
+    uint8_t m_column_bytes = 0;
+    int16_t m_y = 0; // Top row of the band on the display
+    Options m_options;
+    uint32_t m_period_ms = 0;
+    uint32_t m_due_ms = 0;
+    uint32_t m_last_ms = 0;   // When the position was last advanced
+    uint32_t m_position = 0;  // Scrolled distance in 1/256 pixels, within the current pass
+    uint32_t m_remainder = 0; // Left over from the last advance, in 1/256000 pixels
+    uint16_t m_loop = 0;
+    Stats m_stats;
+};
+
+} // namespace Ticker
+
+#endif /* DRAWMATRIX_TICKER */
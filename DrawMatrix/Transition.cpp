@@ -0,0 +1,179 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      Transition.cpp                                                                                           *
+ * @brief     Timed blends from the previous composite to the current one, mixed in fixed point                        *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#include "Transition.hpp"
+
+#include <cstring>
+#include <new>
+
+namespace Transition {
+namespace {
+constexpr const char *NAMES[] = {"none", "crossfade", "wipe", "dissolve"};
+static_assert(sizeof(NAMES) / sizeof(NAMES[0]) == N_KINDS, "One name per kind");
+
+// --------------------------------------------------------------------------------------
+// Smoothstep of t (8.8, 0 to 256): slow out of the previous picture and into the target
+inline uint32_t ease(uint32_t t) { return (t * t * (768 - 2 * t)) >> 16; }
+} // namespace
+
+// --------------------------------------------------------------------------------------
+const char *name(Kind kind) { return NAMES[static_cast<size_t>(kind)]; }
+
+// --------------------------------------------------------------------------------------
+bool find(const char *name, Kind &kind) {
+    for (size_t k = 0; k < N_KINDS; k++) {
+        if (!strcmp(NAMES[k], name)) {
+            kind = static_cast<Kind>(k);
+            return true;
+        }
+    }
+    return false;
+}
+
+// --------------------------------------------------------------------------------------
+Engine::Engine(Compositor::Scene &scene)
+    : m_scene(scene), m_width(scene.canvas.width()), m_height(scene.canvas.height()) {}
+
+// --------------------------------------------------------------------------------------
+const char *Engine::start(Kind kind, uint16_t duration_ms) {
+    if (kind == Kind::NONE) {
+        finish();
+        return nullptr;
+    }
+    if (!duration_ms || duration_ms > MAX_DURATION_MS) {
+        finish();
+        return "Invalid transition length";
+    }
+    const size_t n_pixels = static_cast<size_t>(m_width) * m_height;
+    const uint16_t n_frames = duration_ms * FPS / 1000 ? duration_ms * FPS / 1000 : 1;
+    std::unique_ptr<uint8_t[]> from(new (std::nothrow) uint8_t[n_pixels * 3]);
+    std::unique_ptr<uint16_t[]> weights(new (std::nothrow) uint16_t[n_frames]);
+    std::unique_ptr<uint8_t[]> order(kind == Kind::CROSSFADE ? nullptr : new (std::nothrow) uint8_t[n_pixels]);
+    if (!from || !weights || (kind != Kind::CROSSFADE && !order)) {
+        finish();
+        return "Not enough memory for a transition";
+    }
+
+    // What is on display now, which is still a blend if a transition is under way
+    uint8_t rgb[3];
+    for (size_t i = 0; i < n_pixels; i++) {
+        m_scene.pixel(i, rgb);
+        if (running()) {
+            mix(i, rgb, from.get() + 3 * i);
+        } else {
+            memcpy(from.get() + 3 * i, rgb, 3);
+        }
+    }
+
+    // Ordered kinds run their weight past the last order by the width of the edge, so every pixel gets all the way
+    const uint32_t range = kind == Kind::CROSSFADE ? 256 : 255 + (256 >> EDGE_SHIFT);
+    for (uint16_t f = 0; f < n_frames; f++) {
+        weights[f] = (ease((static_cast<uint32_t>(f) << 8) / n_frames) * range) >> 8;
+    }
+    if (kind == Kind::WIPE) {
+        for (size_t i = 0; i < n_pixels; i++) {
+            order[i] = m_width > 1 ? (i % m_width) * 255 / (m_width - 1) : 0;
+        }
+    } else if (kind == Kind::DISSOLVE) {
+        // Ranks spread evenly over 0-255, then shuffled (Fisher-Yates)
+        for (size_t i = 0; i < n_pixels; i++) {
+            order[i] = (i << 8) / n_pixels;
+        }
+        for (size_t i = n_pixels - 1; i > 0; i--) {
+            const size_t j = xorshift() % (i + 1);
+            const uint8_t swap = order[i];
+            order[i] = order[j];
+            order[j] = swap;
+        }
+    }
+
+    m_from = std::move(from);
+    m_weights = std::move(weights);
+    m_order = std::move(order);
+    m_n_frames = n_frames;
+    m_frame = 0;
+    m_weight = 0;
+    m_kind = kind;
+    m_duration_ms = duration_ms;
+    m_clock_running = false;
+    m_stats.transitions++;
+    m_stats.present_max_us = 0;
+    return nullptr;
+}
+
+// --------------------------------------------------------------------------------------
+void Engine::cancel() {
+    if (!running()) {
+        return;
+    }
+    m_stats.cancelled++;
+    finish();
+}
+
+// --------------------------------------------------------------------------------------
+bool Engine::run(uint32_t now_ms, uint32_t &wait_ms) {
+    wait_ms = IDLE_POLL_MS;
+    if (!running()) {
+        return false;
+    }
+    if (!m_clock_running) {
+        m_start_ms = now_ms;
+        m_clock_running = true;
+    }
+    const uint32_t elapsed_ms = now_ms - m_start_ms;
+    if (elapsed_ms >= m_duration_ms) {
+        finish();
+        return true;
+    }
+
+    // Frames follow elapsed time: a late one skips those it missed instead of stretching the transition
+    const uint16_t frame = static_cast<uint64_t>(elapsed_ms) * m_n_frames / m_duration_ms;
+    const bool due = frame >= m_frame;
+    if (due) {
+        m_weight = m_weights[frame];
+        m_frame = frame + 1;
+        m_scene.invalidate(); // Every pixel changes
+    }
+    const uint32_t next_ms =
+        m_frame < m_n_frames ? (static_cast<uint32_t>(m_frame) * m_duration_ms + m_n_frames - 1) / m_n_frames
+                             : m_duration_ms;
+    wait_ms = next_ms > elapsed_ms ? next_ms - elapsed_ms : 0;
+    return due;
+}
+
+// --------------------------------------------------------------------------------------
+void Engine::presented(uint32_t us) {
+    m_stats.frames++;
+    m_stats.present_us = us;
+    m_stats.present_max_us = us > m_stats.present_max_us ? us : m_stats.present_max_us;
+}
+
+// --------------------------------------------------------------------------------------
+void Engine::finish() {
+    if (!running()) {
+        return;
+    }
+    m_from.reset();
+    m_order.reset();
+    m_weights.reset();
+    m_clock_running = false;
+    m_scene.invalidate(); // Parts of the target may not have changed since they were last mixed
+}
+
+// --------------------------------------------------------------------------------------
+uint32_t Engine::xorshift() {
+    m_seed ^= m_seed << 13;
+    m_seed ^= m_seed >> 17;
+    m_seed ^= m_seed << 5;
+    return m_seed;
+}
+
+} // namespace Transition
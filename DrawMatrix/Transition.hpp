@@ -0,0 +1,165 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      Transition.hpp                                                                                           *
+ * @brief     Timed blends from the previous composite to the current one, mixed in fixed point                        *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#ifndef DRAWMATRIX_TRANSITION
+#define DRAWMATRIX_TRANSITION
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "Compositor.hpp"
+
+/**
+ * @brief start() copies what the display shows; from then on the layers change as usual and every composite is mixed
+ * with that copy on its way out, the target's share growing frame by frame until the copy is dropped. The layers are
+ * never modified, so whatever happens to them meanwhile (the clock ticking, a frame arriving) is simply part of the
+ * target.
+ *
+ * The share of every frame is computed at start(), eased in and out, into a table of 8.8 weights. A crossfade mixes
+ * all pixels by the frame's weight; a wipe or a dissolve gives each pixel an order byte (its column, or a shuffled
+ * rank) and a pixel's own weight is the frame's minus its order, scaled up to a soft edge: a subtraction, a shift and a
+ * clamp per pixel.
+ */
+namespace Transition {
+
+enum class Kind : uint8_t {
+    NONE,      ///< Hard cut
+    CROSSFADE, ///< Every pixel blends at once
+    WIPE,      ///< A soft edge sweeping from left to right
+    DISSOLVE,  ///< Pixels blend one by one, in random order
+};
+
+// Number of kinds, NONE included
+constexpr size_t N_KINDS = 4;
+// Frame rate of every transition
+constexpr uint8_t FPS = 50;
+// Length used when none is requested
+constexpr uint16_t DEFAULT_DURATION_MS = 500;
+// Longest transition accepted
+constexpr uint16_t MAX_DURATION_MS = 5000;
+// How often the engine looks for work while idle
+constexpr uint32_t IDLE_POLL_MS = 100;
+
+/**
+ * @brief Name of a kind, as used by /transition.
+ */
+const char *name(Kind kind);
+
+/**
+ * @brief Kind with the given name.
+ * @return false if there is none.
+ */
+bool find(const char *name, Kind &kind);
+
+/**
+ * @brief Counters since boot, for /info.
+ */
+struct Stats {
+    uint32_t transitions = 0;    ///< Transitions started
+    uint32_t cancelled = 0;      ///< Cut short by a new frame
+    uint32_t frames = 0;         ///< Blended frames presented
+    uint32_t present_us = 0;     ///< Time the last blended frame took to mix and send out
+    uint32_t present_max_us = 0; ///< Slowest blended frame of the current transition
+};
+
+class Engine {
+  public:
+    /**
+     * @brief Construct an idle engine.
+     * @param scene Whose composite is blended; must outlive the engine.
+     */
+    explicit Engine(Compositor::Scene &scene);
+
+    /**
+     * @brief Start blending from what shows now (mid-transition, the blend on display) to whatever the layers show
+     * next. The clock starts on the first run(): until then composites come out as the previous picture.
+     * @param kind NONE cuts to the target.
+     * @param duration_ms 1 to MAX_DURATION_MS.
+     * @return nullptr on success, otherwise why it cannot run (the change is then a cut).
+     */
+    const char *start(Kind kind, uint16_t duration_ms);
+
+    /**
+     * @brief Cut to the target, e.g. because a new frame arrived; the caller refreshes the display.
+     */
+    void cancel();
+
+    bool running() const { return static_cast<bool>(m_from); }
+
+    /**
+     * @brief Advance to the frame due (if any); call from the scheduler.
+     * @param now_ms Current millis().
+     * @param wait_ms Set to the milliseconds until the next frame is due.
+     * @return Whether the display needs refreshing (the whole scene is then marked changed).
+     */
+    bool run(uint32_t now_ms, uint32_t &wait_ms);
+
+    /**
+     * @brief Mix one composited pixel with the previous picture, at the current frame's weight.
+     * @param i Logical index.
+     * @param to Composite of the layers.
+     * @param out Set to the colour to display; may not be `to`.
+     */
+    void mix(size_t i, const uint8_t *to, uint8_t *out) const {
+        int32_t weight = m_weight;
+        if (m_order) {
+            weight = (weight - m_order[i]) << EDGE_SHIFT;
+            weight = weight < 0 ? 0 : weight > 256 ? 256 : weight;
+        }
+        const uint8_t *from = m_from.get() + 3 * i;
+        for (uint8_t c = 0; c < 3; c++) {
+            out[c] = from[c] + (((to[c] - from[c]) * weight) >> 8);
+        }
+    }
+
+    /**
+     * @brief Record how long a blended frame took to present.
+     */
+    void presented(uint32_t us);
+
+    Kind current() const { return m_kind; }
+    const Stats &stats() const { return m_stats; }
+
+  private:
+    // A pixel of a wipe or dissolve goes from the previous picture to the target over 256 >> EDGE_SHIFT order steps
+    static constexpr uint8_t EDGE_SHIFT = 3;
+
+    /**
+     * @brief Drop the previous picture; the target shows in full from the next composite.
+     */
+    void finish();
+
+    /**
+     * @brief Next pseudo-random number (xorshift32).
+     */
+    uint32_t xorshift();
+
+    Compositor::Scene &m_scene;
+    uint16_t m_width;
+    uint16_t m_height;
+    std::unique_ptr<uint8_t[]> m_from;     // Previous picture, 3 bytes per pixel
+    std::unique_ptr<uint8_t[]> m_order;    // Wipe and dissolve only: one byte per pixel
+    std::unique_ptr<uint16_t[]> m_weights; // Weight of every frame, m_n_frames of them
+    uint16_t m_n_frames = 0;
+    uint16_t m_frame = 0;
+    int32_t m_weight = 0; // Current frame's, 0 until the first run()
+    Kind m_kind = Kind::NONE;
+    uint32_t m_duration_ms = 0;
+    uint32_t m_start_ms = 0;
+    bool m_clock_running = false; // m_start_ms is set
+    uint32_t m_seed = 0x9E3779B9;
+    Stats m_stats;
+};
+
+} // namespace Transition
+
+#endif /* DRAWMATRIX_TRANSITION */
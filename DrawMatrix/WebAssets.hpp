@@ -0,0 +1,595 @@
+/**
+ * @file      WebAssets.hpp
+ * @brief     Gzipped web pages with their ETags (GENERATED by tools/gen_web_assets.py from data/ - do not edit)
+ */
+#ifndef DRAWMATRIX_WEBASSETS
+#define DRAWMATRIX_WEBASSETS
+
+#include <Arduino.h>
+
+namespace WebAssets {
+
+/**
+ * @brief A precompressed page: send as-is with `Content-Encoding: gzip`.
+ */
+struct Asset {
+    const uint8_t *gz;        ///< Gzip stream (PROGMEM)
+    size_t gz_len;            ///< Length of the gzip stream
+    const char *etag;         ///< Strong ETag, quotes included
+    const char *content_type; ///< MIME type of the uncompressed content
+};
+
+// Browsers may reuse a page but must revalidate it (a cheap 304) so a firmware update is picked up at once
+constexpr const char *CACHE_CONTROL = "no-cache";
+
+// index.html: 4833 bytes -> 1570 bytes gzipped
+const uint8_t INDEX_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xa5, 0x57, 0x5d, 0x6e, 0xdb, 0x46, 0x10, 0x7e, 0xd7, 0x29,
+    0xa6, 0x0c, 0x1a, 0x91, 0x95, 0xa8, 0x3f, 0xcb, 0xad, 0x6b, 0x91, 0x02, 0x52, 0x3b, 0x45, 0x83, 0x26, 0x68, 0x50, 0x3b,
+    0x08, 0x82, 0xc0, 0x0f, 0x2b, 0x72, 0x29, 0x6d, 0x43, 0xee, 0x12, 0xcb, 0xa5, 0x7e, 0x9a, 0xfa, 0x0a, 0xed, 0x11, 0xfa,
+    0xda, 0xc7, 0xbe, 0xf4, 0x42, 0x3d, 0x41, 0x8f, 0xd0, 0x99, 0x25, 0x29, 0x51, 0x8e, 0xdd, 0x04, 0x28, 0x04, 0x88, 0xe2,
+    0xec, 0xcc, 0xec, 0x37, 0xdf, 0x7e, 0x33, 0xa4, 0x82, 0xcf, 0x2e, 0x7f, 0xb8, 0xb8, 0x7e, 0xf3, 0xf2, 0x29, 0xac, 0x4c,
+    0x96, 0xce, 0x3b, 0x01, 0x5d, 0x20, 0x65, 0x72, 0x19, 0x3a, 0x5c, 0x3a, 0x64, 0xe0, 0x2c, 0xc6, 0x4b, 0xc6, 0x0d, 0x83,
+    0x68, 0xc5, 0x74, 0xc1, 0x4d, 0xe8, 0xbc, 0xba, 0xfe, 0xd6, 0x3f, 0x73, 0x1a, 0xb3, 0x64, 0x19, 0x0f, 0x9d, 0xb5, 0xe0,
+    0x9b, 0x5c, 0x69, 0xe3, 0x40, 0xa4, 0xa4, 0xe1, 0x12, 0xdd, 0x36, 0x22, 0x36, 0xab, 0x30, 0xe6, 0x6b, 0x11, 0x71, 0xdf,
+    0xde, 0xf4, 0x41, 0x48, 0x61, 0x04, 0x4b, 0xfd, 0x22, 0x62, 0x29, 0x0f, 0xc7, 0x83, 0x51, 0x1f, 0x32, 0xb6, 0x15, 0x59,
+    0x99, 0xb5, 0x4d, 0x65, 0xc1, 0xb5, 0xbd, 0x67, 0x0b, 0x34, 0x49, 0xd5, 0x87, 0x26, 0xbd, 0x9f, 0x08, 0x13, 0x46, 0x6a,
+    0xcd, 0xf5, 0x9d, 0xfd, 0xcd, 0x8a, 0x67, 0xdc, 0x8f, 0x54, 0xaa, 0x74, 0x0b, 0xc2, 0xa3, 0x31, 0xa3, 0x0f, 0xf9, 0x1a,
+    0x61, 0x52, 0x3e, 0x7f, 0xfe, 0xf4, 0x12, 0x5e, 0x30, 0xa3, 0xc5, 0x16, 0x2e, 0xd0, 0x49, 0xab, 0x34, 0x18, 0x56, 0x2b,
+    0x9d, 0xa0, 0x30, 0x3b, 0xba, 0x2e, 0x54, 0xbc, 0x83, 0xf7, 0x9d, 0x05, 0x8b, 0xde, 0x2d, 0xb5, 0x2a, 0x65, 0x7c, 0x0e,
+    0x75, 0x9a, 0x59, 0xc7, 0xe6, 0xc7, 0xfb, 0x24, 0x49, 0x66, 0x9d, 0x04, 0x13, 0xf8, 0x09, 0xcb, 0x44, 0xba, 0x3b, 0x87,
+    0xee, 0x15, 0x5f, 0x2a, 0x0e, 0xaf, 0x9e, 0x75, 0xfb, 0x50, 0xec, 0x0a, 0xc3, 0x33, 0xbf, 0x14, 0xf8, 0x93, 0xc9, 0xc2,
+    0xc7, 0x6a, 0x04, 0xfa, 0xc7, 0xa2, 0xc8, 0x53, 0x86, 0xbe, 0x49, 0xca, 0xb7, 0x18, 0x8e, 0xdf, 0x7e, 0x2c, 0x34, 0x8f,
+    0x8c, 0x50, 0xf2, 0x1c, 0x41, 0xa7, 0x65, 0x26, 0x67, 0x1d, 0x96, 0x8a, 0xa5, 0xf4, 0x05, 0x66, 0x28, 0xd0, 0x88, 0x65,
+    0x70, 0x3d, 0xeb, 0xfc, 0x54, 0x16, 0x46, 0x24, 0x3b, 0xbf, 0xae, 0xec, 0xb0, 0x90, 0x09, 0xe9, 0xaf, 0xb8, 0x58, 0xae,
+    0xd0, 0x36, 0x1e, 0x8d, 0xd6, 0x2b, 0x34, 0x31, 0xbd, 0x14, 0x98, 0x70, 0x34, 0xeb, 0xdc, 0x76, 0x06, 0x14, 0xc1, 0x84,
+    0xe4, 0xfa, 0x6e, 0x4d, 0x93, 0xc9, 0x64, 0x86, 0xc5, 0xea, 0x18, 0xb9, 0xd6, 0x2c, 0x16, 0x25, 0x6e, 0x37, 0x9e, 0xe4,
+    0x88, 0x2c, 0x67, 0x71, 0x2c, 0xe4, 0xf2, 0x1c, 0x4e, 0xf0, 0x16, 0x26, 0x53, 0xb2, 0x2d, 0xd4, 0xd6, 0x2f, 0x56, 0x2c,
+    0x56, 0x1b, 0x4c, 0x0c, 0x64, 0x1f, 0x7f, 0x89, 0x5f, 0x7a, 0xb9, 0x60, 0xee, 0xa8, 0x6f, 0x3f, 0x83, 0x89, 0xf7, 0xc9,
+    0x45, 0x2e, 0x59, 0x7e, 0x5e, 0x67, 0xc6, 0xf3, 0xaf, 0xd4, 0x81, 0xfb, 0x9d, 0x8e, 0xc8, 0x52, 0xdf, 0x61, 0x39, 0x9f,
+    0x53, 0x09, 0xab, 0x31, 0x42, 0x37, 0x7c, 0x6b, 0x7c, 0x4b, 0x4d, 0xab, 0xf6, 0xa6, 0x50, 0xfc, 0x58, 0x34, 0x55, 0xc5,
+    0x19, 0x97, 0x25, 0x46, 0xec, 0x91, 0x2c, 0xb5, 0x88, 0x71, 0x47, 0xfc, 0xf6, 0x91, 0x54, 0xb4, 0x19, 0x2b, 0x14, 0xc4,
+    0x81, 0x15, 0x6b, 0x9e, 0x73, 0x66, 0x5c, 0x56, 0x1a, 0x45, 0xda, 0x42, 0x39, 0x0a, 0x89, 0x88, 0xdc, 0x09, 0x41, 0xe9,
+    0xc3, 0x38, 0xd1, 0x9e, 0x57, 0xc3, 0xa5, 0x2d, 0xf6, 0x1b, 0xd8, 0x03, 0xba, 0x4b, 0xe9, 0xc9, 0xc9, 0xc9, 0x07, 0x94,
+    0x9e, 0x1d, 0x31, 0x5a, 0x95, 0x6c, 0x8b, 0x89, 0x79, 0xa4, 0x34, 0xab, 0x68, 0x91, 0x4a, 0xf2, 0x3b, 0xea, 0xba, 0xaf,
+    0x60, 0xa3, 0x51, 0x4e, 0xa2, 0x0a, 0xb1, 0xbf, 0x13, 0xa5, 0x33, 0x40, 0xe2, 0x8b, 0x3e, 0x1c, 0x80, 0x58, 0xc3, 0x31,
+    0xd0, 0xf3, 0x15, 0xb5, 0x0c, 0xd1, 0xd8, 0x44, 0xd5, 0x09, 0x88, 0x8c, 0x37, 0xae, 0x8f, 0xe7, 0x89, 0x55, 0x1e, 0xd5,
+    0x32, 0x9d, 0x4e, 0x6d, 0x0e, 0x81, 0x02, 0xc2, 0x40, 0x2b, 0xf6, 0x42, 0xfc, 0xcc, 0xb1, 0x86, 0xc1, 0x29, 0xcf, 0x1a,
+    0xf6, 0xfd, 0x85, 0x32, 0x46, 0x65, 0x8d, 0x74, 0x30, 0xc0, 0xb6, 0xd3, 0x71, 0xc4, 0x78, 0x30, 0xa1, 0x08, 0x6b, 0xd9,
+    0xd4, 0x62, 0x3d, 0x1d, 0x8d, 0x3e, 0xc8, 0x71, 0x56, 0xa7, 0x88, 0x79, 0x11, 0x69, 0x91, 0x53, 0xa1, 0xc7, 0x89, 0x46,
+    0x83, 0xaf, 0x29, 0x51, 0x43, 0x14, 0x63, 0xcc, 0xfa, 0xe7, 0x9a, 0xd3, 0x80, 0x78, 0x40, 0x26, 0xb7, 0x9d, 0x47, 0x07,
+    0x87, 0x23, 0x6d, 0xb1, 0x22, 0x47, 0x61, 0xfa, 0xf6, 0x14, 0x48, 0xed, 0x30, 0xc4, 0x03, 0xba, 0xc3, 0xc3, 0x88, 0x70,
+    0xde, 0x77, 0xa6, 0x22, 0x63, 0x4b, 0xee, 0x6b, 0x2e, 0x71, 0xc5, 0x9e, 0x6d, 0x2e, 0xb6, 0x9c, 0xf8, 0x8c, 0x69, 0xcb,
+    0x60, 0x58, 0x8f, 0x93, 0x60, 0x58, 0xcf, 0x50, 0x9a, 0x2b, 0x78, 0x89, 0xc5, 0x1a, 0xa2, 0x94, 0x15, 0x45, 0xe8, 0xec,
+    0x5b, 0xd3, 0x4e, 0xda, 0xf1, 0xbd, 0xc3, 0x09, 0xcd, 0x47, 0x31, 0x75, 0x25, 0x14, 0x11, 0x31, 0xb9, 0x66, 0x05, 0x88,
+    0xf8, 0x60, 0x85, 0x6a, 0xe6, 0x3a, 0x27, 0x13, 0x07, 0xaa, 0xa9, 0x10, 0x3a, 0x93, 0xa9, 0x33, 0x0f, 0x86, 0x95, 0xf3,
+    0x71, 0xae, 0x16, 0xcd, 0x4e, 0x3b, 0x8d, 0x5f, 0x18, 0x66, 0xca, 0xc2, 0x99, 0x23, 0x0a, 0x49, 0x9d, 0x2b, 0x97, 0x83,
+    0xc1, 0x20, 0x18, 0x62, 0x28, 0xd5, 0x53, 0x5d, 0x5a, 0x79, 0x48, 0x66, 0x04, 0x88, 0xc1, 0x4a, 0xf3, 0x24, 0x74, 0x86,
+    0xb1, 0x66, 0x88, 0xa5, 0xb5, 0x6a, 0x45, 0xe8, 0x1c, 0x47, 0x91, 0xb0, 0x9c, 0xf9, 0x3f, 0xbf, 0xff, 0xfa, 0xc7, 0x3d,
+    0x29, 0xad, 0x88, 0x9c, 0xf9, 0x25, 0x26, 0xba, 0x67, 0xb5, 0x0d, 0x7c, 0xfe, 0x12, 0x29, 0x34, 0x80, 0x4a, 0xc1, 0x47,
+    0x00, 0x10, 0x85, 0x59, 0x45, 0xa1, 0x90, 0xd8, 0xdc, 0xf8, 0xa8, 0x31, 0x22, 0xe3, 0x7b, 0xec, 0xac, 0x0d, 0x13, 0x9f,
+    0x2f, 0x3a, 0xfb, 0x44, 0x9c, 0x7f, 0xff, 0xf6, 0xe7, 0xc3, 0x30, 0x9f, 0x50, 0xa2, 0xe2, 0x63, 0x40, 0xaf, 0xb8, 0x01,
+    0x86, 0xed, 0x99, 0x31, 0x89, 0xca, 0x81, 0x9d, 0x2a, 0x35, 0xb0, 0xa3, 0xc8, 0x63, 0x78, 0x59, 0x59, 0x88, 0xe8, 0xd3,
+    0x69, 0xfc, 0xeb, 0x61, 0x7c, 0x2f, 0x28, 0xd3, 0xc7, 0xe0, 0xd5, 0x92, 0x03, 0xbb, 0x2d, 0xd0, 0xe8, 0xa4, 0x3e, 0x00,
+    0xf7, 0x42, 0xe1, 0x48, 0x5c, 0xc2, 0x95, 0x52, 0xd2, 0x3b, 0x02, 0x7a, 0xac, 0x87, 0x2a, 0xd3, 0xbc, 0xe3, 0x26, 0xa5,
+    0xb4, 0xc3, 0x1e, 0x5c, 0x0f, 0xfb, 0x0d, 0xd1, 0x15, 0x06, 0x5e, 0x43, 0x88, 0xed, 0xd5, 0x87, 0xef, 0xf0, 0x4a, 0x1d,
+    0x56, 0x59, 0x6b, 0x01, 0x87, 0x10, 0xab, 0xa8, 0xc4, 0xfa, 0xcc, 0x60, 0xc9, 0xcd, 0xd3, 0x94, 0xd3, 0xcf, 0x6f, 0x76,
+    0xcf, 0x62, 0xb7, 0x5b, 0x0b, 0xb2, 0xeb, 0x35, 0x21, 0x95, 0x32, 0x3f, 0x21, 0xa4, 0xd6, 0xf0, 0x21, 0x32, 0x32, 0x5b,
+    0x0c, 0xab, 0xb6, 0xa4, 0x20, 0x2a, 0x17, 0x87, 0x85, 0xdb, 0x9d, 0xc4, 0x07, 0x27, 0xdb, 0xd3, 0xe4, 0x66, 0xb6, 0x83,
+    0x08, 0xd5, 0x63, 0xf8, 0x33, 0xb2, 0x5c, 0x32, 0xc3, 0xdc, 0xd7, 0x08, 0xdf, 0xa3, 0x21, 0xa6, 0xc1, 0x4d, 0xf1, 0x28,
+    0x05, 0xd5, 0x34, 0xc3, 0x4b, 0x50, 0x85, 0x0d, 0x62, 0xf4, 0x1a, 0xa4, 0x5c, 0x2e, 0xcd, 0x8a, 0xcc, 0xbd, 0x10, 0xa6,
+    0x5e, 0x6b, 0xe9, 0xad, 0xb8, 0xa1, 0xea, 0x4f, 0x4f, 0x31, 0x47, 0x43, 0x11, 0xbe, 0x4e, 0xbd, 0xa4, 0xa9, 0xe1, 0xe6,
+    0x7d, 0x88, 0xfb, 0xa0, 0x88, 0x31, 0x91, 0x80, 0x9b, 0xc3, 0x3c, 0x44, 0xd2, 0xbe, 0xc0, 0x1d, 0x51, 0xc4, 0xa6, 0xd4,
+    0xb2, 0x9e, 0x37, 0x55, 0xa6, 0x1c, 0x57, 0xa6, 0x94, 0x2d, 0x7e, 0xab, 0x6e, 0x3e, 0x5c, 0x81, 0x1e, 0x8c, 0xeb, 0x55,
+    0xfb, 0xf3, 0x5e, 0x8f, 0xc9, 0xc1, 0x63, 0x72, 0x43, 0x13, 0x6b, 0x0f, 0x8a, 0xe5, 0x79, 0xba, 0xfb, 0x9e, 0xef, 0xdc,
+    0x06, 0x11, 0x55, 0x9b, 0xa3, 0x37, 0x0e, 0xc2, 0xcd, 0x4a, 0xe0, 0x70, 0x77, 0x15, 0x16, 0x1d, 0xd7, 0xb5, 0xc2, 0xe3,
+    0xc7, 0xb8, 0x1a, 0x34, 0x70, 0x9b, 0x23, 0x8f, 0xaa, 0xf4, 0xbd, 0xde, 0x4d, 0x43, 0xae, 0x44, 0x8b, 0x1b, 0xc1, 0x63,
+    0x18, 0x6d, 0xbf, 0x4a, 0x3c, 0x42, 0x36, 0xb3, 0xc5, 0x56, 0xa6, 0xb3, 0x91, 0x67, 0x67, 0x7d, 0xcd, 0xee, 0x3b, 0xbb,
+    0x1f, 0x5e, 0x02, 0x90, 0x78, 0xe9, 0xf5, 0xbc, 0x16, 0x59, 0xbd, 0x5e, 0x4d, 0xd7, 0xac, 0xa3, 0x88, 0x67, 0x7c, 0xea,
+    0xde, 0x02, 0x4f, 0x0b, 0xfe, 0x9f, 0x19, 0x30, 0xc0, 0x3a, 0x3f, 0x90, 0xe9, 0xd6, 0x7e, 0x8e, 0x59, 0xb8, 0xe4, 0x29,
+    0x9e, 0x7c, 0xc3, 0xc3, 0xbe, 0xf8, 0x1e, 0x9c, 0x40, 0x10, 0xee, 0x19, 0x68, 0x73, 0x44, 0x27, 0x02, 0xbf, 0x80, 0xdb,
+    0x70, 0x0f, 0x41, 0x00, 0x67, 0x5e, 0x9b, 0x82, 0x03, 0xe7, 0x0d, 0xf6, 0xff, 0x05, 0x79, 0x0f, 0x38, 0xaa, 0x86, 0x75,
+    0xab, 0xeb, 0x36, 0xd4, 0x28, 0x12, 0x1f, 0x7b, 0xaf, 0xf9, 0xe2, 0x4a, 0x45, 0xef, 0x38, 0xaa, 0x7d, 0x53, 0x9c, 0x0f,
+    0x87, 0x5d, 0x04, 0x90, 0xaa, 0xc8, 0xbe, 0x7c, 0x0c, 0x56, 0x0a, 0x5d, 0x7b, 0xd0, 0x1d, 0x66, 0x42, 0x6b, 0xa5, 0xa9,
+    0x19, 0x36, 0xc5, 0x60, 0x21, 0x24, 0xd3, 0xbb, 0xeb, 0x5d, 0x4e, 0xed, 0xd0, 0x65, 0x5a, 0xe3, 0x38, 0x28, 0x93, 0x84,
+    0xeb, 0xae, 0x5d, 0x56, 0x52, 0xe5, 0xdc, 0x1e, 0xa8, 0x07, 0xe1, 0x1c, 0xde, 0xd7, 0x8d, 0x39, 0xa0, 0x96, 0xba, 0xa8,
+    0xde, 0x51, 0x29, 0xee, 0xb9, 0x58, 0xf3, 0xee, 0x0c, 0x6e, 0xeb, 0x98, 0x8c, 0x17, 0x45, 0xd5, 0x60, 0x2e, 0x5f, 0xa3,
+    0x4b, 0x15, 0x6b, 0x45, 0x60, 0x70, 0x27, 0x95, 0x80, 0x35, 0x5b, 0xa1, 0x42, 0x18, 0x62, 0x82, 0xc2, 0xd0, 0xb3, 0xb5,
+    0x7b, 0xe8, 0x82, 0xaa, 0xb2, 0xb8, 0x2e, 0xec, 0x15, 0x8e, 0xfe, 0xb3, 0x27, 0x04, 0xce, 0x3d, 0x44, 0x7a, 0x95, 0xac,
+    0xf6, 0xfa, 0x0c, 0xe0, 0xb4, 0xd5, 0x45, 0xb4, 0xf2, 0x76, 0x74, 0x63, 0xd3, 0x8f, 0xb6, 0xd3, 0x85, 0x77, 0xa4, 0xf7,
+    0x53, 0x0c, 0xb6, 0x42, 0xba, 0xeb, 0x37, 0xf5, 0xee, 0x28, 0x62, 0xef, 0xb9, 0x47, 0x86, 0x33, 0x23, 0x2f, 0xcd, 0x61,
+    0x60, 0xd8, 0xa6, 0xeb, 0x03, 0xfe, 0x9f, 0x19, 0x55, 0x9c, 0x16, 0xf8, 0xae, 0x80, 0xb0, 0x8a, 0x14, 0xff, 0x10, 0xb9,
+    0x63, 0x4a, 0x41, 0x67, 0x58, 0x73, 0x13, 0xa5, 0xaa, 0xe0, 0x07, 0x42, 0x3b, 0xf7, 0x13, 0xfa, 0x23, 0x8f, 0xda, 0xcf,
+    0x64, 0x3c, 0x0c, 0x14, 0xc6, 0x35, 0x3e, 0xe1, 0x54, 0x69, 0xdc, 0x7a, 0xa9, 0x0f, 0x13, 0x7c, 0x69, 0xa9, 0x52, 0xdf,
+    0x76, 0xf6, 0xb2, 0xc0, 0x1b, 0x8f, 0xbe, 0xf1, 0xcd, 0xa4, 0x1e, 0xd5, 0xc1, 0xb0, 0x7e, 0x27, 0x19, 0x56, 0x7f, 0xff,
+    0xfe, 0x05, 0x9d, 0xb9, 0xfe, 0x2e, 0x0f, 0x0e, 0x00, 0x00,
+};
+constexpr Asset INDEX = {INDEX_GZ, sizeof(INDEX_GZ), "\"67d3f34ebd58420c\"", "text/html"};
+
+// draw.html: 29653 bytes -> 6477 bytes gzipped
+const uint8_t DRAW_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x3c, 0xdb, 0x6e, 0xe3, 0x48, 0x76, 0xef, 0xfa, 0x8a,
+    0x1a, 0x0d, 0xba, 0x49, 0xb5, 0x75, 0xf7, 0x65, 0xdc, 0xb2, 0xe5, 0xde, 0x6e, 0xb7, 0x7b, 0xa6, 0x83, 0x99, 0x9d, 0x49,
+    0xbb, 0x7b, 0x77, 0x07, 0x1e, 0xa3, 0x41, 0x91, 0x25, 0x89, 0x63, 0x8a, 0xd4, 0x90, 0x94, 0x2d, 0xed, 0xc4, 0x79, 0xcc,
+    0x63, 0x16, 0x58, 0x04, 0x79, 0x0a, 0xb0, 0x49, 0x5e, 0xb2, 0xc9, 0x73, 0x02, 0x24, 0x40, 0x90, 0x8f, 0xd9, 0x1f, 0x48,
+    0x3e, 0x21, 0xe7, 0x52, 0x2c, 0x16, 0xa9, 0xab, 0xbb, 0x67, 0x91, 0x00, 0xc9, 0xf4, 0x58, 0x26, 0xeb, 0x72, 0xea, 0xdc,
+    0xcf, 0xa9, 0x53, 0x25, 0x9f, 0x7e, 0xf2, 0xf2, 0xeb, 0xf3, 0xb7, 0xdf, 0x7e, 0x73, 0x21, 0xc6, 0xe9, 0x24, 0x38, 0xab,
+    0x9c, 0xe2, 0x2f, 0x11, 0x38, 0xe1, 0xa8, 0x5f, 0x95, 0x61, 0x15, 0x1b, 0xa4, 0xe3, 0xc1, 0xaf, 0x89, 0x4c, 0x1d, 0xe1,
+    0x8e, 0x9d, 0x38, 0x91, 0x69, 0xbf, 0xfa, 0xee, 0xed, 0xab, 0xc6, 0x71, 0x35, 0x6b, 0x0e, 0x9d, 0x89, 0xec, 0x57, 0x6f,
+    0x7d, 0x79, 0x37, 0x8d, 0xe2, 0xb4, 0x5a, 0x71, 0xa3, 0x30, 0x95, 0x21, 0x0c, 0xbb, 0xf3, 0xbd, 0x74, 0xdc, 0xf7, 0xe4,
+    0xad, 0xef, 0xca, 0x06, 0xbd, 0xd4, 0x85, 0x1f, 0xfa, 0xa9, 0xef, 0x04, 0x8d, 0xc4, 0x75, 0x02, 0xd9, 0xef, 0x34, 0xdb,
+    0x75, 0x31, 0x71, 0xe6, 0xfe, 0x64, 0x36, 0x31, 0x9b, 0x66, 0x89, 0x8c, 0xe9, 0xdd, 0x19, 0x40, 0x53, 0x18, 0xd5, 0x45,
+    0x06, 0xbe, 0x31, 0xf4, 0xd3, 0xbe, 0x1b, 0xdd, 0xca, 0xb8, 0xb4, 0x7e, 0x3a, 0x96, 0x13, 0xd9, 0x70, 0xa3, 0x20, 0x8a,
+    0xab, 0x42, 0xa3, 0xf0, 0x69, 0xc7, 0xc1, 0x7f, 0xa5, 0xb1, 0x93, 0x68, 0xe0, 0x07, 0x80, 0x92, 0x1c, 0x34, 0x9c, 0xe9,
+    0xb4, 0xe1, 0x3a, 0x53, 0x5c, 0xc7, 0x98, 0xb6, 0x90, 0x49, 0x69, 0x0a, 0x8c, 0x0b, 0x7c, 0xd7, 0x49, 0xfd, 0x28, 0x6c,
+    0x60, 0x8b, 0x31, 0xf8, 0xcb, 0x8b, 0x97, 0xe2, 0x65, 0xec, 0xdc, 0xad, 0x98, 0x21, 0x1b, 0x1f, 0xb8, 0xd4, 0xd2, 0xc4,
+    0xd4, 0x4f, 0x83, 0x0f, 0x5d, 0x34, 0x49, 0x9d, 0x74, 0x96, 0x34, 0x06, 0x0e, 0xf0, 0x34, 0x5d, 0x14, 0xc0, 0x0c, 0x02,
+    0xc7, 0xbd, 0x69, 0xa4, 0xb1, 0x13, 0x26, 0xc1, 0xcc, 0x85, 0xa6, 0x12, 0x3c, 0x4f, 0x26, 0x6e, 0xec, 0x4f, 0x91, 0x6c,
+    0x63, 0xd6, 0xf1, 0xfc, 0x58, 0x20, 0x02, 0x5f, 0x39, 0x69, 0xec, 0xcf, 0x09, 0x0f, 0x3f, 0x1c, 0x89, 0xb7, 0x51, 0x14,
+    0xe0, 0xfc, 0xc0, 0x0f, 0x6f, 0x44, 0x2c, 0x03, 0x60, 0xb4, 0x13, 0xfa, 0x43, 0x99, 0xa4, 0x55, 0x31, 0x8e, 0xe5, 0xb0,
+    0x6f, 0x79, 0x4e, 0xea, 0xf4, 0x0c, 0x56, 0xb6, 0xb2, 0x01, 0x7b, 0xdf, 0x27, 0x51, 0x58, 0xff, 0xb1, 0x52, 0x25, 0xde,
+    0xf6, 0x44, 0xb5, 0x04, 0xbe, 0x5a, 0xaf, 0x54, 0x93, 0x31, 0xc8, 0xff, 0xbd, 0x39, 0x20, 0xeb, 0xf1, 0xfc, 0x64, 0x1a,
+    0x38, 0x0b, 0x6c, 0x1e, 0xce, 0x82, 0x00, 0x50, 0x96, 0xa0, 0xbd, 0xd0, 0x11, 0xc5, 0x3e, 0x20, 0x4c, 0x4b, 0x61, 0xa7,
+    0x13, 0x2e, 0x08, 0x50, 0xea, 0x00, 0xa0, 0x59, 0x1c, 0x60, 0x5b, 0x13, 0x5b, 0x7c, 0x0f, 0x1f, 0x5b, 0x5e, 0xb6, 0x92,
+    0x1b, 0x4d, 0x69, 0x91, 0x16, 0xbe, 0x0d, 0x80, 0x45, 0xa3, 0x38, 0x9a, 0x85, 0xde, 0x7b, 0x56, 0x2f, 0xe8, 0xc8, 0xf4,
+    0x0a, 0xba, 0x49, 0xf1, 0x56, 0xf6, 0x00, 0x8d, 0x72, 0x84, 0x28, 0x24, 0xd0, 0x71, 0x55, 0x9d, 0xa5, 0x7e, 0x00, 0xca,
+    0x0f, 0x6f, 0xd7, 0xd0, 0x19, 0x38, 0xb3, 0xd0, 0x1d, 0xbf, 0x1f, 0x3b, 0xa1, 0x17, 0x48, 0x9c, 0x09, 0xc4, 0xbb, 0x01,
+    0xa2, 0xfb, 0x7e, 0x12, 0x79, 0x92, 0x66, 0x0c, 0x23, 0x17, 0xe4, 0x26, 0xe7, 0x7e, 0x92, 0x02, 0x7f, 0xab, 0x75, 0xa0,
+    0x60, 0x96, 0x46, 0xd5, 0xeb, 0xca, 0x3d, 0xe2, 0x0c, 0xe2, 0x20, 0xc0, 0x30, 0x31, 0x89, 0x5d, 0x5c, 0x9b, 0xd8, 0xeb,
+    0x4f, 0x9c, 0x91, 0x6c, 0x25, 0xb7, 0xa3, 0xbd, 0xf9, 0x24, 0xa8, 0x3f, 0xda, 0x3f, 0x87, 0x47, 0x01, 0x8f, 0x61, 0xd2,
+    0xff, 0xce, 0x02, 0x3b, 0x4f, 0xa7, 0xbd, 0x56, 0xeb, 0xee, 0xee, 0xae, 0x79, 0xb7, 0xdf, 0x8c, 0xe2, 0x51, 0xab, 0xdb,
+    0x6e, 0xb7, 0x71, 0x38, 0x74, 0xa2, 0x91, 0xbd, 0x88, 0xe6, 0x30, 0xae, 0x2d, 0xda, 0xe2, 0xb0, 0xd3, 0xc5, 0x9f, 0xef,
+    0xac, 0x47, 0xfb, 0x17, 0x00, 0x26, 0x96, 0x6e, 0x5a, 0x61, 0x93, 0xfe, 0xce, 0xa2, 0x76, 0x31, 0x96, 0xfe, 0x68, 0x9c,
+    0xea, 0xd7, 0xa1, 0x1f, 0x04, 0xf0, 0xf2, 0xa8, 0xbb, 0xdf, 0xf5, 0xf0, 0xdf, 0x77, 0x56, 0x8b, 0xa7, 0x4e, 0x9d, 0x74,
+    0x2c, 0x3c, 0xe8, 0xfa, 0xea, 0xe9, 0x91, 0x78, 0x7a, 0x34, 0xde, 0xef, 0xb6, 0x6f, 0xe1, 0xe7, 0x8b, 0xa7, 0x47, 0xbf,
+    0xfe, 0xce, 0xaa, 0x18, 0xd3, 0xba, 0x5d, 0x3d, 0x07, 0x51, 0x82, 0x27, 0x24, 0x3a, 0xf1, 0x7f, 0x0d, 0x4c, 0x13, 0x40,
+    0x20, 0xac, 0x33, 0x87, 0x9f, 0xaa, 0x80, 0xd6, 0x74, 0x01, 0x32, 0xc2, 0xc6, 0x02, 0xc1, 0xd4, 0x35, 0x9d, 0xc5, 0xd3,
+    0x28, 0xe1, 0x5e, 0x90, 0x39, 0x78, 0x98, 0xe4, 0x86, 0xcd, 0xee, 0xfe, 0x5a, 0xdc, 0x5b, 0xa0, 0xa2, 0x64, 0x4e, 0x67,
+    0x25, 0x25, 0x3b, 0x6d, 0x71, 0x73, 0xe5, 0x94, 0x95, 0xfe, 0xac, 0xe2, 0x0f, 0x85, 0x6d, 0x81, 0x2f, 0x42, 0x0f, 0xf6,
+    0xcb, 0x28, 0xbe, 0x91, 0xb1, 0x05, 0x1e, 0x0c, 0x6c, 0xe3, 0xd6, 0x1f, 0x39, 0x69, 0x14, 0xd7, 0x40, 0x6a, 0xfa, 0xa5,
+    0x59, 0x18, 0xd8, 0x8c, 0xe5, 0x08, 0xe4, 0x26, 0x63, 0xdb, 0x6a, 0x25, 0x77, 0xcd, 0xef, 0x13, 0xab, 0xd6, 0x04, 0x85,
+    0x70, 0xc7, 0xf6, 0x10, 0x04, 0x8f, 0x1a, 0x29, 0x6c, 0x98, 0x2e, 0xee, 0x6b, 0x27, 0x95, 0xfb, 0x8a, 0x07, 0x92, 0x9e,
+    0x80, 0xec, 0x9b, 0x8e, 0xe7, 0x5d, 0xdc, 0xc2, 0xc3, 0x97, 0x38, 0x37, 0xc4, 0xd9, 0x69, 0x34, 0x73, 0xc7, 0x13, 0xf0,
+    0x78, 0x56, 0x5d, 0xe4, 0x53, 0x25, 0x2e, 0x8d, 0xe8, 0xc9, 0x26, 0xf9, 0x4d, 0xf1, 0x49, 0xbf, 0x2f, 0x3a, 0xd8, 0x28,
+    0x9b, 0xd3, 0x58, 0x22, 0x88, 0x97, 0x72, 0xe8, 0xcc, 0x82, 0xd4, 0xa6, 0x05, 0xee, 0xeb, 0xb0, 0xd6, 0xd4, 0x49, 0x12,
+    0xff, 0x56, 0xf6, 0xc4, 0xd0, 0x09, 0x12, 0x49, 0x4b, 0x9f, 0xb6, 0x32, 0x5a, 0x4f, 0xc9, 0x37, 0x9c, 0x55, 0x9e, 0x00,
+    0x8c, 0x89, 0x13, 0x8f, 0xfc, 0xb0, 0x27, 0xda, 0x27, 0x95, 0x29, 0x60, 0x04, 0xca, 0x47, 0xcf, 0x83, 0x68, 0xde, 0x00,
+    0x61, 0xd0, 0xeb, 0x20, 0x8a, 0x3d, 0x70, 0xd2, 0xd0, 0x84, 0xe0, 0x31, 0x6e, 0xd4, 0xa1, 0xdf, 0x5b, 0xc0, 0x6c, 0x56,
+    0x8b, 0x9e, 0xe8, 0xb4, 0xdb, 0x8f, 0x4e, 0x58, 0x65, 0xb2, 0x17, 0xf0, 0xf5, 0x8d, 0x52, 0xc3, 0xca, 0x95, 0xd0, 0xc1,
+    0x0f, 0x83, 0xe8, 0xae, 0x31, 0xef, 0x89, 0xb1, 0xef, 0x79, 0x32, 0x34, 0xda, 0x16, 0x3d, 0x81, 0x76, 0x00, 0x33, 0xa2,
+    0xc4, 0x47, 0x76, 0xf4, 0x04, 0xba, 0x38, 0xdf, 0x45, 0x4c, 0x14, 0x0e, 0xca, 0x25, 0x00, 0xa9, 0x81, 0x04, 0x0c, 0xf1,
+    0xb3, 0xe1, 0xf9, 0xa8, 0xc3, 0x34, 0x1e, 0xcc, 0x75, 0x36, 0x01, 0x98, 0x4e, 0xe0, 0x8f, 0xc2, 0x86, 0x9f, 0xca, 0x49,
+    0x02, 0x8d, 0xc0, 0x34, 0x19, 0x9f, 0x54, 0xbe, 0x9f, 0x81, 0xbd, 0x0d, 0x17, 0x0d, 0xe5, 0xef, 0x18, 0x46, 0x83, 0xbc,
+    0x06, 0x40, 0x82, 0xc6, 0xc6, 0xd0, 0x99, 0xf8, 0x01, 0x00, 0xb7, 0x2e, 0xc1, 0xc0, 0xa5, 0x78, 0xf7, 0x1a, 0x64, 0x93,
+    0x2c, 0x40, 0x62, 0x93, 0xc6, 0xcc, 0x87, 0x47, 0x70, 0xa7, 0x0d, 0xd0, 0x06, 0x7f, 0x08, 0x3c, 0xd3, 0xde, 0xa3, 0x27,
+    0x94, 0x6f, 0x30, 0x48, 0x3d, 0x9e, 0xce, 0xc1, 0xd2, 0xe8, 0x13, 0x78, 0xe1, 0x87, 0x0d, 0x83, 0x77, 0xb7, 0xe3, 0xf5,
+    0x1c, 0x1f, 0x39, 0x53, 0x9a, 0x8c, 0x14, 0x37, 0x11, 0xcf, 0x38, 0x0a, 0x92, 0xdd, 0xc9, 0xa6, 0xe9, 0x9d, 0x2e, 0xce,
+    0x5f, 0xc9, 0x81, 0xcd, 0x32, 0x2b, 0x60, 0x4f, 0x48, 0x14, 0x88, 0x64, 0xe3, 0x47, 0xdc, 0x09, 0xdf, 0xd8, 0xf1, 0xfc,
+    0x59, 0x92, 0xeb, 0xcf, 0xd8, 0xf1, 0xa2, 0xbb, 0x9e, 0x08, 0xa3, 0x50, 0xae, 0xa7, 0x8f, 0x39, 0x3e, 0x8e, 0x21, 0x92,
+    0xd0, 0xcc, 0xfb, 0x4a, 0x8a, 0x06, 0x0c, 0x14, 0xaa, 0x51, 0x40, 0x49, 0xe0, 0x4c, 0x13, 0x49, 0x34, 0xd1, 0x53, 0x19,
+    0x8b, 0x6e, 0x77, 0x09, 0x05, 0xc2, 0x55, 0x91, 0x02, 0xcc, 0xb6, 0xc1, 0x70, 0x5c, 0x1b, 0x39, 0x7d, 0x27, 0x1a, 0xa2,
+    0x73, 0x34, 0x9d, 0xd7, 0xea, 0x82, 0xda, 0x8e, 0x80, 0xf9, 0xe2, 0x89, 0xd8, 0xef, 0x8a, 0x96, 0xe8, 0x1e, 0xd4, 0xc0,
+    0x4e, 0x32, 0xb9, 0xe8, 0x69, 0xc5, 0x79, 0x30, 0xb8, 0x7b, 0x00, 0x83, 0xf7, 0xbb, 0x00, 0x02, 0x67, 0xc3, 0x14, 0x27,
+    0x99, 0x02, 0xdf, 0x61, 0x71, 0xe0, 0x7d, 0x2f, 0x83, 0x75, 0xc2, 0x84, 0x34, 0x40, 0x48, 0xd1, 0x0c, 0x55, 0xcb, 0x9f,
+    0xcb, 0x9c, 0x57, 0xc9, 0xd4, 0x71, 0x33, 0x13, 0xd0, 0x96, 0xa1, 0x94, 0x9d, 0xfc, 0x40, 0xc3, 0x51, 0x92, 0x64, 0xf6,
+    0x01, 0x5b, 0x3c, 0xe0, 0x49, 0x6e, 0x07, 0x10, 0x75, 0x61, 0xb9, 0x5b, 0xa9, 0xc9, 0x24, 0x5c, 0x1f, 0x44, 0x2b, 0x53,
+    0x91, 0x53, 0xfc, 0xe1, 0x10, 0x8a, 0x0c, 0xe8, 0x40, 0x73, 0x27, 0xa3, 0xb4, 0x27, 0x40, 0xf9, 0x44, 0x12, 0x05, 0xbe,
+    0x27, 0x3e, 0xdd, 0xdf, 0xdf, 0x3f, 0xa9, 0xb8, 0xb3, 0x38, 0x89, 0xa0, 0x7d, 0x1a, 0xf9, 0xac, 0x83, 0x94, 0x94, 0x28,
+    0xb2, 0x72, 0xa1, 0x47, 0xb1, 0x68, 0x37, 0xbb, 0xc9, 0x6e, 0x7e, 0x69, 0x1d, 0xcb, 0x7a, 0x3d, 0x67, 0x08, 0x6b, 0x00,
+    0xe7, 0xb4, 0x89, 0x5b, 0x96, 0xe9, 0x4e, 0x9c, 0x01, 0xa0, 0x36, 0x4b, 0x25, 0x82, 0x98, 0x12, 0xae, 0x27, 0x95, 0x40,
+    0x0e, 0x53, 0xf5, 0x18, 0x33, 0x67, 0xe8, 0x79, 0x10, 0xa5, 0x69, 0x34, 0xc9, 0x5e, 0xb4, 0x06, 0x32, 0xae, 0x3d, 0x88,
+    0x16, 0x63, 0xf0, 0x03, 0xe9, 0x92, 0x2a, 0x76, 0xd9, 0x76, 0x01, 0x97, 0x31, 0xfa, 0xb5, 0x82, 0x62, 0xe3, 0xbc, 0x4f,
+    0x0f, 0x0f, 0x0f, 0x95, 0x71, 0xc3, 0x7b, 0xe3, 0xa3, 0x4c, 0x7c, 0xb5, 0xf1, 0x76, 0xba, 0xcb, 0x96, 0xbb, 0xce, 0x66,
+    0x00, 0x8f, 0x78, 0x34, 0xc8, 0xb0, 0x58, 0x46, 0x62, 0xa5, 0x13, 0x31, 0x30, 0x28, 0xcd, 0x87, 0xb4, 0x5e, 0x06, 0xc4,
+    0x7d, 0xa6, 0x75, 0x38, 0x1c, 0x2a, 0xc7, 0x8a, 0xa1, 0x1e, 0x44, 0xda, 0x7c, 0x2a, 0x27, 0x1a, 0xef, 0xa3, 0xf6, 0x0a,
+    0x10, 0x60, 0x29, 0xe1, 0x46, 0x08, 0xc7, 0x08, 0x21, 0x42, 0x7b, 0x4a, 0x17, 0xf8, 0x7e, 0xa4, 0xe1, 0xed, 0x13, 0xbc,
+    0x54, 0xce, 0xd3, 0x06, 0xe1, 0x0d, 0x56, 0x83, 0xf2, 0x5c, 0x5a, 0xc2, 0x0f, 0xa7, 0xb3, 0xf4, 0x0a, 0xd3, 0x8c, 0x7e,
+    0x15, 0x74, 0x71, 0x24, 0xab, 0xd7, 0xb0, 0x22, 0x12, 0xdc, 0x43, 0x45, 0xd6, 0xb2, 0xc1, 0x70, 0x0b, 0x89, 0x13, 0xf4,
+    0x15, 0x18, 0x9d, 0xd9, 0xcf, 0x41, 0x9b, 0xd5, 0xa4, 0xc0, 0xd5, 0x83, 0x25, 0xde, 0x43, 0x16, 0x96, 0xd9, 0x7c, 0x83,
+    0x94, 0xee, 0x38, 0x9f, 0xb6, 0x6c, 0x2d, 0xb9, 0xd7, 0x6f, 0x20, 0x84, 0xe9, 0xb2, 0x48, 0xd6, 0xc9, 0x7f, 0xa5, 0xa8,
+    0x00, 0xdc, 0x80, 0x98, 0x10, 0xca, 0x24, 0x31, 0xc4, 0xac, 0x89, 0x7d, 0x88, 0xd2, 0x1d, 0x28, 0x71, 0xad, 0x80, 0xb8,
+    0xa3, 0xe0, 0x0d, 0xb1, 0x1d, 0xaf, 0x03, 0xf5, 0x21, 0x0a, 0xb0, 0x52, 0xe6, 0xab, 0xc5, 0xbc, 0x52, 0x94, 0xfb, 0x4b,
+    0x26, 0x03, 0x5b, 0x1d, 0x09, 0xdb, 0xaa, 0x11, 0xca, 0x15, 0x78, 0x69, 0xa7, 0x91, 0x60, 0x87, 0x50, 0x17, 0xe4, 0xbf,
+    0xa6, 0x4e, 0x0c, 0xcd, 0x28, 0xcb, 0x3a, 0x99, 0x97, 0xf1, 0xd4, 0x3d, 0xc0, 0x47, 0x73, 0x14, 0xb6, 0xd4, 0x96, 0x54,
+    0x65, 0x9f, 0xa2, 0xf4, 0x74, 0x0a, 0xeb, 0x38, 0xa1, 0x2b, 0x33, 0x3f, 0x06, 0xd1, 0x03, 0x17, 0xcf, 0x5e, 0x8b, 0xae,
+    0x0e, 0x78, 0xd3, 0x98, 0xaf, 0x21, 0xae, 0xd7, 0xc3, 0x8d, 0xe1, 0x8d, 0x0f, 0x9c, 0x02, 0x7d, 0x82, 0x85, 0xd2, 0xf1,
+    0x6c, 0x32, 0x00, 0x92, 0x97, 0xd7, 0x50, 0x4c, 0xe8, 0x92, 0x44, 0x33, 0x26, 0xf0, 0x5b, 0x09, 0xc9, 0x43, 0x64, 0xd3,
+    0x66, 0x17, 0xae, 0xb9, 0xa6, 0x1c, 0x38, 0x75, 0x0e, 0xa3, 0x18, 0x7c, 0x27, 0xef, 0x3f, 0x61, 0xb7, 0xf4, 0xad, 0xdd,
+    0xe8, 0x10, 0x0f, 0xee, 0x2b, 0x9f, 0xc6, 0xd2, 0x5b, 0x8b, 0x6a, 0xc1, 0x72, 0x86, 0xc3, 0x36, 0x19, 0xcf, 0xa6, 0x39,
+    0xb9, 0x97, 0x35, 0x67, 0x7a, 0x9e, 0x9e, 0x39, 0xc2, 0x2d, 0xe3, 0x6e, 0xeb, 0xb5, 0xdb, 0xb8, 0xe2, 0xb6, 0x59, 0xab,
+    0x57, 0x6c, 0xb7, 0x71, 0x4d, 0x9a, 0x3b, 0x08, 0x66, 0x72, 0xd7, 0x05, 0x71, 0xc9, 0x2d, 0x93, 0xd6, 0xad, 0x87, 0x2b,
+    0xf2, 0x54, 0x6d, 0x43, 0xbb, 0xad, 0x7a, 0x70, 0xfe, 0xfc, 0xd5, 0x61, 0x7b, 0xa7, 0xa9, 0xab, 0xd7, 0x3e, 0x38, 0x74,
+    0xda, 0x07, 0x4f, 0xd9, 0x7e, 0x67, 0x60, 0x13, 0xe1, 0x43, 0x5d, 0x55, 0x79, 0x22, 0xbf, 0x94, 0x7c, 0xf0, 0xc8, 0x09,
+    0x60, 0xff, 0xbc, 0x2e, 0xe5, 0xbf, 0x8b, 0x11, 0x36, 0x7e, 0x9a, 0x39, 0x73, 0x79, 0x95, 0x0c, 0xc6, 0xd0, 0x1f, 0xcd,
+    0x62, 0x59, 0xdc, 0xff, 0x2c, 0x2b, 0xb5, 0xe1, 0x44, 0x32, 0xff, 0x69, 0x38, 0x1e, 0x1d, 0xf0, 0x32, 0xa0, 0xfe, 0x64,
+    0x64, 0x22, 0x37, 0x08, 0x22, 0xf7, 0xe6, 0xa4, 0x42, 0x9b, 0xd6, 0x06, 0x98, 0x3d, 0x30, 0x91, 0xc2, 0xf1, 0x14, 0x12,
+    0x41, 0x34, 0x01, 0x12, 0x56, 0x53, 0x95, 0x6c, 0xfc, 0xd0, 0xc3, 0x4a, 0x49, 0x14, 0x17, 0x92, 0x3c, 0x95, 0x33, 0x52,
+    0x94, 0xc0, 0x3c, 0x4c, 0x27, 0x24, 0xfc, 0x92, 0x51, 0xd7, 0x35, 0xad, 0x56, 0x45, 0xfb, 0x15, 0x56, 0xbb, 0x9c, 0xb3,
+    0x68, 0xd1, 0xaf, 0xb6, 0x5f, 0x9d, 0x86, 0xed, 0x27, 0x2b, 0x71, 0x6d, 0x46, 0xc3, 0x21, 0xba, 0xa6, 0x82, 0x3e, 0x68,
+    0xd8, 0xde, 0x7e, 0x77, 0xd8, 0x1d, 0xae, 0x9e, 0x08, 0xf1, 0x24, 0x0a, 0x43, 0x0c, 0x2a, 0xe1, 0x68, 0xf5, 0xec, 0xe1,
+    0xf0, 0xe9, 0x31, 0xda, 0x8f, 0x13, 0x02, 0x03, 0x15, 0x62, 0x54, 0x6e, 0xea, 0x24, 0x10, 0xaf, 0x87, 0x58, 0x5d, 0xa4,
+    0x1c, 0xef, 0x67, 0x37, 0x72, 0x31, 0x8c, 0x9d, 0x89, 0x4c, 0x54, 0xff, 0x8f, 0x15, 0x20, 0x16, 0x3e, 0x8d, 0x80, 0x40,
+    0xf9, 0x15, 0x6c, 0x18, 0x33, 0xad, 0xda, 0xc0, 0x08, 0xf5, 0x7e, 0x37, 0x26, 0xf0, 0x59, 0x50, 0x66, 0x27, 0x99, 0x27,
+    0x54, 0xe0, 0x18, 0x57, 0x7b, 0x47, 0x52, 0xba, 0x25, 0x45, 0x2a, 0xc6, 0xbd, 0x43, 0x0c, 0x57, 0xd4, 0x74, 0xa7, 0x44,
+    0x76, 0x88, 0x84, 0x16, 0x54, 0xd5, 0x94, 0x87, 0x76, 0x9f, 0x30, 0xb9, 0x93, 0xd4, 0x85, 0x22, 0x4c, 0x39, 0xd7, 0x8c,
+    0x2c, 0x6d, 0x99, 0x06, 0xdd, 0x4f, 0x8d, 0x6e, 0x0c, 0x18, 0xb7, 0x28, 0x29, 0xc3, 0x1b, 0x53, 0x3d, 0xc1, 0x86, 0x71,
+    0xc7, 0xec, 0x88, 0x13, 0x50, 0x52, 0x55, 0x25, 0xf9, 0x71, 0x63, 0xf0, 0x3b, 0x38, 0xf4, 0xe4, 0x08, 0xa2, 0xdb, 0xc1,
+    0x67, 0x9f, 0x1d, 0x5d, 0x1c, 0xc1, 0xc3, 0xf1, 0xc5, 0xe1, 0xc1, 0xc5, 0x53, 0x82, 0x72, 0xda, 0x52, 0xe5, 0x85, 0xd3,
+    0x96, 0x2a, 0x29, 0xe3, 0x46, 0x1d, 0x7e, 0x79, 0xfe, 0xad, 0x70, 0x03, 0x27, 0x49, 0xfa, 0xd5, 0xb2, 0x3e, 0x54, 0x85,
+    0xef, 0x65, 0xad, 0xaf, 0xf3, 0x46, 0x2a, 0xd2, 0xf4, 0xab, 0x97, 0x32, 0x46, 0xd2, 0x2e, 0xa9, 0xbb, 0x7a, 0x76, 0xda,
+    0x02, 0x48, 0x45, 0x78, 0x59, 0xd2, 0x5c, 0x2d, 0x37, 0x9b, 0x19, 0x75, 0xa9, 0xd3, 0x48, 0x00, 0xa9, 0x94, 0x49, 0x09,
+    0x0b, 0xf0, 0x05, 0x7a, 0xa4, 0x57, 0x3d, 0xfb, 0xaf, 0xdf, 0xfd, 0xd5, 0x3f, 0x8b, 0x37, 0xd2, 0x3b, 0x6d, 0x51, 0x0f,
+    0x8c, 0xa0, 0x08, 0x2b, 0xcc, 0x08, 0x4b, 0x58, 0xe3, 0x68, 0xdc, 0x2c, 0xf6, 0xab, 0xed, 0x2a, 0x56, 0xb8, 0xfb, 0xd5,
+    0xee, 0xe1, 0x61, 0x55, 0xdc, 0x3a, 0xe0, 0xc0, 0xb1, 0x0d, 0xeb, 0x2d, 0x98, 0xc1, 0xa8, 0xb1, 0xbf, 0xc0, 0xf6, 0xea,
+    0x59, 0x1b, 0xd8, 0x04, 0xad, 0xc8, 0xa5, 0x25, 0x6a, 0xd6, 0x63, 0x46, 0x51, 0x08, 0x71, 0xfb, 0xdd, 0xdf, 0x8b, 0xcf,
+    0xf1, 0x79, 0x2b, 0x76, 0x3c, 0x63, 0x57, 0xfc, 0x68, 0xf4, 0x47, 0x61, 0x38, 0xa0, 0xb9, 0xc0, 0xbc, 0x7f, 0x11, 0x2f,
+    0xe0, 0x71, 0x2b, 0x7e, 0x34, 0x7e, 0x57, 0xf4, 0x70, 0xf0, 0x3a, 0xec, 0xd6, 0x2a, 0x05, 0x87, 0x94, 0x92, 0xf0, 0x97,
+    0xd3, 0xcc, 0x32, 0x1d, 0x7a, 0x00, 0x52, 0xf3, 0xdb, 0xbf, 0x13, 0x2f, 0x74, 0xc3, 0x76, 0x9a, 0xf2, 0xb9, 0xeb, 0x29,
+    0x3b, 0x2c, 0x91, 0xa6, 0xe7, 0x28, 0x02, 0xbb, 0xed, 0x47, 0xdb, 0x49, 0x34, 0x83, 0x26, 0x82, 0x53, 0x1e, 0x2e, 0x0a,
+    0xdd, 0xc0, 0x77, 0x6f, 0xfa, 0x55, 0x2c, 0xb8, 0x3e, 0x0f, 0x02, 0xbb, 0x86, 0x44, 0xfc, 0xe5, 0xef, 0xc5, 0x2b, 0x78,
+    0x3f, 0x6d, 0xf1, 0xa8, 0x15, 0xc3, 0xdd, 0x00, 0xac, 0x9c, 0x1d, 0x00, 0x4c, 0x11, 0x64, 0xc7, 0xfd, 0xea, 0x0a, 0x6f,
+    0xd9, 0xa6, 0xff, 0x10, 0xe8, 0x3f, 0xfc, 0x9b, 0x38, 0xc7, 0x59, 0x1b, 0xa0, 0x8e, 0xfd, 0x04, 0xac, 0x79, 0x71, 0x99,
+    0xca, 0xa9, 0x6d, 0x01, 0x94, 0xc8, 0x02, 0x74, 0xfe, 0xf0, 0x17, 0xff, 0xf8, 0x9f, 0xff, 0xfa, 0x1b, 0xf1, 0x0e, 0x5e,
+    0x77, 0x9d, 0x0a, 0xc6, 0xa3, 0xa6, 0xfe, 0x13, 0x4e, 0x05, 0xdb, 0x34, 0xa7, 0x9a, 0xb2, 0x00, 0xb2, 0x95, 0x28, 0xfc,
+    0x09, 0x1e, 0x25, 0xbd, 0xc6, 0x10, 0x5c, 0x15, 0x8e, 0xeb, 0xca, 0x69, 0xda, 0x57, 0x65, 0xe4, 0x27, 0x9a, 0xc0, 0x2c,
+    0x62, 0xa3, 0x97, 0xaf, 0x8a, 0xd6, 0x0a, 0x3c, 0x74, 0xd1, 0x76, 0x24, 0xd3, 0x8b, 0x40, 0xe2, 0xe3, 0x8b, 0xc5, 0x6b,
+    0xcf, 0xb6, 0x0c, 0xf8, 0x58, 0xf5, 0xc5, 0xd1, 0xcc, 0xec, 0xbf, 0xfe, 0x77, 0xc4, 0xf1, 0x35, 0x75, 0x0b, 0xea, 0x37,
+    0x70, 0x55, 0x82, 0xe4, 0x42, 0x17, 0xa2, 0x39, 0x21, 0x9e, 0xa3, 0x6b, 0xa3, 0xb6, 0xcd, 0x42, 0x36, 0x29, 0xc5, 0x14,
+    0x45, 0x19, 0x3a, 0x27, 0x21, 0x3f, 0xa7, 0x13, 0x2b, 0x20, 0xc7, 0x95, 0xe3, 0x28, 0x80, 0xd0, 0xd4, 0xaf, 0xbe, 0xc2,
+    0xe8, 0x28, 0xf8, 0x28, 0x0b, 0xd4, 0x30, 0x90, 0xe1, 0x28, 0x1d, 0x83, 0x32, 0x1e, 0xac, 0xd2, 0x98, 0xc4, 0xb9, 0x95,
+    0x6f, 0xa3, 0xcf, 0x19, 0x18, 0x93, 0xf2, 0xdb, 0xff, 0x10, 0x97, 0xd0, 0x2a, 0x60, 0xc7, 0xa3, 0xda, 0x0d, 0x52, 0x12,
+    0x19, 0x40, 0x14, 0x37, 0x31, 0x78, 0xab, 0x43, 0x97, 0x76, 0xe0, 0x79, 0x13, 0x04, 0x56, 0x19, 0x0a, 0x88, 0xfe, 0x30,
+    0x16, 0x43, 0xbf, 0x23, 0x28, 0x76, 0x23, 0x26, 0x11, 0x9d, 0x3d, 0x65, 0xe6, 0x41, 0xb2, 0x38, 0x3b, 0x9f, 0xa5, 0xa7,
+    0x2d, 0xee, 0x58, 0x1a, 0xe1, 0xc6, 0x51, 0x92, 0x0c, 0x1d, 0x0f, 0xa8, 0x62, 0x24, 0xa4, 0x77, 0x76, 0x9e, 0xb5, 0xad,
+    0x9d, 0x75, 0xe7, 0x4f, 0x01, 0xee, 0x2f, 0xe1, 0x73, 0xed, 0x10, 0x50, 0x07, 0xd8, 0x80, 0xdf, 0xc2, 0xb0, 0x97, 0xea,
+    0xc9, 0x18, 0xda, 0xe2, 0xb5, 0x8a, 0xd6, 0x68, 0x50, 0x5f, 0xcd, 0xa4, 0x96, 0xbd, 0xeb, 0x70, 0xa5, 0x38, 0x4d, 0x81,
+    0x4e, 0xc7, 0xd9, 0xaa, 0xc1, 0x79, 0xdd, 0xf8, 0x52, 0x0e, 0xc0, 0xda, 0x5c, 0xe9, 0x21, 0xff, 0xff, 0xf0, 0x37, 0xbf,
+    0x17, 0xef, 0xa6, 0x1e, 0xe4, 0x8b, 0xea, 0x00, 0x63, 0xd9, 0x5c, 0x10, 0xe4, 0x38, 0x9a, 0xc8, 0x17, 0xf4, 0x6a, 0x80,
+    0x84, 0x04, 0x94, 0x52, 0xa7, 0x26, 0x9f, 0xc9, 0xb5, 0x2c, 0x14, 0xe7, 0x6f, 0xfe, 0x56, 0x7c, 0x01, 0x83, 0x97, 0xd5,
+    0x51, 0xc7, 0xed, 0xec, 0x9c, 0x00, 0x8f, 0x9d, 0x52, 0x11, 0x47, 0x77, 0x89, 0xe8, 0xc3, 0x8e, 0xb8, 0x8e, 0x9b, 0x7f,
+    0x7c, 0xc4, 0xda, 0x66, 0x20, 0x53, 0xc1, 0x5a, 0x0b, 0x0d, 0xcf, 0xe3, 0xd8, 0x59, 0x34, 0x87, 0x71, 0x34, 0xb1, 0x7f,
+    0x14, 0xac, 0x5f, 0x3d, 0x9e, 0x77, 0x5f, 0xc7, 0xb3, 0x8f, 0xfe, 0x19, 0x0f, 0xb1, 0x11, 0x40, 0xad, 0x89, 0x5e, 0xc9,
+    0x6e, 0xcf, 0xd9, 0x89, 0x60, 0xc9, 0x95, 0x17, 0x62, 0x73, 0xe8, 0x8b, 0xb5, 0xc6, 0xc6, 0xeb, 0x59, 0x7a, 0x02, 0x38,
+    0x84, 0x4b, 0xda, 0x9b, 0x6c, 0x9a, 0x04, 0x83, 0xf2, 0x19, 0xa5, 0x0c, 0x63, 0xd3, 0xbc, 0xd2, 0x50, 0x84, 0x81, 0x34,
+    0xfb, 0xc9, 0x39, 0x27, 0xae, 0xd2, 0x83, 0xd9, 0x69, 0x3c, 0x93, 0xdc, 0xae, 0x13, 0xda, 0xe7, 0x69, 0x2a, 0x27, 0xd3,
+    0x14, 0xf9, 0xd4, 0xe6, 0xae, 0x29, 0x08, 0x16, 0x74, 0x9d, 0x85, 0x88, 0xed, 0x57, 0xd7, 0x19, 0x3e, 0x14, 0x6f, 0xb7,
+    0xd3, 0x40, 0xc3, 0x72, 0x2a, 0x30, 0x0c, 0x6e, 0x9f, 0x84, 0xa3, 0x32, 0xac, 0x67, 0xb4, 0xf6, 0x5b, 0x7f, 0x22, 0x23,
+    0x70, 0x1d, 0x7d, 0x11, 0xce, 0x82, 0x80, 0x7b, 0x20, 0x57, 0xc5, 0x8a, 0xc4, 0x1b, 0xf9, 0xc3, 0x4c, 0x26, 0xba, 0x4b,
+    0x88, 0x56, 0x4b, 0x80, 0xd5, 0xba, 0x37, 0x42, 0xe5, 0x8d, 0x31, 0x0f, 0x50, 0xb4, 0xd2, 0xf3, 0x25, 0xfe, 0x02, 0x35,
+    0x25, 0x4a, 0x85, 0xa0, 0x39, 0xba, 0x2d, 0x84, 0xcd, 0x22, 0xe0, 0x07, 0xb1, 0x34, 0x1b, 0x9e, 0xe4, 0x52, 0xa3, 0x10,
+    0xb7, 0x45, 0x68, 0x34, 0x26, 0xa7, 0x39, 0xcf, 0x4c, 0xb6, 0x32, 0xaa, 0x34, 0x53, 0x27, 0x0d, 0xdb, 0x98, 0x55, 0x9a,
+    0x47, 0xb1, 0xee, 0x1b, 0x55, 0xf1, 0xdb, 0x30, 0xd5, 0x1c, 0x97, 0xcf, 0x46, 0x1d, 0x67, 0x7b, 0x34, 0xe7, 0x02, 0x23,
+    0x20, 0x9a, 0x91, 0x07, 0x89, 0x62, 0x58, 0x95, 0x06, 0xc0, 0x24, 0xe2, 0xdd, 0x2b, 0x3f, 0x46, 0x74, 0x95, 0x4d, 0x27,
+    0x14, 0xac, 0x05, 0x44, 0x6f, 0xa5, 0x77, 0xdf, 0x38, 0xb0, 0x9b, 0x40, 0x9f, 0xd9, 0xe7, 0x43, 0x3d, 0xd8, 0x43, 0x64,
+    0x67, 0x84, 0x2c, 0xde, 0x73, 0x44, 0x04, 0x4f, 0x1a, 0x33, 0x46, 0xc3, 0xc8, 0x29, 0xde, 0xe3, 0x78, 0x0d, 0x19, 0xbb,
+    0xb6, 0x95, 0x26, 0x79, 0xb9, 0x9c, 0xaf, 0xe6, 0x20, 0x43, 0x1d, 0x4b, 0xc3, 0x06, 0xe6, 0xb0, 0x5c, 0xff, 0x4a, 0xa3,
+    0x78, 0xbb, 0xd8, 0x17, 0x76, 0x2c, 0x4e, 0x4f, 0x61, 0x8f, 0x5a, 0x13, 0x7f, 0x26, 0xec, 0x11, 0x3e, 0x1f, 0xe3, 0xe3,
+    0xe0, 0xa4, 0x92, 0xb3, 0xa5, 0x49, 0xde, 0xa6, 0x99, 0x27, 0x17, 0xe7, 0x6a, 0xb2, 0xf5, 0xa9, 0x25, 0xf6, 0x18, 0x54,
+    0x33, 0x8d, 0x2e, 0x53, 0xdc, 0x34, 0xdb, 0x00, 0xab, 0x09, 0xdb, 0xaf, 0x4b, 0x3c, 0x99, 0xb3, 0x61, 0xc3, 0x61, 0xb5,
+    0x91, 0xd5, 0x99, 0x9a, 0x34, 0x31, 0x0c, 0x9e, 0x73, 0x81, 0x1f, 0x20, 0x60, 0x45, 0x5a, 0x2b, 0x42, 0xa9, 0x6f, 0x04,
+    0x5b, 0xb6, 0x4c, 0xd6, 0xa5, 0xae, 0x01, 0x02, 0x4c, 0x67, 0x71, 0xc8, 0x8b, 0xe3, 0x5e, 0x46, 0x79, 0x0d, 0xa2, 0x95,
+    0x2c, 0x57, 0xb3, 0xb1, 0x6e, 0xda, 0x6e, 0xdd, 0x30, 0x49, 0xb0, 0x6d, 0x35, 0xbe, 0x09, 0xca, 0x7f, 0xe1, 0xb8, 0x63,
+    0x3b, 0x51, 0xb6, 0x7a, 0x06, 0xa2, 0xe1, 0xe7, 0x15, 0x87, 0xbf, 0x14, 0xd5, 0xad, 0xba, 0x29, 0xcb, 0xda, 0xc9, 0xfa,
+    0xe1, 0x54, 0x05, 0xa4, 0x83, 0xca, 0xe5, 0xc3, 0xe2, 0x55, 0xe7, 0xc2, 0x0c, 0x96, 0x51, 0x24, 0xe2, 0x6d, 0x59, 0x17,
+    0x29, 0xe4, 0x57, 0xb8, 0x67, 0xdb, 0xba, 0xd0, 0xea, 0x43, 0xe9, 0x0f, 0x59, 0x07, 0x7f, 0x4a, 0x7a, 0x5b, 0x1a, 0xcc,
+    0x98, 0xe4, 0x6a, 0x4c, 0x08, 0x00, 0xef, 0x41, 0x5c, 0xf8, 0x24, 0x93, 0xab, 0xf6, 0x75, 0x1e, 0x01, 0x5c, 0x94, 0x9c,
+    0x42, 0x1e, 0x2c, 0xf3, 0x05, 0x6a, 0x12, 0x28, 0xcc, 0x39, 0xdd, 0xaf, 0x78, 0x03, 0xdd, 0xb6, 0xd6, 0xce, 0xac, 0xac,
+    0x82, 0x7e, 0x1b, 0x21, 0x35, 0xf9, 0x12, 0xc6, 0xaf, 0x44, 0x83, 0xe0, 0x34, 0xf1, 0xd8, 0x47, 0x8f, 0x95, 0x31, 0x56,
+    0x7c, 0x20, 0x6d, 0x83, 0xd1, 0x10, 0x77, 0xc7, 0x4d, 0xc8, 0x9c, 0xec, 0x76, 0x5d, 0x3d, 0xfb, 0xa1, 0xdd, 0xa9, 0xe7,
+    0x00, 0x5b, 0x0c, 0x80, 0x76, 0xf0, 0xb5, 0x9c, 0x99, 0xb7, 0xca, 0xeb, 0xd0, 0x1c, 0xd2, 0x71, 0xdb, 0x80, 0xfb, 0x44,
+    0xc0, 0x76, 0x40, 0x73, 0x4c, 0x19, 0x2f, 0x2a, 0x5d, 0xa9, 0x41, 0x19, 0xa0, 0xde, 0x1f, 0xec, 0xe0, 0xf9, 0xf5, 0x58,
+    0x6b, 0xc5, 0xfc, 0xed, 0xbe, 0xb0, 0x38, 0xd4, 0x5a, 0x96, 0x58, 0xbe, 0x17, 0x32, 0xdc, 0x4d, 0x46, 0x6d, 0x19, 0x53,
+    0x66, 0xc3, 0x7a, 0xc6, 0x32, 0x63, 0x6c, 0x9e, 0xde, 0x22, 0xa6, 0x00, 0x6f, 0x3a, 0x90, 0x19, 0x80, 0xa9, 0x16, 0x51,
+    0x29, 0x19, 0xac, 0x01, 0x6b, 0x4f, 0x58, 0x8f, 0x2c, 0xc0, 0x53, 0xe2, 0xb5, 0x0b, 0x0b, 0x92, 0xb4, 0xf4, 0xbd, 0xca,
+    0xea, 0xdf, 0xe7, 0x30, 0x9e, 0x71, 0x82, 0x87, 0xee, 0x85, 0xfd, 0x56, 0xa5, 0x99, 0x42, 0x3a, 0x0a, 0xbe, 0x31, 0x99,
+    0x02, 0x72, 0x12, 0x2d, 0x34, 0x7b, 0xa6, 0xa5, 0xec, 0x9a, 0x31, 0x04, 0x14, 0x1c, 0x07, 0x20, 0x19, 0x11, 0x38, 0xae,
+    0x20, 0x1a, 0xa9, 0x56, 0x1c, 0xc4, 0xf7, 0x3d, 0x64, 0x1c, 0x47, 0xb1, 0x39, 0x88, 0x1a, 0x6c, 0xeb, 0x02, 0x7f, 0xf5,
+    0xc0, 0x80, 0xe8, 0xbd, 0x46, 0x52, 0x5e, 0x62, 0xd3, 0xb2, 0xe9, 0xb9, 0x63, 0xdc, 0x53, 0x6a, 0x9f, 0x90, 0x73, 0x1d,
+    0x02, 0x06, 0xc7, 0x0b, 0x48, 0x27, 0x22, 0x4c, 0xa7, 0x61, 0x07, 0x06, 0xe8, 0xdb, 0x93, 0x68, 0x96, 0xc8, 0x16, 0x29,
+    0x77, 0x8d, 0xa2, 0x46, 0xbe, 0xc8, 0x73, 0x0e, 0xe3, 0x3a, 0x76, 0xec, 0xb0, 0xfc, 0x43, 0x5d, 0xcc, 0x8a, 0xc5, 0x38,
+    0x3f, 0x2a, 0xa3, 0xbf, 0xde, 0x3b, 0xec, 0x8a, 0xd5, 0x43, 0xfd, 0xd1, 0x4f, 0xb4, 0x36, 0xf1, 0xd7, 0x8b, 0xee, 0xc2,
+    0xe5, 0xb5, 0xd7, 0x12, 0x8f, 0xa0, 0xb7, 0xdd, 0xf9, 0x81, 0x04, 0x71, 0xf5, 0x95, 0x9f, 0x32, 0x54, 0x6c, 0x5f, 0x36,
+    0xc1, 0x95, 0xac, 0x57, 0x72, 0xbe, 0xdf, 0x86, 0x00, 0xd1, 0x34, 0x9b, 0xfe, 0x71, 0xd7, 0x5f, 0xeb, 0x3f, 0xfe, 0x8f,
+    0xfb, 0xfe, 0xfb, 0x9c, 0x33, 0x7c, 0x40, 0xc0, 0x5b, 0xbc, 0xb7, 0xb8, 0x13, 0x22, 0xd7, 0x4a, 0x7b, 0xa2, 0xa6, 0x0f,
+    0x3b, 0x8b, 0xf8, 0x8b, 0xb7, 0x5f, 0x7d, 0x89, 0xe9, 0x11, 0xba, 0x39, 0xf0, 0x32, 0x36, 0xda, 0xf7, 0x82, 0x73, 0xef,
+    0x85, 0x38, 0xa5, 0xbd, 0x19, 0x3c, 0xed, 0xed, 0xe1, 0x55, 0x33, 0xf0, 0x0e, 0x0b, 0x4c, 0x21, 0x61, 0x0f, 0x56, 0x17,
+    0x73, 0x7c, 0x82, 0xee, 0x8c, 0xa7, 0x85, 0xd8, 0xe1, 0xc6, 0x12, 0x04, 0xa2, 0xfc, 0x3f, 0xa8, 0x23, 0x6d, 0x74, 0x34,
+    0xfc, 0x39, 0xc3, 0x9f, 0x03, 0x7c, 0xdc, 0xce, 0xc1, 0x13, 0xc1, 0xcf, 0x20, 0x79, 0x9b, 0x20, 0xd1, 0xb6, 0x2b, 0xf5,
+    0xb6, 0xe4, 0x79, 0xbc, 0xa7, 0xbb, 0x9a, 0x5f, 0x5f, 0x2d, 0xae, 0xb7, 0xa5, 0x7b, 0x00, 0x0c, 0xef, 0x3d, 0x82, 0x73,
+    0x6f, 0x22, 0x62, 0xf3, 0x42, 0x0b, 0xb2, 0x62, 0x81, 0x85, 0xf3, 0x26, 0x9e, 0x6e, 0xc2, 0x32, 0x63, 0x3f, 0xf0, 0xec,
+    0xd4, 0xab, 0xe9, 0x2b, 0x45, 0xc5, 0x8e, 0x98, 0x2f, 0xcb, 0x55, 0x56, 0xf0, 0xdd, 0xd0, 0x57, 0xd0, 0x39, 0xf7, 0x46,
+    0xed, 0xf8, 0xe0, 0x9d, 0x64, 0xb2, 0x73, 0x90, 0x59, 0x1d, 0x09, 0xeb, 0x28, 0x56, 0xde, 0x89, 0xe1, 0x0d, 0x85, 0x76,
+    0xbb, 0x5e, 0x99, 0xc8, 0x74, 0x1c, 0x79, 0x3d, 0x61, 0x7d, 0x7e, 0xf1, 0xd6, 0xa2, 0xbd, 0xc0, 0x3b, 0x70, 0xe7, 0xf0,
+    0x22, 0x7c, 0xe0, 0xb3, 0x74, 0x3c, 0x11, 0x0d, 0xc1, 0x55, 0x49, 0x01, 0x4b, 0xe2, 0x6d, 0x96, 0x34, 0x12, 0xce, 0x6d,
+    0xe4, 0x7b, 0x22, 0x01, 0xb0, 0x42, 0x0e, 0x87, 0x80, 0x5d, 0x02, 0x86, 0xa6, 0x82, 0x15, 0xef, 0xb8, 0xd9, 0x82, 0x3f,
+    0x31, 0x36, 0xac, 0x99, 0xe4, 0xb2, 0xf0, 0x65, 0xe5, 0x84, 0x61, 0xdc, 0x83, 0x2d, 0x09, 0xef, 0x95, 0x57, 0xed, 0x71,
+    0xd7, 0xec, 0x6f, 0x4b, 0xbb, 0xe4, 0x26, 0x15, 0x3f, 0xb0, 0x06, 0x85, 0x02, 0x2e, 0x57, 0xf9, 0x41, 0x73, 0x11, 0xa5,
+    0xe2, 0x7e, 0xb8, 0xc9, 0xf5, 0x02, 0x71, 0x26, 0xda, 0x88, 0x1f, 0x50, 0xa8, 0xb6, 0xa9, 0xf6, 0x8a, 0x82, 0x48, 0x5d,
+    0xe5, 0x05, 0xf7, 0xe4, 0x57, 0xb2, 0xb0, 0x6b, 0xd2, 0xbb, 0x23, 0xb9, 0x41, 0x94, 0xa4, 0xcb, 0xa4, 0x2a, 0x9f, 0xf5,
+    0x20, 0xa2, 0x84, 0x3a, 0x03, 0xb3, 0x4e, 0x48, 0x99, 0x4a, 0x5c, 0xda, 0xdb, 0xcb, 0xbc, 0x8a, 0x27, 0x41, 0x4f, 0xb4,
+    0x43, 0x41, 0x27, 0x02, 0xa2, 0x07, 0x47, 0x40, 0xef, 0xd3, 0xe8, 0xce, 0xee, 0xd6, 0x57, 0x14, 0x11, 0x1a, 0xa2, 0x53,
+    0xab, 0x93, 0x96, 0x20, 0xd9, 0x0f, 0x43, 0xcc, 0x3c, 0x63, 0x03, 0xec, 0x0c, 0xce, 0x96, 0xb4, 0xba, 0xce, 0xc8, 0x65,
+    0x19, 0x3a, 0x8e, 0x7c, 0x8d, 0x07, 0x57, 0xa0, 0xae, 0xcb, 0x43, 0x0f, 0x19, 0x95, 0x25, 0xc3, 0xa0, 0x94, 0xe4, 0x35,
+    0xdf, 0xf9, 0x67, 0xb3, 0xa9, 0x04, 0x91, 0xe3, 0xe9, 0x4a, 0xa2, 0x61, 0x54, 0x2b, 0x2b, 0x5d, 0x4a, 0x7e, 0x85, 0x4a,
+    0x05, 0x49, 0x10, 0xab, 0xcb, 0x19, 0xe2, 0xc5, 0xde, 0x3c, 0x59, 0xce, 0x2b, 0x1b, 0x06, 0x95, 0x3b, 0x9b, 0x81, 0x2a,
+    0xaf, 0xc1, 0xe6, 0x7c, 0x06, 0x6a, 0xd0, 0xd0, 0x12, 0x85, 0x05, 0x4a, 0xba, 0x3a, 0x9d, 0x25, 0x63, 0x1b, 0x0d, 0xa2,
+    0x96, 0xed, 0x15, 0xe9, 0xea, 0x05, 0x2c, 0x50, 0xac, 0xa3, 0xd0, 0x12, 0x85, 0x96, 0xa6, 0x33, 0x88, 0x62, 0x75, 0x43,
+    0x57, 0x79, 0x4f, 0x48, 0x3d, 0x8c, 0x12, 0xca, 0xde, 0x5e, 0xa9, 0xac, 0x92, 0x6f, 0xaa, 0xe9, 0x7c, 0x22, 0xa0, 0x9c,
+    0x3f, 0x94, 0x77, 0xe2, 0x39, 0x42, 0x3a, 0xd7, 0xad, 0x14, 0xe4, 0xca, 0x55, 0x9c, 0x7c, 0x92, 0x4e, 0x8a, 0x4d, 0x77,
+    0xa5, 0x2a, 0x69, 0xe8, 0x8a, 0xb4, 0xef, 0xf9, 0xe6, 0xeb, 0xcb, 0xb7, 0x56, 0xbd, 0x82, 0x67, 0x76, 0xb0, 0x79, 0xed,
+    0x41, 0x14, 0xb1, 0x54, 0xaa, 0xdd, 0x78, 0xbb, 0x98, 0x4a, 0x0b, 0x86, 0x98, 0xf7, 0xf9, 0xf1, 0x1a, 0xbf, 0x25, 0xee,
+    0xf9, 0x2a, 0x70, 0x4f, 0xfc, 0xc9, 0xe5, 0xd7, 0x3f, 0x07, 0x57, 0x8f, 0xde, 0xdb, 0x1f, 0x2e, 0x6c, 0x5e, 0xa0, 0x56,
+    0xaf, 0x24, 0xfe, 0x28, 0x74, 0x82, 0x9e, 0x81, 0x50, 0x93, 0x9b, 0x72, 0x77, 0x65, 0xa6, 0xdf, 0x2c, 0xad, 0x22, 0x6b,
+    0xfa, 0xfd, 0xa5, 0x8a, 0xd3, 0xe3, 0xc7, 0x4b, 0x85, 0xab, 0xbe, 0x49, 0xf4, 0x32, 0xff, 0x75, 0xd1, 0x0b, 0xe1, 0xeb,
+    0x24, 0x3f, 0xba, 0xc1, 0x91, 0x2b, 0x0b, 0x74, 0xf7, 0x42, 0xe2, 0xcd, 0x69, 0xf0, 0xd5, 0x63, 0x08, 0x7d, 0xc4, 0xf8,
+    0x0b, 0xce, 0xe6, 0xd5, 0x71, 0x24, 0x03, 0xf1, 0x40, 0x63, 0xee, 0x7c, 0xf0, 0x5f, 0x94, 0xda, 0x5b, 0x4b, 0xbe, 0x49,
+    0x6f, 0x09, 0x76, 0xa7, 0x8c, 0xa6, 0x34, 0xb1, 0x5e, 0x4f, 0x57, 0xbd, 0x2d, 0x92, 0xf7, 0x05, 0x83, 0x5f, 0x4f, 0x57,
+    0x69, 0xcb, 0xa1, 0x8e, 0x71, 0xd9, 0x3c, 0x18, 0x64, 0xbe, 0x01, 0xd9, 0xec, 0x0c, 0x3a, 0xed, 0xcc, 0xc7, 0xe2, 0x27,
+    0x5a, 0x3c, 0xbd, 0x19, 0xa5, 0xcc, 0xf3, 0x68, 0x32, 0x71, 0x42, 0x2f, 0x63, 0x15, 0xd5, 0x11, 0xb9, 0x69, 0x65, 0x89,
+    0x91, 0xbb, 0xce, 0xc7, 0x8e, 0x8f, 0xf9, 0xd7, 0x37, 0x71, 0x34, 0xf1, 0x81, 0xf7, 0xc0, 0x3f, 0xac, 0xad, 0x2b, 0xcf,
+    0xf1, 0x02, 0xb9, 0x05, 0xcc, 0x77, 0x62, 0x89, 0xb9, 0x15, 0xfa, 0xe3, 0x28, 0x94, 0x82, 0x6f, 0x6f, 0x62, 0xe8, 0x8b,
+    0xe0, 0x23, 0xc6, 0x6f, 0x15, 0x09, 0x3a, 0x71, 0x37, 0x12, 0xa7, 0xd1, 0xe0, 0xc5, 0x02, 0xe4, 0x66, 0x53, 0xd5, 0x06,
+    0x39, 0xa4, 0xaa, 0x38, 0x57, 0xdc, 0x22, 0xce, 0xce, 0xa8, 0x14, 0xf5, 0x58, 0xb4, 0xe7, 0xc3, 0x61, 0x5d, 0xe4, 0xad,
+    0xc7, 0x79, 0x23, 0xb7, 0xf1, 0xdb, 0x75, 0x21, 0x2f, 0x43, 0x67, 0x95, 0xd1, 0x6b, 0x0f, 0x70, 0x21, 0x43, 0x65, 0xb2,
+    0x0e, 0x76, 0x0c, 0xcd, 0x66, 0x93, 0x07, 0xb0, 0x96, 0x7d, 0x52, 0xe4, 0x09, 0xbb, 0x9d, 0x12, 0x97, 0x0c, 0x39, 0x0c,
+    0x03, 0x80, 0x91, 0x01, 0xd4, 0x5c, 0x37, 0x30, 0x29, 0x0c, 0xb0, 0x97, 0x7c, 0x63, 0x69, 0xb5, 0x93, 0xca, 0x1a, 0x91,
+    0x10, 0x6a, 0x65, 0xfc, 0x39, 0x08, 0xe7, 0xcc, 0xcb, 0xdd, 0x14, 0xdd, 0xb2, 0x67, 0xc7, 0xf3, 0xce, 0x0f, 0xd3, 0x63,
+    0x2e, 0xe4, 0x97, 0xe6, 0xe7, 0x9e, 0xb2, 0xa4, 0x1a, 0x7f, 0x1c, 0xdf, 0x4b, 0xd5, 0x69, 0xd0, 0x89, 0xbb, 0x31, 0xc0,
+    0xc9, 0x8e, 0x21, 0x20, 0xc9, 0x4d, 0xb0, 0x2e, 0x10, 0xa1, 0x19, 0x61, 0xba, 0x09, 0x4f, 0x08, 0xaa, 0x40, 0x51, 0x41,
+    0x13, 0xcd, 0xd7, 0x42, 0xea, 0xa4, 0x3c, 0x26, 0x7e, 0x49, 0xe8, 0xbd, 0x1a, 0x94, 0x7c, 0x94, 0xb3, 0x9c, 0x37, 0x10,
+    0x56, 0x43, 0xc3, 0xca, 0xfd, 0x26, 0x7e, 0x82, 0xa1, 0xad, 0xf7, 0x85, 0x9f, 0x94, 0x9c, 0xd5, 0x07, 0xb8, 0xa3, 0x55,
+    0xce, 0xa8, 0xe4, 0x2e, 0xf0, 0x4b, 0x31, 0x19, 0x3f, 0x96, 0xbd, 0xc5, 0x86, 0x28, 0xb8, 0x8b, 0x23, 0x29, 0x6e, 0x74,
+    0xcc, 0x33, 0x5d, 0xbe, 0xc5, 0x48, 0x49, 0x75, 0x51, 0xb9, 0x4f, 0x1e, 0x28, 0x2b, 0x05, 0x68, 0x77, 0x36, 0x2a, 0x1f,
+    0x51, 0x2a, 0xf7, 0xf0, 0x6c, 0x7c, 0x2e, 0x97, 0x7a, 0xb0, 0x8d, 0x0b, 0x37, 0x6a, 0x26, 0x26, 0x37, 0xec, 0x64, 0x5f,
+    0x81, 0x43, 0x7b, 0xc9, 0x81, 0x95, 0xe2, 0xfb, 0x07, 0x95, 0x83, 0x34, 0x7b, 0x0a, 0x49, 0x53, 0x8e, 0xa8, 0x52, 0x49,
+    0x75, 0xaa, 0x68, 0x6d, 0x2c, 0x5d, 0x61, 0x68, 0xce, 0x4b, 0x57, 0xb8, 0x41, 0xca, 0x65, 0x9e, 0x8a, 0xec, 0xb6, 0xda,
+    0xa6, 0x63, 0x94, 0x6c, 0x15, 0xbc, 0x4a, 0x47, 0x8f, 0x4b, 0x5b, 0x50, 0x84, 0xda, 0xe4, 0x7b, 0x57, 0xba, 0xce, 0x4d,
+    0xaf, 0xe6, 0x52, 0xea, 0x96, 0xdd, 0xfa, 0x4d, 0x22, 0x0f, 0xc8, 0xab, 0x94, 0x78, 0x83, 0x6e, 0xfd, 0x68, 0xe8, 0xa5,
+    0x9c, 0x7d, 0x32, 0x6a, 0x26, 0xb1, 0x8b, 0x88, 0x28, 0xec, 0xde, 0xd3, 0xdd, 0xc4, 0xd0, 0xf1, 0x83, 0x67, 0xbe, 0x47,
+    0x5b, 0x2f, 0x42, 0xa5, 0x09, 0x3b, 0xa4, 0x3d, 0x61, 0x3d, 0xe6, 0xaf, 0x9b, 0x76, 0x2d, 0x9e, 0xea, 0x60, 0x1d, 0x4f,
+    0x0d, 0xc0, 0x20, 0xab, 0xf3, 0x2c, 0x67, 0xaa, 0x2a, 0x04, 0x1b, 0xb0, 0x55, 0x83, 0x08, 0x63, 0x7e, 0x2c, 0xd5, 0x24,
+    0x4d, 0xb8, 0x4c, 0x9d, 0xda, 0x76, 0xda, 0xb0, 0x76, 0x3d, 0x5b, 0xa4, 0xa6, 0x3b, 0xd5, 0x59, 0x2d, 0x1e, 0x9a, 0xd4,
+    0x58, 0x88, 0x78, 0x34, 0x8e, 0x2a, 0x95, 0x29, 0x41, 0x46, 0x8a, 0x21, 0x0c, 0x73, 0x23, 0xcb, 0x70, 0x74, 0x75, 0x7d,
+    0x9b, 0xee, 0x29, 0xa8, 0x65, 0x1b, 0x2f, 0xea, 0x60, 0xe9, 0x12, 0x80, 0x96, 0x67, 0xc8, 0x5b, 0x8d, 0x6d, 0x7a, 0x83,
+    0x3b, 0x12, 0xab, 0xc6, 0xbb, 0xdd, 0x26, 0x58, 0xc8, 0x84, 0xb2, 0xff, 0x8f, 0x33, 0x70, 0x2d, 0x6a, 0xc4, 0xed, 0x19,
+    0x7d, 0x65, 0x15, 0xe5, 0x0c, 0x39, 0x53, 0xe4, 0xc9, 0x77, 0x6f, 0x5e, 0x03, 0x64, 0x50, 0x7e, 0x14, 0x13, 0xf6, 0xd5,
+    0x6a, 0x3b, 0xd4, 0x76, 0x8b, 0xc6, 0xbe, 0xda, 0x4d, 0x80, 0xe2, 0x40, 0xd6, 0x4e, 0xc6, 0x5f, 0xb2, 0x7d, 0x63, 0x63,
+    0x73, 0x5f, 0xfb, 0x38, 0x93, 0x5f, 0x96, 0xb9, 0xef, 0xfd, 0x04, 0x3e, 0x51, 0xb3, 0x8c, 0xe1, 0x67, 0xa6, 0xa1, 0x8c,
+    0x22, 0xbf, 0x61, 0x88, 0xad, 0x95, 0x6d, 0x32, 0xcd, 0xaf, 0x70, 0x64, 0x92, 0xfd, 0x10, 0x16, 0x2f, 0x79, 0xd4, 0x93,
+    0x25, 0x47, 0x1c, 0xdd, 0x88, 0x67, 0xeb, 0x9c, 0xab, 0xe8, 0x89, 0x19, 0x84, 0xb8, 0x21, 0x44, 0x75, 0xef, 0xe3, 0xd9,
+    0xbe, 0x6e, 0x91, 0xb2, 0xcf, 0x4d, 0x42, 0x67, 0x9a, 0x8c, 0xa3, 0xf4, 0x19, 0x5e, 0x9a, 0x74, 0xd2, 0xfe, 0x60, 0x32,
+    0x7d, 0x0c, 0x23, 0x65, 0xdc, 0x77, 0x9d, 0xf0, 0xd6, 0x49, 0x36, 0x3b, 0x63, 0x07, 0xf3, 0xa5, 0x17, 0xb3, 0xe1, 0x10,
+    0x77, 0x6a, 0xd9, 0xc8, 0x01, 0xbd, 0x9b, 0xae, 0x52, 0x9d, 0x32, 0x63, 0x5c, 0x7f, 0x09, 0xae, 0xf5, 0x17, 0xf0, 0xaa,
+    0x46, 0x69, 0xe7, 0x08, 0xa9, 0x11, 0x44, 0x5b, 0x18, 0x84, 0x63, 0x51, 0x4e, 0x98, 0x8f, 0xed, 0x77, 0xed, 0x4e, 0xbb,
+    0x2e, 0x54, 0x34, 0xd6, 0x37, 0x36, 0x28, 0x23, 0xa6, 0x93, 0x58, 0xbc, 0x85, 0xf1, 0x44, 0xec, 0x83, 0xcc, 0xf7, 0x31,
+    0xdd, 0xfd, 0xf3, 0xfd, 0x1d, 0xca, 0x7b, 0xdb, 0xea, 0x8b, 0x99, 0xb7, 0x86, 0x5e, 0x85, 0xd4, 0x1e, 0xa5, 0xd5, 0x54,
+    0xaf, 0x80, 0x9f, 0x05, 0x9e, 0xe0, 0x68, 0x2c, 0xf6, 0x60, 0x01, 0xc0, 0x00, 0xbf, 0xf3, 0x92, 0xd7, 0xfa, 0x10, 0x37,
+    0x93, 0x8e, 0x63, 0xdb, 0x87, 0x81, 0xdd, 0x9a, 0x71, 0x70, 0xbc, 0xdc, 0xdd, 0xa9, 0xe9, 0xb3, 0xe4, 0x52, 0xe7, 0xa6,
+    0x62, 0x5e, 0x29, 0xff, 0x98, 0xe2, 0x39, 0xfa, 0xb9, 0x0c, 0x02, 0xdb, 0x85, 0x0f, 0xfc, 0x7b, 0x03, 0xc9, 0xcc, 0x09,
+    0xde, 0x60, 0xa5, 0x94, 0x1f, 0xcf, 0xa3, 0x20, 0xa7, 0x31, 0x3b, 0xd2, 0x2e, 0x1d, 0xca, 0xa1, 0xaf, 0x50, 0xe4, 0xe8,
+    0xf9, 0xd7, 0x57, 0x7a, 0xfe, 0xb5, 0xda, 0x8f, 0x16, 0x36, 0x24, 0x88, 0xc5, 0xe6, 0x39, 0xd9, 0xc1, 0x33, 0x22, 0xf6,
+    0x53, 0x9c, 0x8f, 0x17, 0xf6, 0x2e, 0x57, 0xed, 0xf9, 0x67, 0xed, 0xd5, 0xe4, 0xd6, 0x05, 0x6c, 0x5d, 0x4a, 0xfb, 0xa8,
+    0x6b, 0x4e, 0xb3, 0xad, 0xa9, 0x05, 0xe2, 0x5b, 0xe0, 0x2e, 0x2b, 0xaf, 0xa3, 0x6e, 0x3c, 0x18, 0xc1, 0xd3, 0x03, 0xf6,
+    0xa7, 0xe6, 0x95, 0x05, 0xae, 0x22, 0x2a, 0x9e, 0x02, 0x79, 0x5c, 0xd4, 0x77, 0x62, 0x10, 0x61, 0xd3, 0x0d, 0xa2, 0x04,
+    0xb6, 0xb2, 0x59, 0xcd, 0x98, 0xca, 0x29, 0x30, 0x24, 0x17, 0xc2, 0xdc, 0xbc, 0x7d, 0x40, 0xcc, 0xd1, 0x75, 0x60, 0xad,
+    0xf4, 0x8b, 0xb5, 0x63, 0xb0, 0xb0, 0x55, 0x16, 0xfa, 0xbc, 0x2e, 0x16, 0x7a, 0x8f, 0xbb, 0x91, 0x2a, 0x75, 0xd4, 0x94,
+    0x53, 0x45, 0x45, 0xc6, 0x8c, 0x32, 0x43, 0x51, 0xfe, 0x37, 0x11, 0xb5, 0xfb, 0xa1, 0x8f, 0xbd, 0x4a, 0x58, 0xd9, 0xd9,
+    0xcd, 0x06, 0xde, 0x14, 0x0e, 0x07, 0x35, 0x73, 0x56, 0x9d, 0xc0, 0xad, 0x55, 0x83, 0x4d, 0x87, 0x3b, 0x8a, 0x9b, 0x9a,
+    0x04, 0xc9, 0x21, 0x09, 0x1d, 0xf5, 0x37, 0x78, 0xab, 0xde, 0x2e, 0x9c, 0xe2, 0xd4, 0x0b, 0x87, 0x3a, 0xdf, 0xe6, 0x37,
+    0xca, 0xbc, 0x73, 0x86, 0x43, 0xe0, 0x9e, 0xd1, 0xaf, 0xa2, 0x60, 0x20, 0xa2, 0xe4, 0xbb, 0x62, 0x1e, 0xbe, 0x46, 0x42,
+    0xdc, 0xb9, 0x4d, 0x46, 0xa5, 0x51, 0x45, 0x29, 0x71, 0xe7, 0x8e, 0xca, 0x67, 0x9e, 0x73, 0x6e, 0xe6, 0xef, 0x1a, 0x85,
+    0xfc, 0x7f, 0xf6, 0xde, 0x3f, 0xe0, 0xf0, 0x75, 0x9b, 0x1d, 0xe4, 0x55, 0x98, 0xec, 0x4a, 0xf5, 0xb6, 0x10, 0xa1, 0x83,
+    0x68, 0xcc, 0x41, 0x34, 0xd6, 0x51, 0x36, 0x2e, 0x45, 0x59, 0x97, 0x07, 0xb8, 0x3a, 0xca, 0xba, 0x3c, 0x40, 0x05, 0x8b,
+    0xf8, 0xfa, 0xca, 0x35, 0x82, 0xc3, 0xda, 0x38, 0x57, 0xf6, 0xf6, 0x07, 0xfb, 0x9b, 0xfc, 0xfa, 0xb9, 0xa5, 0x7c, 0x7a,
+    0x7e, 0xd6, 0x65, 0xde, 0xfe, 0x36, 0xf1, 0xfb, 0xa9, 0x08, 0xc8, 0xae, 0x7c, 0x3e, 0x90, 0x86, 0x36, 0xff, 0x7f, 0x5d,
+    0x5b, 0xaa, 0xcb, 0x99, 0xc8, 0xfe, 0xcf, 0x15, 0xb9, 0x41, 0x3f, 0x54, 0xfe, 0x47, 0x89, 0x5f, 0x76, 0x73, 0x84, 0xdb,
+    0x68, 0x03, 0x51, 0xc4, 0x9c, 0xf7, 0x2c, 0x7f, 0x1a, 0xf9, 0x36, 0x08, 0xc0, 0xa9, 0x0b, 0xf5, 0xf7, 0x92, 0xf8, 0xfb,
+    0x5b, 0xb9, 0x5a, 0xa9, 0x9a, 0x5d, 0xb1, 0xee, 0xd6, 0x39, 0x80, 0xd8, 0x4f, 0x13, 0x20, 0xa5, 0xe2, 0x19, 0xf0, 0x80,
+    0x8d, 0xc7, 0xda, 0x62, 0x56, 0xa5, 0x92, 0x00, 0xac, 0xa9, 0xd3, 0x49, 0x7c, 0x01, 0x46, 0x51, 0x46, 0xd0, 0x01, 0xce,
+    0xce, 0x8f, 0x86, 0xf4, 0xf9, 0x94, 0x3e, 0x8f, 0x94, 0x86, 0x54, 0x7f, 0x88, 0xfc, 0x61, 0xb5, 0x42, 0x89, 0x56, 0xa2,
+    0x93, 0xcd, 0x03, 0x85, 0x2f, 0x80, 0x29, 0xf5, 0x1c, 0x6b, 0x12, 0x68, 0x85, 0xab, 0x4e, 0x17, 0x65, 0xbe, 0xaf, 0x5e,
+    0xf6, 0xaf, 0xf3, 0x0b, 0xb1, 0x11, 0x3c, 0x76, 0x00, 0x50, 0x3c, 0x0b, 0x8d, 0x5b, 0xb2, 0xa4, 0x65, 0x75, 0x31, 0x1d,
+    0xa9, 0xdf, 0x03, 0xee, 0xcb, 0x36, 0xe7, 0x60, 0xa8, 0x8a, 0xa8, 0xd7, 0xb8, 0x1c, 0xb3, 0xe3, 0xe8, 0x40, 0xdd, 0x26,
+    0x6e, 0x74, 0x18, 0xe9, 0xaf, 0xa7, 0xce, 0x0f, 0x33, 0x29, 0xde, 0x7c, 0xfe, 0xe2, 0x84, 0xaa, 0xc6, 0x9e, 0x44, 0x5e,
+    0xc7, 0x82, 0x22, 0x55, 0xc2, 0xa5, 0x31, 0xf3, 0x8b, 0xb8, 0xf4, 0x57, 0x91, 0x40, 0x22, 0x29, 0xfe, 0xed, 0x9e, 0x5c,
+    0xa1, 0x7d, 0x56, 0x68, 0x1f, 0x14, 0x7a, 0x99, 0xd9, 0xd8, 0xbe, 0xd7, 0x17, 0x07, 0xc5, 0x9b, 0x96, 0x28, 0xcb, 0x2b,
+    0xff, 0xba, 0x4e, 0x37, 0x2a, 0xf9, 0x05, 0x33, 0x56, 0x68, 0x18, 0x98, 0x0d, 0x5d, 0x55, 0x14, 0x8d, 0x29, 0x43, 0x04,
+    0xa2, 0x1f, 0x3f, 0xc6, 0x19, 0xf8, 0x3c, 0xc2, 0xe7, 0x01, 0x3f, 0x0f, 0xb2, 0xf3, 0xb0, 0xbd, 0x3d, 0xe2, 0x12, 0xb4,
+    0x1d, 0x75, 0xb1, 0x0d, 0x99, 0x19, 0xed, 0xed, 0xb1, 0x39, 0xb9, 0x6d, 0xcc, 0x93, 0x71, 0x00, 0x9e, 0x13, 0xc2, 0x5e,
+    0x2a, 0x63, 0x28, 0x15, 0x6f, 0xc1, 0x89, 0xd1, 0x05, 0x14, 0x5e, 0x6f, 0x16, 0x3e, 0x70, 0x3a, 0xd0, 0x35, 0x76, 0x92,
+    0x31, 0x5f, 0xe7, 0xe4, 0x1d, 0xc4, 0x08, 0x7e, 0x1f, 0xe2, 0xc1, 0x36, 0xfc, 0xfe, 0x0c, 0x89, 0x39, 0x3c, 0xc4, 0xab,
+    0x5a, 0x90, 0x96, 0x3f, 0x12, 0x47, 0x07, 0x99, 0xac, 0x6e, 0xe4, 0x62, 0xe3, 0x1d, 0x50, 0x4a, 0x85, 0x50, 0x9e, 0x57,
+    0x08, 0x9f, 0x53, 0x65, 0x98, 0x53, 0x42, 0x0f, 0xfb, 0x8c, 0x53, 0x98, 0xc2, 0x04, 0x1c, 0xae, 0xcf, 0x55, 0xe9, 0xc2,
+    0x29, 0xac, 0xd6, 0x40, 0x6e, 0xc2, 0x2e, 0xe7, 0xf8, 0x20, 0x2b, 0xeb, 0xd7, 0x90, 0xae, 0xee, 0xb1, 0x1e, 0x39, 0xa2,
+    0x91, 0x23, 0x1c, 0x39, 0xda, 0x3c, 0x72, 0x40, 0x23, 0x07, 0x38, 0x72, 0xb0, 0x79, 0x64, 0x4c, 0x05, 0x2b, 0x5c, 0xdd,
+    0x1b, 0xd5, 0x61, 0x22, 0xbd, 0x0e, 0xe8, 0x95, 0x29, 0x85, 0xbe, 0xb3, 0xbe, 0x68, 0x74, 0x51, 0xb8, 0xf0, 0x7c, 0x0a,
+    0xaa, 0x4f, 0x8f, 0x23, 0xa3, 0x79, 0x94, 0x37, 0x0f, 0x8c, 0xe6, 0x01, 0x35, 0x2f, 0x89, 0xed, 0x80, 0xc4, 0x86, 0x80,
+    0xb3, 0x0d, 0xd3, 0x41, 0x8d, 0x5b, 0x46, 0xba, 0xa5, 0x4b, 0x2d, 0xde, 0x80, 0x1a, 0x34, 0x1b, 0x09, 0x1f, 0x5e, 0x78,
+    0xdf, 0x58, 0x79, 0x9f, 0x97, 0x8e, 0xb9, 0xe7, 0x38, 0x7b, 0x81, 0x9e, 0xcf, 0x18, 0x0f, 0xb3, 0x63, 0xc0, 0x1d, 0x4b,
+    0x58, 0x1d, 0x13, 0x56, 0x84, 0x02, 0xfd, 0x49, 0x10, 0xa3, 0x13, 0x71, 0x1d, 0x91, 0x8b, 0xca, 0x91, 0x45, 0x38, 0xec,
+    0xb4, 0xb4, 0x88, 0x0d, 0xb7, 0x34, 0x94, 0xe0, 0x1d, 0xc0, 0x94, 0xc0, 0x78, 0xc0, 0x80, 0x22, 0x04, 0x47, 0x26, 0xc7,
+    0x91, 0x83, 0x5c, 0x45, 0x7c, 0xc2, 0xae, 0x62, 0x74, 0xc2, 0xae, 0x62, 0xf0, 0x10, 0x4d, 0xbf, 0x37, 0x16, 0xd3, 0x01,
+    0xc6, 0xf8, 0xbf, 0xa3, 0x56, 0x55, 0x85, 0x00, 0x1a, 0x0c, 0x41, 0x41, 0xe2, 0x2d, 0xa0, 0x28, 0xc3, 0x5b, 0xd7, 0x2c,
+    0xf5, 0x57, 0x80, 0x5e, 0xd3, 0x37, 0x73, 0x36, 0x14, 0xc8, 0x0a, 0x5f, 0x17, 0xc2, 0x72, 0x64, 0x71, 0xea, 0xa6, 0x3b,
+    0x80, 0xa5, 0xdb, 0x59, 0xfa, 0x96, 0xb9, 0x34, 0x37, 0x1d, 0xf8, 0xce, 0x79, 0x1e, 0x15, 0xb3, 0xf0, 0xb5, 0x26, 0xb2,
+    0xdd, 0x67, 0x76, 0x6d, 0xca, 0xf1, 0xf4, 0x51, 0xf2, 0x2b, 0x18, 0xf0, 0x86, 0x1a, 0x6c, 0xa2, 0x16, 0x9f, 0x9a, 0x51,
+    0x88, 0x95, 0x11, 0x4c, 0x7f, 0xf2, 0x25, 0x6f, 0x8d, 0x5d, 0x3f, 0xd5, 0x68, 0xc9, 0x11, 0x23, 0xe2, 0xb6, 0xaa, 0xc8,
+    0xae, 0x98, 0x65, 0xa4, 0x48, 0x54, 0x28, 0xd9, 0x50, 0x5a, 0xcd, 0x2a, 0x29, 0x58, 0x56, 0xc5, 0x27, 0xbe, 0x4f, 0x85,
+    0x62, 0xc6, 0x84, 0x23, 0x6b, 0x54, 0x3e, 0xb8, 0xcf, 0x59, 0x46, 0x06, 0x3b, 0xc5, 0x44, 0x52, 0x8d, 0x00, 0x26, 0x50,
+    0x3c, 0x87, 0x08, 0x6c, 0x75, 0x8d, 0x2f, 0x7e, 0x70, 0xa8, 0x7e, 0x4e, 0x7f, 0xa6, 0x46, 0x41, 0x15, 0xad, 0x02, 0x18,
+    0xa0, 0x41, 0x77, 0x23, 0x3d, 0x8c, 0x40, 0x8b, 0x9e, 0x79, 0x5d, 0x8e, 0x53, 0x78, 0x90, 0xf3, 0x4b, 0x8e, 0xd8, 0xf8,
+    0xf8, 0x05, 0x75, 0xd5, 0x55, 0x1d, 0xe4, 0x57, 0xd9, 0xc3, 0xb7, 0x2a, 0x2f, 0xd7, 0x40, 0xcf, 0x0a, 0x28, 0x20, 0x67,
+    0xf2, 0xd9, 0x9a, 0x20, 0x0d, 0xbb, 0x80, 0xc3, 0x13, 0x55, 0x5b, 0x31, 0x71, 0x41, 0x8b, 0xe0, 0x15, 0x75, 0x91, 0xa7,
+    0x91, 0xa3, 0x86, 0x7f, 0x97, 0xa7, 0x9b, 0x8d, 0xf8, 0x56, 0xf9, 0xf4, 0xcc, 0xcc, 0xcc, 0x45, 0x98, 0xbb, 0x05, 0x4c,
+    0xf2, 0x35, 0x70, 0x61, 0xc5, 0x28, 0x8d, 0x4c, 0x61, 0xdd, 0xb6, 0xb9, 0x44, 0x56, 0xff, 0xc9, 0x81, 0x29, 0x2c, 0xc0,
+    0x4e, 0xd2, 0x39, 0x45, 0xe9, 0x4b, 0xac, 0x68, 0x50, 0x05, 0x03, 0x92, 0x40, 0xeb, 0x44, 0xb7, 0xd3, 0x55, 0x3d, 0x36,
+    0x3c, 0x5c, 0x8f, 0xbf, 0x67, 0x54, 0xe3, 0x7e, 0x04, 0xc7, 0x7a, 0x46, 0xf5, 0xf3, 0x32, 0x9b, 0xeb, 0xab, 0xe5, 0x61,
+    0x1e, 0x28, 0xbc, 0xa4, 0xf3, 0x0f, 0x54, 0x13, 0xd4, 0x0e, 0x82, 0x85, 0x4d, 0xcb, 0x0b, 0xd2, 0xb6, 0x62, 0xfb, 0xe5,
+    0xba, 0x5d, 0x6f, 0xc7, 0xf9, 0x1e, 0xf6, 0xdb, 0x0b, 0x2e, 0x85, 0x51, 0x19, 0xac, 0x46, 0xe9, 0x83, 0x91, 0x34, 0x28,
+    0xf4, 0xae, 0x60, 0xec, 0xb5, 0xf9, 0x8d, 0x0c, 0xa3, 0x9d, 0x92, 0x08, 0xf3, 0x6b, 0x18, 0xc5, 0x3e, 0xcc, 0x27, 0xca,
+    0x75, 0xb5, 0xb5, 0x91, 0x77, 0xfd, 0x7d, 0xb7, 0xe5, 0xec, 0x99, 0xbe, 0x24, 0xf9, 0xe0, 0xe4, 0x99, 0xbf, 0x5a, 0x09,
+    0x99, 0xa3, 0x91, 0x35, 0xe7, 0xf9, 0xae, 0x42, 0xbd, 0xc0, 0xf5, 0x62, 0xf6, 0xfc, 0xa3, 0xe0, 0x2a, 0x3c, 0x95, 0xdf,
+    0xe3, 0x42, 0x15, 0x59, 0x65, 0xd2, 0xfc, 0x67, 0xf4, 0xcc, 0x53, 0x20, 0x79, 0x9b, 0xb9, 0x3f, 0xbe, 0x8f, 0x4d, 0xdd,
+    0xca, 0x97, 0xe1, 0xaf, 0xe7, 0x09, 0x2e, 0xfa, 0xee, 0xcd, 0x97, 0x36, 0xf9, 0x43, 0xde, 0xcf, 0x19, 0x7f, 0x0d, 0xaf,
+    0xa5, 0xbe, 0x9f, 0xde, 0xe2, 0xbf, 0x8c, 0xfa, 0xdf, 0xd8, 0xf8, 0x39, 0xa9, 0x2a, 0x55, 0x00, 0x00,
+};
+constexpr Asset DRAW = {DRAW_GZ, sizeof(DRAW_GZ), "\"f2cc0ccead276926\"", "text/html"};
+
+// music.html: 1377 bytes -> 625 bytes gzipped
+const uint8_t MUSIC_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xa5, 0x54, 0xcd, 0x8e, 0xd3, 0x30, 0x10, 0xbe, 0xe7, 0x29,
+    0x4c, 0x10, 0x2a, 0x48, 0x75, 0xd3, 0x94, 0x05, 0xa1, 0x34, 0xe9, 0x81, 0x05, 0x04, 0x07, 0xc4, 0x4a, 0xec, 0x1e, 0x38,
+    0xba, 0xce, 0x24, 0x19, 0xd6, 0xb1, 0x23, 0xdb, 0xe9, 0x36, 0xa0, 0x7d, 0x05, 0x78, 0x04, 0x78, 0x09, 0xde, 0x8b, 0x47,
+    0x60, 0x9c, 0xa6, 0xec, 0xcf, 0x81, 0x0b, 0xb2, 0x64, 0x67, 0xbe, 0x8c, 0xbf, 0x99, 0x6f, 0x66, 0x92, 0xfc, 0xc1, 0xab,
+    0x0f, 0xa7, 0xe7, 0x9f, 0xce, 0x5e, 0xb3, 0xc6, 0xb7, 0x6a, 0x13, 0xe5, 0xe1, 0x60, 0x4a, 0xe8, 0xba, 0x88, 0x41, 0xc7,
+    0x01, 0x00, 0x51, 0xd2, 0xd1, 0x82, 0x17, 0x4c, 0x36, 0xc2, 0x3a, 0xf0, 0x45, 0x7c, 0x71, 0xfe, 0x86, 0xbf, 0x88, 0x8f,
+    0xb0, 0x16, 0x2d, 0x14, 0xf1, 0x0e, 0xe1, 0xaa, 0x33, 0xd6, 0xc7, 0x4c, 0x1a, 0xed, 0x41, 0x93, 0xdb, 0x15, 0x96, 0xbe,
+    0x29, 0x4a, 0xd8, 0xa1, 0x04, 0x3e, 0x1a, 0x73, 0x86, 0x1a, 0x3d, 0x0a, 0xc5, 0x9d, 0x14, 0x0a, 0x8a, 0x74, 0xb1, 0x9c,
+    0xb3, 0x56, 0xec, 0xb1, 0xed, 0xdb, 0xdb, 0x50, 0xef, 0xc0, 0x8e, 0xb6, 0xd8, 0x12, 0xa4, 0xcd, 0x9c, 0x1d, 0xe9, 0x79,
+    0x85, 0xbe, 0x90, 0x66, 0x07, 0xf6, 0x5e, 0x7c, 0xdf, 0x40, 0x0b, 0x5c, 0x1a, 0x65, 0xec, 0xad, 0x14, 0x1e, 0xa6, 0x22,
+    0xac, 0xe0, 0xeb, 0xd1, 0x2b, 0xd8, 0xbc, 0xef, 0x1d, 0x4a, 0x76, 0xa6, 0xc4, 0x00, 0x36, 0x4f, 0x0e, 0x58, 0x94, 0x3b,
+    0x3f, 0x84, 0x73, 0x6b, 0xca, 0x81, 0x7d, 0x8d, 0xb6, 0x42, 0x5e, 0xd6, 0xd6, 0xf4, 0xba, 0xcc, 0xd8, 0x44, 0xb0, 0x8e,
+    0x46, 0x66, 0xb2, 0xab, 0xaa, 0x5a, 0x47, 0x15, 0xf1, 0xf3, 0x4a, 0xb4, 0xa8, 0x86, 0x8c, 0xcd, 0x3e, 0x42, 0x6d, 0x80,
+    0x5d, 0xbc, 0x9b, 0xcd, 0x99, 0x1b, 0x9c, 0x87, 0x96, 0xf7, 0x48, 0x8f, 0x42, 0x3b, 0x4e, 0x3a, 0x90, 0xfc, 0x4b, 0x74,
+    0x1d, 0x85, 0xcc, 0x58, 0xa5, 0x60, 0x4f, 0xd7, 0x69, 0xe7, 0x25, 0x5a, 0x90, 0x1e, 0x8d, 0xce, 0x28, 0x5d, 0xd5, 0xb7,
+    0x7a, 0x1d, 0x09, 0x85, 0xb5, 0xe6, 0x48, 0x0c, 0x8e, 0x40, 0x12, 0x00, 0x76, 0x1d, 0x7d, 0xee, 0x9d, 0xc7, 0x6a, 0xe0,
+    0x93, 0xa6, 0x9b, 0x17, 0x2d, 0x6a, 0xde, 0x00, 0xd6, 0x0d, 0x61, 0xe9, 0x72, 0xb9, 0x6b, 0x08, 0x12, 0xb6, 0x46, 0x22,
+    0x5c, 0xae, 0xa3, 0xeb, 0x68, 0x11, 0x6e, 0x08, 0xd4, 0x60, 0xef, 0x6b, 0x5a, 0xad, 0x56, 0x6b, 0x12, 0x6b, 0x4b, 0xaa,
+    0xb2, 0x15, 0x25, 0xf6, 0x14, 0x2e, 0x5d, 0x75, 0x94, 0x59, 0x27, 0xca, 0x12, 0x75, 0x9d, 0xb1, 0xa7, 0x64, 0xb2, 0xd5,
+    0x49, 0xc0, 0xb6, 0x66, 0xcf, 0x5d, 0x23, 0x4a, 0x73, 0x45, 0xc4, 0x2c, 0xe0, 0xe9, 0x73, 0xda, 0x6c, 0xbd, 0x15, 0x8f,
+    0x97, 0xf3, 0x71, 0x2d, 0x56, 0x4f, 0xfe, 0x4f, 0x64, 0x2d, 0xba, 0x6c, 0x0a, 0x47, 0xe3, 0x70, 0x18, 0x16, 0x4a, 0xe2,
+    0xd9, 0x32, 0x20, 0x93, 0x45, 0x1a, 0x1f, 0xad, 0x23, 0x0f, 0x7b, 0xcf, 0x47, 0x8e, 0x9b, 0xdb, 0xd7, 0x51, 0x93, 0x92,
+    0xc6, 0xb1, 0x2b, 0x0e, 0xbf, 0x00, 0x51, 0x41, 0x7b, 0xac, 0x06, 0xdf, 0x1a, 0xef, 0x4d, 0x9b, 0x8d, 0x59, 0x07, 0xdf,
+    0xee, 0xae, 0x6b, 0xba, 0x18, 0x9d, 0x8f, 0xfd, 0x15, 0x42, 0x8c, 0xc5, 0x43, 0xaa, 0xde, 0x5d, 0xc7, 0x93, 0x7f, 0x70,
+    0xe6, 0xc9, 0x34, 0x42, 0x79, 0x32, 0x7d, 0x31, 0x61, 0x96, 0xe8, 0x28, 0x71, 0xc7, 0xa4, 0x12, 0xce, 0x15, 0xf1, 0xdf,
+    0x76, 0xc4, 0x77, 0xf1, 0x10, 0x29, 0xde, 0xfc, 0xfe, 0xf1, 0xed, 0x57, 0x9e, 0x10, 0x1c, 0x3e, 0xba, 0xf4, 0xde, 0x9c,
+    0x12, 0x10, 0xe5, 0xdd, 0xe6, 0xd4, 0x50, 0xcf, 0x6b, 0xe6, 0x8c, 0xd1, 0x0f, 0xd8, 0x79, 0x83, 0x8e, 0x55, 0x20, 0x7c,
+    0x6f, 0x81, 0xd1, 0xa3, 0xec, 0xad, 0xa5, 0x7a, 0xa8, 0x81, 0x51, 0x93, 0xa9, 0xe7, 0xc4, 0xea, 0xbc, 0xed, 0xc7, 0xea,
+    0x2f, 0xf2, 0xa4, 0x0b, 0x39, 0xf5, 0x94, 0xb5, 0x66, 0x58, 0x16, 0x71, 0x63, 0x5a, 0x78, 0x39, 0x9a, 0x31, 0x33, 0x5a,
+    0x2a, 0x94, 0x97, 0x45, 0xac, 0x8c, 0x14, 0xa3, 0x7b, 0x63, 0xa1, 0x2a, 0x66, 0xc9, 0x2c, 0xa4, 0xf5, 0xfd, 0x27, 0x7b,
+    0x4b, 0xce, 0x79, 0x72, 0xb8, 0x1d, 0x24, 0x1e, 0xb2, 0x4c, 0x26, 0x89, 0xc9, 0xe1, 0xdf, 0xf1, 0x07, 0x88, 0xb3, 0xc6,
+    0xf5, 0x4c, 0x04, 0x00, 0x00,
+};
+constexpr Asset MUSIC = {MUSIC_GZ, sizeof(MUSIC_GZ), "\"b58d4dbdf745e4e9\"", "text/html"};
+
+// alarm.html: 8789 bytes -> 2251 bytes gzipped
+const uint8_t ALARM_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x59, 0x7d, 0x72, 0xdb, 0xb8, 0x15, 0xff, 0x5f, 0xa7,
+    0xc0, 0x72, 0xd3, 0x25, 0x35, 0x11, 0xa9, 0x4f, 0xcb, 0xb6, 0x64, 0x69, 0x26, 0x1f, 0xce, 0x24, 0x9d, 0xcd, 0x26, 0x53,
+    0x7b, 0xa7, 0xd3, 0xc9, 0x64, 0x1a, 0x88, 0x04, 0x45, 0x24, 0x24, 0xa1, 0x92, 0xa0, 0x1d, 0xad, 0xc7, 0x67, 0xd8, 0x23,
+    0xec, 0x1e, 0xa1, 0x67, 0xea, 0x09, 0x7a, 0x84, 0xbe, 0x07, 0x90, 0x14, 0x44, 0x49, 0xb6, 0xd2, 0x6d, 0x27, 0xd9, 0x90,
+    0x00, 0xf1, 0xf0, 0xbe, 0x7e, 0xef, 0x87, 0x07, 0xed, 0xc5, 0x77, 0x2f, 0xdf, 0xbd, 0xb8, 0xfe, 0xdb, 0xfb, 0x4b, 0x12,
+    0xc9, 0x24, 0x9e, 0xb7, 0x2e, 0xf0, 0x41, 0x62, 0x9a, 0x2e, 0x67, 0x16, 0x4b, 0x2d, 0x9c, 0x60, 0x34, 0x80, 0x47, 0xc2,
+    0x24, 0x25, 0x7e, 0x44, 0xb3, 0x9c, 0xc9, 0x99, 0xf5, 0xf3, 0xf5, 0x2b, 0xf7, 0xcc, 0xaa, 0xa6, 0x53, 0x9a, 0xb0, 0x99,
+    0x75, 0xc3, 0xd9, 0xed, 0x4a, 0x64, 0xd2, 0x6a, 0xf9, 0x22, 0x95, 0x2c, 0x85, 0x65, 0xb7, 0x3c, 0x90, 0xd1, 0x2c, 0x60,
+    0x37, 0xdc, 0x67, 0xae, 0x1a, 0x74, 0x08, 0x4f, 0xb9, 0xe4, 0x34, 0x76, 0x73, 0x9f, 0xc6, 0x6c, 0xd6, 0xf7, 0x7a, 0x1d,
+    0x92, 0xd0, 0xaf, 0x3c, 0x29, 0x12, 0x73, 0xaa, 0xc8, 0x59, 0xa6, 0xc6, 0x74, 0x01, 0x53, 0xa9, 0xe8, 0x90, 0x6a, 0x7b,
+    0x37, 0xe4, 0x72, 0xe6, 0x8b, 0x1b, 0x96, 0x35, 0xf4, 0xcb, 0x88, 0x25, 0xcc, 0xf5, 0x45, 0x2c, 0x32, 0x8b, 0xd4, 0x26,
+    0x7c, 0xdf, 0xa7, 0xf8, 0x07, 0xd7, 0x4a, 0x2e, 0x63, 0x36, 0xbf, 0x62, 0x92, 0x3c, 0x8b, 0x69, 0x96, 0x5c, 0x74, 0xf5,
+    0x44, 0xeb, 0x22, 0x97, 0x6b, 0x7c, 0x2e, 0x44, 0xb0, 0x26, 0x77, 0xad, 0x05, 0xf5, 0xbf, 0x2c, 0x33, 0x51, 0xa4, 0xc1,
+    0x84, 0x94, 0xd2, 0xd3, 0x96, 0xda, 0x16, 0xc6, 0x61, 0x18, 0x4e, 0x5b, 0x21, 0x6c, 0xee, 0x86, 0x34, 0xe1, 0xf1, 0x7a,
+    0x42, 0xec, 0x2b, 0xb6, 0x14, 0x8c, 0xfc, 0xfc, 0xc6, 0xee, 0x90, 0x7c, 0x9d, 0x4b, 0x96, 0xb8, 0x05, 0x87, 0x57, 0x9a,
+    0xe6, 0x2e, 0x38, 0xc1, 0x61, 0x7d, 0xc0, 0xf3, 0x55, 0x4c, 0x61, 0x6d, 0x18, 0xb3, 0xaf, 0x20, 0x0e, 0xff, 0xba, 0x01,
+    0xcf, 0x98, 0x2f, 0xb9, 0x48, 0x27, 0x60, 0x6b, 0x5c, 0x24, 0xe9, 0xb4, 0x45, 0x63, 0xbe, 0x4c, 0x5d, 0x0e, 0x3b, 0xe4,
+    0x30, 0x09, 0xd6, 0xb3, 0x6c, 0xda, 0xfa, 0x5c, 0xe4, 0x92, 0x87, 0x6b, 0xb7, 0x74, 0x68, 0xf3, 0x21, 0xe1, 0xa9, 0x1b,
+    0x31, 0xbe, 0x8c, 0x60, 0xae, 0xdf, 0xeb, 0xdd, 0x44, 0x30, 0x45, 0xb3, 0x25, 0x87, 0x0d, 0x7b, 0xd3, 0xd6, 0x7d, 0xcb,
+    0x43, 0x09, 0xca, 0x53, 0x96, 0x35, 0x7d, 0x1a, 0x0c, 0x06, 0x53, 0x70, 0x36, 0x0b, 0x20, 0xc4, 0x19, 0x0d, 0x78, 0x01,
+    0xea, 0xfa, 0x83, 0x15, 0x58, 0xb6, 0xa2, 0x41, 0xc0, 0xd3, 0xe5, 0x84, 0x0c, 0x61, 0x48, 0x06, 0x23, 0x9c, 0x5b, 0x88,
+    0xaf, 0x6e, 0x1e, 0xd1, 0x40, 0xdc, 0xc2, 0xc6, 0x04, 0xe7, 0xfb, 0x63, 0xf8, 0x27, 0x5b, 0x2e, 0xa8, 0x03, 0x89, 0x2a,
+    0xff, 0x7a, 0x83, 0xf6, 0x1f, 0xf3, 0x73, 0x49, 0x57, 0x93, 0x52, 0x23, 0xc0, 0x41, 0x83, 0x05, 0xec, 0x38, 0xe9, 0xe1,
+    0x4c, 0x39, 0x02, 0x37, 0xff, 0x84, 0xae, 0x01, 0x28, 0x58, 0x0c, 0x5e, 0xa9, 0x3c, 0xe4, 0xfc, 0x17, 0x06, 0x9f, 0xbc,
+    0x01, 0x4b, 0xaa, 0x08, 0xb8, 0x0b, 0x21, 0xa5, 0x48, 0x26, 0xe4, 0x0c, 0x85, 0xef, 0x5b, 0x3c, 0x5d, 0x15, 0xf2, 0x83,
+    0x5c, 0xaf, 0x10, 0x25, 0x3c, 0x61, 0xd6, 0xc7, 0xbd, 0xc2, 0xb5, 0xf7, 0x67, 0xda, 0xef, 0xad, 0x00, 0x19, 0x73, 0x13,
+    0x92, 0x8a, 0x94, 0x4d, 0xb7, 0x83, 0x3a, 0x1c, 0x0e, 0x1b, 0x28, 0x69, 0xd8, 0x82, 0x51, 0x6b, 0x78, 0xa2, 0x42, 0xcb,
+    0x7f, 0x51, 0x3a, 0x4b, 0x75, 0x30, 0x85, 0x16, 0x2f, 0x0a, 0x10, 0x4a, 0x1b, 0x89, 0x8b, 0x21, 0x99, 0x34, 0x73, 0x97,
+    0x68, 0x12, 0x44, 0xcd, 0x19, 0x9d, 0x04, 0x6c, 0xd9, 0x21, 0xdf, 0x8f, 0x4e, 0x4f, 0xc7, 0x97, 0x63, 0x78, 0x39, 0xbb,
+    0x3c, 0x19, 0x5d, 0x9e, 0xb7, 0xf7, 0xa1, 0xb5, 0x72, 0xb4, 0x8f, 0x8e, 0x36, 0xdc, 0xd8, 0xe3, 0x68, 0x1d, 0x8a, 0xfe,
+    0x06, 0x08, 0x7e, 0x91, 0xe5, 0xb8, 0xeb, 0x4a, 0x70, 0x9d, 0xb2, 0x2d, 0x5f, 0x4a, 0x6f, 0xa5, 0x58, 0x95, 0x5b, 0xc8,
+    0x0c, 0x2a, 0x80, 0xeb, 0xcc, 0x6f, 0xbc, 0x40, 0xa4, 0xe4, 0x1b, 0x0f, 0x27, 0x11, 0x16, 0xf2, 0x91, 0x7e, 0x0e, 0xc7,
+    0x27, 0xe3, 0xc5, 0x10, 0x5e, 0xc6, 0xfe, 0x30, 0xf4, 0xc3, 0xb6, 0x42, 0x79, 0x40, 0xd7, 0xb9, 0x6b, 0x42, 0xbd, 0x01,
+    0x42, 0x85, 0x2b, 0x65, 0x90, 0x82, 0xe3, 0x6d, 0x86, 0x63, 0xfc, 0xf7, 0xa1, 0xd2, 0x2a, 0xeb, 0x48, 0x01, 0xbd, 0xb7,
+    0x03, 0x3f, 0xd4, 0xe9, 0xfa, 0x11, 0xf3, 0xbf, 0x40, 0xb6, 0x4c, 0x8d, 0x3a, 0x9e, 0xe5, 0x82, 0x0a, 0xa4, 0x8f, 0xa0,
+    0xc4, 0x04, 0x5d, 0x59, 0x85, 0x8d, 0x84, 0x8c, 0xf7, 0x06, 0xdf, 0x0c, 0x2f, 0x8d, 0xe3, 0x32, 0xae, 0x9a, 0x36, 0x59,
+    0x0c, 0x25, 0x57, 0x99, 0x63, 0xa4, 0xbf, 0xe7, 0x9d, 0x63, 0xfa, 0x1b, 0x1e, 0x4c, 0xd4, 0x0b, 0x0b, 0x9e, 0x1e, 0x34,
+    0xfb, 0x78, 0xe0, 0xc1, 0xd6, 0x19, 0xcb, 0x8b, 0x58, 0xc2, 0x0e, 0x26, 0x22, 0x34, 0xf8, 0x4d, 0x24, 0xa2, 0x21, 0x55,
+    0x20, 0x46, 0x2f, 0x9e, 0xbd, 0x3a, 0xe9, 0x35, 0x28, 0x4d, 0xd7, 0x24, 0x6c, 0x48, 0x91, 0xac, 0x73, 0x37, 0xe6, 0x39,
+    0xee, 0x7a, 0x10, 0x74, 0x1a, 0xa4, 0xd5, 0x7a, 0x45, 0x2f, 0x7b, 0xa3, 0xff, 0x28, 0xdc, 0xf7, 0xb3, 0x48, 0x03, 0x56,
+    0x3b, 0xd8, 0xc9, 0x57, 0x14, 0xce, 0xb8, 0x05, 0x93, 0xb7, 0x8c, 0x1d, 0xe2, 0xb8, 0x8d, 0x71, 0x69, 0x28, 0x90, 0x82,
+    0x10, 0x91, 0x60, 0x1d, 0x30, 0x6b, 0xdf, 0xf8, 0x8a, 0x14, 0x75, 0x0c, 0xbb, 0x6d, 0x3b, 0x8c, 0x85, 0xb0, 0x2d, 0x55,
+    0xa6, 0xbb, 0x8a, 0x32, 0xa5, 0xd4, 0x58, 0x4e, 0x15, 0x29, 0xe7, 0x0f, 0x15, 0xcc, 0xce, 0xda, 0x9a, 0x95, 0x8c, 0x83,
+    0x66, 0x0f, 0x7e, 0x77, 0x4d, 0x28, 0x93, 0x46, 0x0b, 0x29, 0x34, 0xfc, 0x00, 0xa1, 0x12, 0xa2, 0x25, 0x8f, 0xa5, 0x38,
+    0x36, 0x1e, 0x9d, 0x8e, 0x4e, 0xf1, 0xe5, 0xfc, 0x64, 0x74, 0x32, 0x6a, 0x37, 0x76, 0xf9, 0x26, 0x1a, 0x59, 0x0c, 0x87,
+    0xe3, 0x21, 0xa2, 0xd6, 0x0f, 0x87, 0xf0, 0x47, 0xef, 0x95, 0x88, 0x00, 0xd3, 0x79, 0xbc, 0x45, 0xa3, 0x53, 0x36, 0xa6,
+    0x7d, 0x78, 0x39, 0x19, 0xb1, 0xf3, 0xc5, 0x59, 0x73, 0x97, 0x6f, 0x24, 0xb6, 0xc5, 0xf0, 0xac, 0x87, 0x2f, 0x40, 0x6b,
+    0xe7, 0xda, 0xbb, 0x8b, 0x6e, 0xd9, 0x95, 0x5c, 0x74, 0xcb, 0x0e, 0x0c, 0xdb, 0x13, 0x78, 0x04, 0xfc, 0x86, 0xf8, 0x31,
+    0xcd, 0xf3, 0x99, 0x55, 0xd3, 0x9e, 0xea, 0xd3, 0x06, 0xf3, 0x7f, 0xfd, 0xfa, 0x4f, 0x52, 0xb7, 0x37, 0xe4, 0x1a, 0x60,
+    0x04, 0xc2, 0x03, 0xf8, 0xa6, 0x8b, 0x3a, 0x14, 0xd9, 0xcc, 0x52, 0x19, 0xc5, 0x4f, 0xd6, 0x7c, 0xb3, 0x8c, 0x38, 0xaf,
+    0x5f, 0x4f, 0xde, 0xbe, 0x6d, 0x5f, 0x74, 0xd5, 0x4a, 0x90, 0x50, 0x47, 0x26, 0x31, 0x8e, 0x4c, 0xc2, 0x83, 0x2d, 0xe1,
+    0x2d, 0x43, 0xb6, 0x49, 0xd8, 0x6a, 0xc8, 0x57, 0x44, 0xa3, 0xf7, 0x48, 0x44, 0x6a, 0x19, 0x72, 0xee, 0xe6, 0xeb, 0x0d,
+    0x8d, 0x0b, 0x58, 0xde, 0xb7, 0xb6, 0x2d, 0x6e, 0x0a, 0xa8, 0x4f, 0xd6, 0xfc, 0xad, 0x48, 0xf7, 0x9b, 0xbb, 0xad, 0x4e,
+    0x16, 0xec, 0x61, 0x75, 0x83, 0x86, 0xba, 0xa6, 0x40, 0xa9, 0xee, 0xba, 0x60, 0xc7, 0xa8, 0xbb, 0x65, 0xc1, 0xc3, 0xea,
+    0x86, 0x0d, 0x75, 0x4d, 0x81, 0x52, 0xdd, 0x5f, 0x59, 0x70, 0x94, 0x77, 0x51, 0xf1, 0xb0, 0xba, 0x51, 0xd3, 0xbb, 0x86,
+    0x40, 0xe5, 0x5d, 0x54, 0x1c, 0xa3, 0x2e, 0xcc, 0xf8, 0xc3, 0xea, 0x4e, 0x1a, 0xea, 0x9a, 0x02, 0xa5, 0xba, 0x57, 0x19,
+    0x3f, 0x46, 0x5d, 0x4e, 0xe5, 0xc3, 0xea, 0xc6, 0x0d, 0x75, 0x4d, 0x81, 0x52, 0xdd, 0x15, 0x95, 0x47, 0xa9, 0x2b, 0x1e,
+    0x41, 0x66, 0xaf, 0xa9, 0xae, 0xd8, 0x8b, 0xcc, 0xab, 0xc2, 0x40, 0x66, 0x17, 0xca, 0x04, 0x8b, 0x57, 0x53, 0xa7, 0x52,
+    0xc3, 0xa4, 0xaa, 0xbc, 0xe7, 0x12, 0xee, 0x57, 0xc6, 0x6d, 0x44, 0x2f, 0xd9, 0x2e, 0x2c, 0x7d, 0x98, 0x6a, 0xf3, 0xca,
+    0xf7, 0x79, 0xb5, 0xa5, 0xb1, 0xcc, 0x38, 0x22, 0x8d, 0x42, 0xcd, 0x7f, 0xc4, 0xf1, 0x7c, 0x8f, 0x09, 0x91, 0x48, 0xd8,
+    0x73, 0x35, 0xb4, 0x88, 0x48, 0xfd, 0x98, 0xfb, 0x5f, 0x66, 0x56, 0x2c, 0x7c, 0x8a, 0x3c, 0xef, 0x45, 0x19, 0x0b, 0x67,
+    0x76, 0xd7, 0xb6, 0xe6, 0xff, 0xfe, 0xed, 0xd7, 0xdf, 0xc9, 0x6b, 0x81, 0x3c, 0x52, 0x5b, 0x57, 0xee, 0x96, 0xfb, 0x19,
+    0x5f, 0xc9, 0x39, 0xde, 0xf5, 0xe0, 0x5c, 0x06, 0xef, 0x7f, 0x82, 0x4b, 0x58, 0x4e, 0x66, 0xe4, 0x83, 0x05, 0xfe, 0x5b,
+    0x1d, 0x62, 0x41, 0x81, 0xe2, 0x03, 0x0a, 0x07, 0x1f, 0x00, 0x68, 0x35, 0x02, 0xfc, 0xc1, 0x03, 0x00, 0x80, 0x0f, 0x48,
+    0x8c, 0xf5, 0x11, 0x0e, 0x8c, 0x22, 0x55, 0x27, 0x0c, 0x46, 0x35, 0xa1, 0xf2, 0x25, 0xb0, 0x89, 0x83, 0x94, 0xf2, 0x2c,
+    0xcb, 0xe8, 0xba, 0x0d, 0x24, 0x9a, 0x31, 0x59, 0x64, 0x29, 0xa9, 0xe7, 0xbc, 0x84, 0xae, 0x9c, 0x80, 0xcc, 0xe6, 0xb5,
+    0xe2, 0x0f, 0xc1, 0xc7, 0xb6, 0xf7, 0x19, 0x9a, 0x23, 0x07, 0xae, 0x61, 0xb6, 0x62, 0x50, 0x9a, 0xaf, 0x53, 0x9f, 0xd4,
+    0x7b, 0xc7, 0x82, 0x06, 0x2a, 0xd2, 0xb9, 0x83, 0x5b, 0xca, 0x0c, 0xef, 0x7a, 0xda, 0x7a, 0x88, 0xec, 0x0a, 0x5e, 0x18,
+    0x58, 0x4f, 0x6f, 0x29, 0x97, 0x24, 0x64, 0xd2, 0x8f, 0x1c, 0xbb, 0x8b, 0x01, 0x75, 0x75, 0x2c, 0x6d, 0xd5, 0x56, 0xe3,
+    0x6a, 0x3d, 0xae, 0xd7, 0x56, 0xc2, 0xde, 0xe7, 0x5c, 0xa4, 0x4e, 0x63, 0x15, 0x66, 0x00, 0x56, 0x06, 0xc2, 0x2f, 0x12,
+    0x60, 0x7c, 0x6f, 0xc9, 0xe4, 0x65, 0xcc, 0xf0, 0xf5, 0xf9, 0xfa, 0x4d, 0xe0, 0xd8, 0x9b, 0x55, 0xb8, 0xff, 0x66, 0xe4,
+    0xf1, 0x14, 0x88, 0xf4, 0xf5, 0xf5, 0xdb, 0x1f, 0x41, 0xda, 0xb6, 0xab, 0x4f, 0x1e, 0x04, 0xe8, 0x92, 0x82, 0x69, 0x6a,
+    0x88, 0xfe, 0xdf, 0x99, 0xea, 0xde, 0x60, 0xcf, 0x63, 0x68, 0xf3, 0x33, 0x46, 0x25, 0x2b, 0x15, 0x3a, 0x36, 0x24, 0xae,
+    0xd6, 0x82, 0x4b, 0x3d, 0x85, 0x1e, 0x0c, 0x1f, 0x2a, 0xd9, 0xb4, 0x4d, 0xb6, 0xb9, 0xc6, 0x34, 0xe4, 0xd3, 0x2e, 0xe8,
+    0x54, 0x2b, 0x63, 0xed, 0x41, 0xa3, 0xea, 0x62, 0xac, 0xf9, 0x93, 0x3b, 0x35, 0xf2, 0x70, 0x74, 0x7f, 0x08, 0xb9, 0xaa,
+    0x77, 0xc1, 0xb5, 0x46, 0xfe, 0xb5, 0x18, 0x7e, 0x68, 0xd7, 0x72, 0x87, 0xc4, 0xcb, 0xfe, 0xc4, 0xda, 0x80, 0xbc, 0xfc,
+    0xbc, 0x39, 0x8f, 0x0d, 0x9c, 0xeb, 0x49, 0x05, 0x05, 0xc7, 0xde, 0xb2, 0x0f, 0xa0, 0xf3, 0xe4, 0xee, 0xcf, 0x57, 0xef,
+    0x7e, 0xf2, 0x72, 0x99, 0x41, 0x53, 0x03, 0xcb, 0xb6, 0xec, 0x68, 0xe3, 0xa9, 0x83, 0xc2, 0x46, 0x39, 0x6c, 0x2b, 0xdc,
+    0xb4, 0x24, 0x86, 0x42, 0x3d, 0xb9, 0x57, 0x21, 0xec, 0xf8, 0x52, 0x7d, 0xdd, 0x29, 0xb0, 0x4f, 0x5b, 0x70, 0xa0, 0xab,
+    0x15, 0x4b, 0x83, 0x17, 0x11, 0x8f, 0x03, 0xa7, 0xce, 0x0d, 0xa2, 0x1c, 0xff, 0x23, 0x50, 0xb7, 0x7e, 0x44, 0x1c, 0x96,
+    0x65, 0x22, 0x6b, 0x97, 0x90, 0x10, 0x31, 0xf3, 0xd4, 0x84, 0x63, 0x5f, 0xe2, 0x43, 0xe1, 0x1f, 0x7c, 0x2a, 0x81, 0x39,
+    0x01, 0x5f, 0xf5, 0x7a, 0x2c, 0x95, 0x9d, 0x62, 0x31, 0x4d, 0x46, 0x4b, 0x8f, 0xae, 0x98, 0x32, 0x00, 0x4a, 0x09, 0xa8,
+    0x80, 0x56, 0x91, 0xc9, 0x48, 0x40, 0xef, 0x63, 0xbf, 0x7f, 0x77, 0x75, 0x6d, 0x77, 0x5a, 0xd8, 0xcc, 0xb0, 0x0c, 0x9a,
+    0xe2, 0x3b, 0x62, 0xbf, 0xd0, 0xcd, 0xb3, 0x7b, 0x0d, 0x64, 0x6c, 0xc3, 0x12, 0xf0, 0x12, 0x22, 0xa6, 0x48, 0xa8, 0x8b,
+    0xd5, 0x64, 0x93, 0xfb, 0x8e, 0xfa, 0x55, 0x66, 0x42, 0x1a, 0x59, 0xb9, 0x23, 0xaa, 0x49, 0xbe, 0x6f, 0xab, 0x08, 0xf0,
+    0x90, 0x38, 0x75, 0x19, 0x8a, 0x2f, 0x68, 0xac, 0x59, 0xed, 0x53, 0xd2, 0xed, 0x92, 0xbf, 0xb0, 0x10, 0x96, 0x44, 0x44,
+    0x46, 0x8c, 0x60, 0x59, 0xb7, 0x0e, 0xd6, 0xa4, 0xe6, 0x59, 0xbb, 0xed, 0x49, 0xf6, 0x55, 0x96, 0x26, 0x62, 0x81, 0xe8,
+    0x76, 0x49, 0x3b, 0x18, 0x90, 0xbc, 0xf0, 0x7d, 0x96, 0xe7, 0x61, 0x11, 0xc7, 0x6b, 0x28, 0x98, 0xc7, 0x77, 0x53, 0xed,
+    0x9c, 0xa7, 0x9a, 0x71, 0xdc, 0xad, 0xbc, 0xf4, 0xd8, 0x98, 0x3f, 0x16, 0xe7, 0xd8, 0xf0, 0xcb, 0x08, 0xae, 0x02, 0x24,
+    0x65, 0xb7, 0xe4, 0x52, 0x27, 0xee, 0x15, 0xe5, 0x31, 0xa8, 0x92, 0xa2, 0xd4, 0xaa, 0x73, 0xa7, 0xd9, 0x6d, 0x37, 0xeb,
+    0xdf, 0xec, 0x90, 0xc6, 0x85, 0xda, 0xba, 0x06, 0x06, 0x64, 0x81, 0x3c, 0xd5, 0xc8, 0xf8, 0x6f, 0x9c, 0x0a, 0x86, 0x83,
+    0x70, 0x10, 0xda, 0x1a, 0x53, 0x35, 0x9a, 0xcc, 0x8a, 0xc3, 0xbc, 0x75, 0x14, 0x93, 0x3f, 0x68, 0x73, 0xdd, 0x69, 0x82,
+    0x12, 0x75, 0xfa, 0xc2, 0xf6, 0x28, 0x0a, 0x46, 0x81, 0x68, 0xcd, 0x83, 0x30, 0x30, 0x59, 0xb0, 0xbe, 0x94, 0x1b, 0x24,
+    0xf8, 0x8f, 0x82, 0x65, 0xeb, 0x2b, 0x75, 0x25, 0x86, 0x98, 0x7e, 0xda, 0xba, 0xfa, 0x7e, 0x28, 0x0f, 0xf6, 0x27, 0x77,
+    0x30, 0x7b, 0x6f, 0x7d, 0xfc, 0x54, 0x82, 0xa9, 0xfa, 0xde, 0xae, 0x77, 0xf4, 0xca, 0x4b, 0x32, 0x9a, 0x91, 0x15, 0x4c,
+    0x57, 0xde, 0x4e, 0x95, 0x94, 0x48, 0x4b, 0xa0, 0xf7, 0x57, 0x40, 0x13, 0x71, 0xa0, 0xc3, 0x0a, 0x37, 0xa0, 0x34, 0x10,
+    0xb7, 0x1e, 0x9c, 0x9a, 0x22, 0x8e, 0xaf, 0x85, 0xfa, 0xe5, 0x4c, 0x2f, 0xbf, 0x52, 0x53, 0x98, 0x64, 0xb8, 0xc6, 0xe2,
+    0x23, 0x8f, 0x00, 0x05, 0x28, 0x8d, 0x6c, 0x88, 0xbf, 0x76, 0x99, 0x50, 0x3e, 0x1c, 0x31, 0xa3, 0xad, 0x80, 0x98, 0xc1,
+    0xad, 0xec, 0xf2, 0x06, 0xbe, 0x21, 0x7b, 0x30, 0x60, 0x70, 0xc7, 0x56, 0x64, 0x04, 0x25, 0x59, 0x67, 0xc5, 0x69, 0xd7,
+    0x71, 0x53, 0xc5, 0xf4, 0xd8, 0x31, 0x65, 0x66, 0x63, 0xba, 0xe1, 0x01, 0x00, 0xc2, 0x4b, 0x20, 0xe4, 0x07, 0xa4, 0x2b,
+    0xb4, 0xe8, 0xd8, 0x7e, 0x57, 0xf1, 0x49, 0x2d, 0xdb, 0xc4, 0xe5, 0xfb, 0x98, 0x51, 0x28, 0x08, 0xfd, 0x33, 0x06, 0xa1,
+    0xda, 0x3a, 0x08, 0x86, 0x0a, 0x8a, 0x66, 0x4f, 0x40, 0xd8, 0x46, 0xfc, 0x20, 0x08, 0x75, 0xdb, 0x80, 0x60, 0xac, 0xbb,
+    0x14, 0xd5, 0xa1, 0x60, 0xcb, 0x01, 0x6b, 0x1d, 0xc8, 0x1e, 0xe1, 0x30, 0xd1, 0x9b, 0xc2, 0xe3, 0x82, 0x9c, 0xc2, 0xe3,
+    0xe9, 0xd3, 0xf6, 0xff, 0x00, 0x4d, 0x7c, 0x0f, 0x96, 0xc8, 0x0f, 0x3f, 0xec, 0xa0, 0x49, 0x95, 0x00, 0xe2, 0x79, 0x55,
+    0xe4, 0x91, 0xc3, 0x4b, 0x2e, 0x46, 0x29, 0x35, 0x1b, 0xb3, 0x74, 0x29, 0x23, 0x32, 0x9b, 0x81, 0x89, 0xdf, 0x12, 0x31,
+    0x49, 0x70, 0x2c, 0xe1, 0x04, 0x62, 0xe8, 0xf3, 0x1f, 0x8c, 0x5d, 0x45, 0xed, 0x00, 0xb0, 0xbf, 0xff, 0xdf, 0x79, 0xbd,
+    0x85, 0xc9, 0x9e, 0xa8, 0x94, 0x77, 0x54, 0x68, 0x26, 0x2a, 0x6b, 0x2d, 0xc5, 0xf4, 0x2d, 0x0f, 0xbc, 0x48, 0x9d, 0xcd,
+    0xe1, 0x33, 0xdf, 0x74, 0x5f, 0x18, 0x11, 0xa7, 0x6d, 0x2c, 0xc1, 0x1f, 0xa1, 0x14, 0x35, 0x1c, 0x8c, 0x9a, 0x26, 0x74,
+    0x70, 0x4b, 0x05, 0x08, 0x79, 0x4f, 0x33, 0xcc, 0xe1, 0xe8, 0xd4, 0x9c, 0xfd, 0x4d, 0xbc, 0x65, 0x9b, 0x02, 0x5b, 0x00,
+    0x7a, 0x16, 0xc7, 0x8e, 0xbd, 0x85, 0x21, 0x10, 0xab, 0xb8, 0xcd, 0x5f, 0xa0, 0xfd, 0xfe, 0xc2, 0xa0, 0x9e, 0x90, 0xc2,
+    0x49, 0x01, 0x28, 0xd9, 0xa6, 0x04, 0x0c, 0x8c, 0x3a, 0x0c, 0xf4, 0x59, 0xf0, 0x88, 0xd7, 0x9a, 0xf5, 0xc1, 0xeb, 0x03,
+    0xa4, 0x7f, 0x04, 0x36, 0xee, 0xcb, 0xce, 0xe3, 0xa2, 0x5b, 0xdd, 0x02, 0xa0, 0x7d, 0xd1, 0xbf, 0x4e, 0x74, 0xf5, 0xff,
+    0x46, 0xfa, 0x0f, 0x0f, 0xd4, 0xa3, 0x9e, 0x57, 0x1a, 0x00, 0x00,
+};
+constexpr Asset ALARM = {ALARM_GZ, sizeof(ALARM_GZ), "\"b7159fab9c7c03cf\"", "text/html"};
+
+} // namespace WebAssets
+
+#endif /* DRAWMATRIX_WEBASSETS */
@@ -0,0 +1,195 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      WifiManager.cpp                                                                                          *
+ * @brief     Non-blocking WiFi station bring-up with cached BSSID/channel/IP for fast re-association                  *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#include "WifiManager.hpp"
+
+#include <ESP8266WiFi.h>
+#include <LittleFS.h>
+
+#include "AsyncTasker.hpp"
+
+namespace WifiManager {
+namespace {
+/**
+ * @brief Last good association: enough to skip the channel scan and the DHCP exchange.
+ */
+struct Association {
+    uint8_t bssid[6] = {};
+    int32_t channel = 0;
+    IPAddress ip;
+    IPAddress gateway;
+    IPAddress mask;
+    IPAddress dns;
+
+    bool operator==(const Association &other) const {
+        return memcmp(bssid, other.bssid, sizeof(bssid)) == 0 && channel == other.channel && ip == other.ip &&
+               gateway == other.gateway && mask == other.mask && dns == other.dns;
+    }
+};
+
+const char *m_ssid = nullptr;
+const char *m_password = nullptr;
+std::function<void()> m_on_connected;
+WiFiEventHandler m_got_ip_handler;
+Association m_cached;
+bool m_has_cache = false;
+uint32_t m_attempt = 0; // bumped on every (re)connect so stale fallback timers can tell they are stale
+BootTimes m_boot_times;
+
+// --------------------------------------------------------------------------------------
+bool load_cache(Association &assoc) {
+    if (!LittleFS.exists(CACHE_FILE)) {
+        return false;
+    }
+    File file = LittleFS.open(CACHE_FILE, "r");
+    if (!file) {
+        return false;
+    }
+    // Format: "AA:BB:CC:DD:EE:FF,<channel>,<ip>,<gateway>,<mask>,<dns>"
+    String line = file.readStringUntil('\n');
+    file.close();
+    line.trim();
+
+    unsigned int b[6];
+    int channel = 0;
+    char ip[16], gateway[16], mask[16], dns[16];
+    if (sscanf(line.c_str(), "%x:%x:%x:%x:%x:%x,%d,%15[^,],%15[^,],%15[^,],%15s", &b[0], &b[1], &b[2], &b[3], &b[4],
+               &b[5], &channel, ip, gateway, mask, dns) != 11) {
+        Serial.printf("Ignoring malformed %s\n", CACHE_FILE);
+        return false;
+    }
+    for (size_t i = 0; i < 6; i++) {
+        assoc.bssid[i] = static_cast<uint8_t>(b[i]);
+    }
+    assoc.channel = channel;
+    return assoc.ip.fromString(ip) && assoc.gateway.fromString(gateway) && assoc.mask.fromString(mask) &&
+           assoc.dns.fromString(dns) && channel > 0;
+}
+
+// --------------------------------------------------------------------------------------
+void save_cache(const Association &assoc) {
+    // Only touch flash when the association actually changed
+    if (m_has_cache && assoc == m_cached) {
+        return;
+    }
+    File file = LittleFS.open(CACHE_FILE, "w");
+    if (!file) {
+        Serial.printf("Failed to open %s for writing\n", CACHE_FILE);
+        return;
+    }
+    file.printf("%02X:%02X:%02X:%02X:%02X:%02X,%d,%s,%s,%s,%s\n", assoc.bssid[0], assoc.bssid[1], assoc.bssid[2],
+                assoc.bssid[3], assoc.bssid[4], assoc.bssid[5], static_cast<int>(assoc.channel),
+                assoc.ip.toString().c_str(), assoc.gateway.toString().c_str(), assoc.mask.toString().c_str(),
+                assoc.dns.toString().c_str());
+    file.close();
+    m_cached = assoc;
+    m_has_cache = true;
+    Serial.printf("WiFi association cached to %s\n", CACHE_FILE);
+}
+
+// --------------------------------------------------------------------------------------
+void connect_scan() {
+    Serial.println("WiFi: scan + DHCP connect");
+    m_boot_times.fast_connect = false;
+    WiFi.config(IPAddress(0U), IPAddress(0U), IPAddress(0U)); // back to DHCP
+    WiFi.begin(m_ssid, m_password);
+}
+
+// --------------------------------------------------------------------------------------
+void connect() {
+    const uint32_t attempt = ++m_attempt;
+    if (!m_has_cache) {
+        connect_scan();
+        return;
+    }
+
+    Serial.printf("WiFi: fast connect on channel %d\n", static_cast<int>(m_cached.channel));
+    m_boot_times.fast_connect = true;
+    WiFi.config(m_cached.ip, m_cached.gateway, m_cached.mask, m_cached.dns);
+    WiFi.begin(m_ssid, m_password, m_cached.channel, m_cached.bssid);
+
+    AsyncTasker::schedule(FAST_CONNECT_TIMEOUT_MS, [attempt](uint64_t, uint64_t &, bool &) {
+        if (attempt != m_attempt || WiFi.status() == WL_CONNECTED) {
+            return;
+        }
+        Serial.println("WiFi: fast connect timed out, AP moved or lease gone");
+        WiFi.disconnect();
+        connect_scan();
+    });
+}
+} // namespace
+
+// --------------------------------------------------------------------------------------
+void begin(const char *ssid, const char *password, std::function<void()> on_connected) {
+    m_ssid = ssid;
+    m_password = password;
+    m_on_connected = on_connected;
+    m_has_cache = load_cache(m_cached);
+
+    WiFi.persistent(false); // we keep our own cache; avoid the SDK rewriting its flash sector on every begin()
+    WiFi.mode(WIFI_STA);
+    WiFi.setAutoReconnect(true);
+
+    m_got_ip_handler = WiFi.onStationModeGotIP([](const WiFiEventStationModeGotIP &event) {
+        if (m_boot_times.wifi_connected_ms == 0) {
+            m_boot_times.wifi_connected_ms = millis();
+        }
+        Serial.printf("Connected to %s, IP address: %s (%lu ms since boot)\n", m_ssid, event.ip.toString().c_str(),
+                      millis());
+
+        Association assoc;
+        memcpy(assoc.bssid, WiFi.BSSID(), sizeof(assoc.bssid));
+        assoc.channel = WiFi.channel();
+        assoc.ip = event.ip;
+        assoc.gateway = event.gw;
+        assoc.mask = event.mask;
+        assoc.dns = WiFi.dnsIP();
+        // The event fires from the SDK context; defer flash I/O and user callbacks to the event loop
+        AsyncTasker::schedule(0, [assoc](uint64_t, uint64_t &, bool &) {
+            save_cache(assoc);
+            if (m_on_connected) {
+                m_on_connected();
+            }
+        });
+    });
+
+    connect();
+}
+
+// --------------------------------------------------------------------------------------
+void reconnect() {
+    WiFi.disconnect();
+    connect();
+}
+
+// --------------------------------------------------------------------------------------
+bool connected() { return WiFi.status() == WL_CONNECTED; }
+
+// --------------------------------------------------------------------------------------
+void mark_first_pixel() {
+    if (m_boot_times.first_pixel_ms == 0) {
+        m_boot_times.first_pixel_ms = millis();
+        Serial.printf("Boot: first pixel after %u ms\n", static_cast<unsigned>(m_boot_times.first_pixel_ms));
+    }
+}
+
+// --------------------------------------------------------------------------------------
+void mark_request() {
+    if (m_boot_times.first_request_ms == 0) {
+        m_boot_times.first_request_ms = millis();
+        Serial.printf("Boot: first request served after %u ms\n", static_cast<unsigned>(m_boot_times.first_request_ms));
+    }
+}
+
+// --------------------------------------------------------------------------------------
+const BootTimes &boot_times() { return m_boot_times; }
+
+} // namespace WifiManager
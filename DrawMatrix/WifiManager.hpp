@@ -0,0 +1,73 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      WifiManager.hpp                                                                                          *
+ * @brief     Non-blocking WiFi station bring-up with cached BSSID/channel/IP for fast re-association                  *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+#ifndef DRAWMATRIX_WIFIMANAGER
+#define DRAWMATRIX_WIFIMANAGER
+
+#include <cstdint>
+#include <functional>
+
+namespace WifiManager {
+
+// How long a targeted (cached BSSID/channel/static lease) connect may take before falling back to scan + DHCP
+constexpr uint32_t FAST_CONNECT_TIMEOUT_MS = 3000;
+// Where the last good association is cached (LittleFS must be mounted before begin())
+constexpr const char *CACHE_FILE = "/wifi.bin";
+
+/**
+ * @brief Boot timing milestones, in milliseconds since reset (0 = not reached yet).
+ */
+struct BootTimes {
+    uint32_t first_pixel_ms = 0;   ///< Display initialised and first frame shown
+    uint32_t wifi_connected_ms = 0; ///< Station got an IP address
+    uint32_t first_request_ms = 0; ///< First HTTP request served
+    bool fast_connect = false;     ///< Association used the cached BSSID/channel/lease
+};
+
+/**
+ * @brief Start connecting to the access point without blocking.
+ *
+ * If a cached association exists, a targeted connect (known BSSID and channel, previous IP lease) is attempted
+ * first; when it does not complete within FAST_CONNECT_TIMEOUT_MS a regular scan + DHCP connect is started.
+ * @param ssid Network name.
+ * @param password Network passphrase.
+ * @param on_connected Called once each time the station obtains an IP address.
+ */
+void begin(const char *ssid, const char *password, std::function<void()> on_connected = nullptr);
+
+/**
+ * @brief Restart the association without blocking (e.g. after repeated NTP failures).
+ */
+void reconnect();
+
+/**
+ * @brief Whether the station currently has an IP address.
+ */
+bool connected();
+
+/**
+ * @brief Record that the display has shown its first frame.
+ */
+void mark_first_pixel();
+
+/**
+ * @brief Record that a request has been served (only the first call is kept).
+ */
+void mark_request();
+
+/**
+ * @brief Boot timing milestones collected so far.
+ */
+const BootTimes &boot_times();
+
+} // namespace WifiManager
+
+#endif /* DRAWMATRIX_WIFIMANAGER */
@@ -107,20 +107,21 @@ static String generateEventMessage(const char *message, const char *event, uint3
 // Message
 
 AsyncEventSourceMessage::AsyncEventSourceMessage(const char * data, size_t len)
-: _data(nullptr), _len(len), _sent(0), _acked(0)
+: _payload(AsyncWebSharedPayload::create((const uint8_t *)data, len)), _len(len), _sent(0), _acked(0)
 {
-  _data = (uint8_t*)malloc(_len+1);
-  if(_data == nullptr){
+  if(_payload == nullptr)
     _len = 0;
-  } else {
-    memcpy(_data, data, len);
-    _data[_len] = 0;
-  }
+}
+
+AsyncEventSourceMessage::AsyncEventSourceMessage(AsyncWebSharedPayload * payload)
+: _payload(payload), _len(payload->length()), _sent(0), _acked(0)
+{
+  _payload->retain();
 }
 
 AsyncEventSourceMessage::~AsyncEventSourceMessage() {
-     if(_data != NULL)
-        free(_data);
+  if(_payload != nullptr)
+    _payload->release();
 }
 
 size_t AsyncEventSourceMessage::ack(size_t len, uint32_t time) {
@@ -144,7 +145,7 @@ size_t AsyncEventSourceMessage::send(AsyncClient *client) {
   if(client->space() < len){
     return 0;
   }
-  size_t sent = client->add((const char *)_data, len);
+  size_t sent = client->add((const char *)_payload->data() + _sent, len);
   client->send();
   _sent += sent;
   return sent;
@@ -153,7 +154,7 @@ size_t AsyncEventSourceMessage::send(AsyncClient *client) {
 // Client
 
 AsyncEventSourceClient::AsyncEventSourceClient(AsyncWebServerRequest *request, AsyncEventSource *server)
-: _messageQueue(LinkedList<AsyncEventSourceMessage *>([](AsyncEventSourceMessage *m){ delete  m; }))
+: _messageQueue(LinkedList<AsyncEventSourceMessage *, AsyncWebPooledNode>([](AsyncEventSourceMessage *m){ delete  m; }))
 {
   _client = request->client();
   _server = server;
@@ -230,6 +231,10 @@ void AsyncEventSourceClient::write(const char * message, size_t len){
   _queueMessage(new AsyncEventSourceMessage(message, len));
 }
 
+void AsyncEventSourceClient::_write(AsyncWebSharedPayload * payload){
+  _queueMessage(new AsyncEventSourceMessage(payload));
+}
+
 void AsyncEventSourceClient::send(const char *message, const char *event, uint32_t id, uint32_t reconnect){
   String ev = generateEventMessage(message, event, id, reconnect);
   _queueMessage(new AsyncEventSourceMessage(ev.c_str(), ev.length()));
@@ -316,11 +321,16 @@ void AsyncEventSource::send(const char *message, const char *event, uint32_t id,
 
 
   String ev = generateEventMessage(message, event, id, reconnect);
+  // One copy of the event for all clients
+  AsyncWebSharedPayload *payload = AsyncWebSharedPayload::create((const uint8_t *)ev.c_str(), ev.length());
+  if(payload == NULL)
+    return;
   for(const auto &c: _clients){
     if(c->connected()) {
-      c->write(ev.c_str(), ev.length());
+      c->_write(payload);
     }
   }
+  payload->release();
 }
 
 size_t AsyncEventSource::count() const {
@@ -34,6 +34,7 @@
 
 #include <ESPAsyncWebServer.h>
 
+#include "AsyncWebPool.h"
 #include "AsyncWebSynchronization.h"
 
 #ifdef ESP8266
@@ -54,15 +55,16 @@ class AsyncEventSourceResponse;
 class AsyncEventSourceClient;
 typedef std::function<void(AsyncEventSourceClient *client)> ArEventHandlerFunction;
 
-class AsyncEventSourceMessage {
+class AsyncEventSourceMessage: public AsyncWebPooled {
   private:
-    uint8_t * _data;
+    AsyncWebSharedPayload * _payload; // shared by every client the event is queued to
     size_t _len;
     size_t _sent;
     //size_t _ack;
     size_t _acked;
   public:
     AsyncEventSourceMessage(const char * data, size_t len);
+    AsyncEventSourceMessage(AsyncWebSharedPayload * payload);
     ~AsyncEventSourceMessage();
     size_t ack(size_t len, uint32_t time __attribute__((unused)));
     size_t send(AsyncClient *client);
@@ -75,7 +77,7 @@ class AsyncEventSourceClient {
     AsyncClient *_client;
     AsyncEventSource *_server;
     uint32_t _lastId;
-    LinkedList<AsyncEventSourceMessage *> _messageQueue;
+    LinkedList<AsyncEventSourceMessage *, AsyncWebPooledNode> _messageQueue;
     void _queueMessage(AsyncEventSourceMessage *dataMessage);
     void _runQueue();
 
@@ -93,6 +95,7 @@ class AsyncEventSourceClient {
     size_t  packetsWaiting() const { return _messageQueue.length(); }
 
     //system callbacks (do not call)
+    void _write(AsyncWebSharedPayload * payload);
     void _onAck(size_t len, uint32_t time);
     void _onPoll();
     void _onTimeout(uint32_t time);
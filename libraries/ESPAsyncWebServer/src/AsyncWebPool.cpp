@@ -0,0 +1,118 @@
+/*
+  Asynchronous WebServer library for Espressif MCUs
+
+  Copyright (c) 2016 Hristo Gochkov. All rights reserved.
+  This file is part of the esp8266 core for Arduino environment.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+#include "Arduino.h"
+#include "ESPAsyncWebServer.h"
+#include "AsyncWebPool.h"
+#include "AsyncWebSynchronization.h"
+
+#include <new>
+
+static_assert(ASYNC_WEB_OBJECT_POOL_BLOCK % sizeof(void *) == 0, "pool blocks must keep pointer alignment");
+static_assert(ASYNC_WEB_PAYLOAD_POOL_BLOCK % sizeof(void *) == 0, "pool blocks must keep pointer alignment");
+static_assert(ASYNC_WEB_NODE_POOL_BLOCK % sizeof(void *) == 0, "pool blocks must keep pointer alignment");
+static_assert(ASYNC_WEB_NODE_POOL_BLOCK >= sizeof(AsyncWebPooledNode<void *>), "node blocks must fit a queue node");
+
+// Pools run from the TCP callbacks and from the sketch; only the ESP32 needs the lock to do anything
+static AsyncWebLock _poolLock;
+
+AsyncWebPool::AsyncWebPool(uint8_t *storage, size_t blockSize, size_t blocks)
+  : _storage(storage)
+  , _blockSize(blockSize)
+  , _blocks(blocks)
+  , _free(NULL)
+  , _stats()
+{
+  // Free list threaded through the free blocks themselves
+  for(size_t i = blocks; i > 0; i--){
+    void *block = storage + (i - 1) * blockSize;
+    *(void **)block = _free;
+    _free = block;
+  }
+}
+
+void *AsyncWebPool::alloc(size_t size){
+  AsyncWebLockGuard l(_poolLock);
+  if(size > _blockSize || _free == NULL){
+    _stats.misses++;
+    return malloc(size);
+  }
+  void *block = _free;
+  _free = *(void **)block;
+  _stats.hits++;
+  if(++_stats.used > _stats.peak)
+    _stats.peak = _stats.used;
+  return block;
+}
+
+void AsyncWebPool::release(void *p){
+  if(p == NULL)
+    return;
+  AsyncWebLockGuard l(_poolLock);
+  if((uint8_t *)p < _storage || (uint8_t *)p >= _storage + _blockSize * _blocks){
+    free(p);
+    return;
+  }
+  *(void **)p = _free;
+  _free = p;
+  _stats.used--;
+}
+
+AsyncWebPool &AsyncWebPool::objects(){
+  alignas(void *) static uint8_t storage[ASYNC_WEB_OBJECT_POOL_BLOCK * ASYNC_WEB_OBJECT_POOL_BLOCKS];
+  static AsyncWebPool pool(storage, ASYNC_WEB_OBJECT_POOL_BLOCK, ASYNC_WEB_OBJECT_POOL_BLOCKS);
+  return pool;
+}
+
+AsyncWebPool &AsyncWebPool::payloads(){
+  alignas(void *) static uint8_t storage[ASYNC_WEB_PAYLOAD_POOL_BLOCK * ASYNC_WEB_PAYLOAD_POOL_BLOCKS];
+  static AsyncWebPool pool(storage, ASYNC_WEB_PAYLOAD_POOL_BLOCK, ASYNC_WEB_PAYLOAD_POOL_BLOCKS);
+  return pool;
+}
+
+AsyncWebPool &AsyncWebPool::nodes(){
+  alignas(void *) static uint8_t storage[ASYNC_WEB_NODE_POOL_BLOCK * ASYNC_WEB_NODE_POOL_BLOCKS];
+  static AsyncWebPool pool(storage, ASYNC_WEB_NODE_POOL_BLOCK, ASYNC_WEB_NODE_POOL_BLOCKS);
+  return pool;
+}
+
+void *AsyncWebPooled::operator new(size_t size) noexcept {
+  return AsyncWebPool::objects().alloc(size);
+}
+
+void AsyncWebPooled::operator delete(void *p){
+  AsyncWebPool::objects().release(p);
+}
+
+AsyncWebSharedPayload *AsyncWebSharedPayload::create(const uint8_t *data, size_t len){
+  void *mem = AsyncWebPool::payloads().alloc(sizeof(AsyncWebSharedPayload) + len + 1);
+  if(mem == NULL)
+    return NULL;
+  AsyncWebSharedPayload *payload = new (mem) AsyncWebSharedPayload(len);
+  if(data != NULL)
+    memcpy(payload->data(), data, len);
+  payload->data()[len] = 0;
+  return payload;
+}
+
+void AsyncWebSharedPayload::release(){
+  if(--_refs == 0)
+    AsyncWebPool::payloads().release(this);
+}
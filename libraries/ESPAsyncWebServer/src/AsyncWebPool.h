@@ -0,0 +1,122 @@
+/*
+  Asynchronous WebServer library for Espressif MCUs
+
+  Copyright (c) 2016 Hristo Gochkov. All rights reserved.
+  This file is part of the esp8266 core for Arduino environment.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+#ifndef ASYNCWEBPOOL_H_
+#define ASYNCWEBPOOL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Fixed-size block pools for WebSocket and SSE messages.
+ *
+ * Streaming tens of messages per second, a malloc/free per message object and per payload copy fragments the
+ * ESP8266 heap. Message objects, payloads and the queue nodes that hold them come from these pools instead; anything
+ * bigger than a block, or asked for while the pool is empty, falls back to the heap and is counted as a miss, so the
+ * counters tell how to size them.
+ * */
+
+// Object blocks fit every message, control frame and message buffer object
+#ifndef ASYNC_WEB_OBJECT_POOL_BLOCK
+#define ASYNC_WEB_OBJECT_POOL_BLOCK (12 * sizeof(void *))
+#endif
+#ifndef ASYNC_WEB_OBJECT_POOL_BLOCKS
+#define ASYNC_WEB_OBJECT_POOL_BLOCKS 24
+#endif
+// Payload blocks fit control frames, short text messages and SSE events
+#ifndef ASYNC_WEB_PAYLOAD_POOL_BLOCK
+#define ASYNC_WEB_PAYLOAD_POOL_BLOCK 128
+#endif
+#ifndef ASYNC_WEB_PAYLOAD_POOL_BLOCKS
+#define ASYNC_WEB_PAYLOAD_POOL_BLOCKS 8
+#endif
+// Node blocks fit the LinkedList node of a message queue (a pointer and the next one)
+#ifndef ASYNC_WEB_NODE_POOL_BLOCK
+#define ASYNC_WEB_NODE_POOL_BLOCK (2 * sizeof(void *))
+#endif
+#ifndef ASYNC_WEB_NODE_POOL_BLOCKS
+#define ASYNC_WEB_NODE_POOL_BLOCKS 48
+#endif
+
+typedef struct {
+  uint32_t hits;   // served from the pool
+  uint32_t misses; // served from the heap: too big, or the pool was empty
+  uint16_t used;   // blocks in use
+  uint16_t peak;   // most blocks ever in use at once
+} AsyncWebPoolStats;
+
+class AsyncWebPool {
+  private:
+    uint8_t *_storage;
+    size_t _blockSize;
+    size_t _blocks;
+    void *_free;
+    AsyncWebPoolStats _stats;
+
+  public:
+    AsyncWebPool(uint8_t *storage, size_t blockSize, size_t blocks);
+    void *alloc(size_t size);
+    void release(void *p);
+    size_t blockSize() const { return _blockSize; }
+    size_t blocks() const { return _blocks; }
+    const AsyncWebPoolStats &stats() const { return _stats; }
+
+    static AsyncWebPool &objects();  // message, control frame and message buffer objects
+    static AsyncWebPool &payloads(); // message bytes
+    static AsyncWebPool &nodes();    // message queue nodes
+};
+
+// Routes a class's new/delete through the object pool
+class AsyncWebPooled {
+  public:
+    static void *operator new(size_t size) noexcept;
+    static void operator delete(void *p);
+};
+
+// LinkedList node taken from the node pool, for the message queues: LinkedList<T, AsyncWebPooledNode>
+template <typename T>
+class AsyncWebPooledNode {
+    T _value;
+  public:
+    AsyncWebPooledNode<T>* next;
+    AsyncWebPooledNode(const T val): _value(val), next(nullptr) {}
+    const T& value() const { return _value; }
+    T& value(){ return _value; }
+    static void *operator new(size_t size) noexcept { return AsyncWebPool::nodes().alloc(size); }
+    static void operator delete(void *p){ AsyncWebPool::nodes().release(p); }
+};
+
+// Reference counted message bytes (NUL terminated), shared by every client a message is queued to
+class AsyncWebSharedPayload {
+  private:
+    uint32_t _refs;
+    size_t _len;
+    AsyncWebSharedPayload(size_t len): _refs(1), _len(len) {}
+
+  public:
+    // Copy of data (or uninitialised bytes when data is NULL), nullptr when out of memory
+    static AsyncWebSharedPayload *create(const uint8_t *data, size_t len);
+    void retain() { _refs++; }
+    void release();
+    uint8_t *data() { return (uint8_t *)(this + 1); }
+    size_t length() const { return _len; }
+};
+
+#endif /* ASYNCWEBPOOL_H_ */
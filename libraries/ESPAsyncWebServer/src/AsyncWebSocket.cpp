@@ -64,12 +64,7 @@ size_t webSocketSendFrame(AsyncClient *client, bool final, uint8_t opcode, bool
 
   if(len > space) len = space;
 
-  uint8_t *buf = (uint8_t*)malloc(headLen);
-  if(buf == NULL){
-    //os_printf("could not malloc %u bytes for frame header\n", headLen);
-    return 0;
-  }
-
+  uint8_t buf[8]; // at most 2 + 2 (length) + 4 (mask); add() copies it
   buf[0] = opcode & 0x0F;
   if(final)
     buf[0] |= 0x80;
@@ -86,10 +81,8 @@ size_t webSocketSendFrame(AsyncClient *client, bool final, uint8_t opcode, bool
   }
   if(client->add((const char *)buf, headLen) != headLen){
     //os_printf("error adding %lu header bytes\n", headLen);
-    free(buf);
     return 0;
   }
-  free(buf);
 
   if(len){
     if(len && mask){
@@ -133,7 +126,7 @@ AsyncWebSocketMessageBuffer::AsyncWebSocketMessageBuffer(uint8_t * data, size_t
     return;
   }
 
-  _data = new uint8_t[_len + 1];
+  _data = (uint8_t *)AsyncWebPool::payloads().alloc(_len + 1);
 
   if (_data) {
     memcpy(_data, data, _len);
@@ -148,7 +141,7 @@ AsyncWebSocketMessageBuffer::AsyncWebSocketMessageBuffer(size_t size)
   ,_lock(false)
   ,_count(0)
 {
-  _data = new uint8_t[_len + 1];
+  _data = (uint8_t *)AsyncWebPool::payloads().alloc(_len + 1);
 
   if (_data) {
     _data[_len] = 0;
@@ -167,8 +160,7 @@ AsyncWebSocketMessageBuffer::AsyncWebSocketMessageBuffer(const AsyncWebSocketMes
   _count = 0;
 
   if (_len) {
-    _data = new uint8_t[_len + 1];
-    _data[_len] = 0;
+    _data = (uint8_t *)AsyncWebPool::payloads().alloc(_len + 1);
   }
 
   if (_data) {
@@ -197,21 +189,16 @@ AsyncWebSocketMessageBuffer::AsyncWebSocketMessageBuffer(AsyncWebSocketMessageBu
 
 AsyncWebSocketMessageBuffer::~AsyncWebSocketMessageBuffer()
 {
-    if (_data) {
-      delete[] _data;
-    }
+    AsyncWebPool::payloads().release(_data);
 }
 
 bool AsyncWebSocketMessageBuffer::reserve(size_t size)
 {
   _len = size;
 
-  if (_data) {
-    delete[] _data;
-    _data = nullptr;
-  }
+  AsyncWebPool::payloads().release(_data);
 
-  _data = new uint8_t[_len + 1];
+  _data = (uint8_t *)AsyncWebPool::payloads().alloc(_len + 1);
 
   if (_data) {
     _data[_len] = 0;
@@ -228,7 +215,7 @@ bool AsyncWebSocketMessageBuffer::reserve(size_t size)
  * Control Frame
  */
 
-class AsyncWebSocketControl {
+class AsyncWebSocketControl: public AsyncWebPooled {
   private:
     uint8_t _opcode;
     uint8_t *_data;
@@ -247,15 +234,14 @@ class AsyncWebSocketControl {
       if(_len){
         if(_len > 125)
           _len = 125;
-        _data = (uint8_t*)malloc(_len);
+        _data = (uint8_t*)AsyncWebPool::payloads().alloc(_len);
         if(_data == NULL)
           _len = 0;
         else memcpy(_data, data, len);
       } else _data = NULL;
     }
     virtual ~AsyncWebSocketControl(){
-      if(_data != NULL)
-        free(_data);
+      AsyncWebPool::payloads().release(_data);
     }
     virtual bool finished() const { return _finished; }
     uint8_t opcode(){ return _opcode; }
@@ -279,7 +265,7 @@ AsyncWebSocketBasicMessage::AsyncWebSocketBasicMessage(const char * data, size_t
 {
   _opcode = opcode & 0x07;
   _mask = mask;
-  _data = (uint8_t*)malloc(_len+1);
+  _data = (uint8_t*)AsyncWebPool::payloads().alloc(_len+1);
   if(_data == NULL){
     _len = 0;
     _status = WS_MSG_ERROR;
@@ -303,8 +289,7 @@ AsyncWebSocketBasicMessage::AsyncWebSocketBasicMessage(uint8_t opcode, bool mask
 
 
 AsyncWebSocketBasicMessage::~AsyncWebSocketBasicMessage() {
-  if(_data != NULL)
-    free(_data);
+  AsyncWebPool::payloads().release(_data);
 }
 
  void AsyncWebSocketBasicMessage::ack(size_t len, uint32_t time)  {
@@ -462,8 +447,8 @@ AsyncWebSocketMultiMessage::~AsyncWebSocketMultiMessage() {
  const size_t AWSC_PING_PAYLOAD_LEN = 22;
 
 AsyncWebSocketClient::AsyncWebSocketClient(AsyncWebServerRequest *request, AsyncWebSocket *server)
-  : _controlQueue(LinkedList<AsyncWebSocketControl *>([](AsyncWebSocketControl *c){ delete  c; }))
-  , _messageQueue(LinkedList<AsyncWebSocketMessage *>([](AsyncWebSocketMessage *m){ delete  m; }))
+  : _controlQueue(LinkedList<AsyncWebSocketControl *, AsyncWebPooledNode>([](AsyncWebSocketControl *c){ delete  c; }))
+  , _messageQueue(LinkedList<AsyncWebSocketMessage *, AsyncWebPooledNode>([](AsyncWebSocketMessage *m){ delete  m; }))
   , _tempObject(NULL)
 {
   _client = request->client();
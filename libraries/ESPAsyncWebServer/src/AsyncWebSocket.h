@@ -35,6 +35,7 @@
 #endif
 #include <ESPAsyncWebServer.h>
 
+#include "AsyncWebPool.h"
 #include "AsyncWebSynchronization.h"
 
 #ifdef ESP8266
@@ -84,7 +85,7 @@ typedef enum { WS_CONTINUATION, WS_TEXT, WS_BINARY, WS_DISCONNECT = 0x08, WS_PIN
 typedef enum { WS_MSG_SENDING, WS_MSG_SENT, WS_MSG_ERROR } AwsMessageStatus;
 typedef enum { WS_EVT_CONNECT, WS_EVT_DISCONNECT, WS_EVT_PONG, WS_EVT_ERROR, WS_EVT_DATA } AwsEventType;
 
-class AsyncWebSocketMessageBuffer {
+class AsyncWebSocketMessageBuffer: public AsyncWebPooled {
   private:
     uint8_t * _data;
     size_t _len;
@@ -112,7 +113,7 @@ class AsyncWebSocketMessageBuffer {
 
 };
 
-class AsyncWebSocketMessage {
+class AsyncWebSocketMessage: public AsyncWebPooled {
   protected:
     uint8_t _opcode;
     bool _mask;
@@ -165,8 +166,8 @@ class AsyncWebSocketClient {
     uint32_t _clientId;
     AwsClientStatus _status;
 
-    LinkedList<AsyncWebSocketControl *> _controlQueue;
-    LinkedList<AsyncWebSocketMessage *> _messageQueue;
+    LinkedList<AsyncWebSocketControl *, AsyncWebPooledNode> _controlQueue;
+    LinkedList<AsyncWebSocketMessage *, AsyncWebPooledNode> _messageQueue;
 
     uint8_t _pstate;
     AwsFrameInfo _pinfo;
@@ -136,6 +136,7 @@ class AsyncWebServerRequest {
   using FS = fs::FS;
   friend class AsyncWebServer;
   friend class AsyncCallbackWebHandler;
+  friend class AsyncWebServerResponse;
   private:
     AsyncClient* _client;
     AsyncWebServer* _server;
@@ -160,11 +161,20 @@ class AsyncWebServerRequest {
     bool _isMultipart;
     bool _isPlainPost;
     bool _expectingContinue;
+    bool _connectionClose;         // client sent "Connection: close"
+    bool _keepAlive;               // connection stays open for another request once the response is acked
+    uint8_t _requestCount;         // requests served on this connection
+    String _pipelined;             // bytes of the next request(s) received before the current response finished
     size_t _contentLength;
     size_t _parsedLength;
 
-    LinkedList<AsyncWebHeader *> _headers;
-    LinkedList<AsyncWebParameter *> _params;
+    // Headers and query parameters are kept raw (undecoded) and only turned into AsyncWebHeader/AsyncWebParameter
+    // objects when a handler asks for them; lookups by name scan the raw text without allocating.
+    String _rawQuery;              // "a=1&b=2", still URL-encoded
+    String _rawHeaders;            // "Name:value\n" per header
+    size_t _rawHeadersReserved;
+    mutable LinkedList<AsyncWebHeader *> _headers;   // materialized headers (cache)
+    mutable LinkedList<AsyncWebParameter *> _params; // materialized query params (cache) and body params
     LinkedList<String *> _pathParams;
 
     uint8_t _multiParseState;
@@ -185,6 +195,10 @@ class AsyncWebServerRequest {
     void _onTimeout(uint32_t time);
     void _onDisconnect();
     void _onData(void *buf, size_t len);
+    void _ackResponse(size_t len, uint32_t time);
+    void _nextRequest();
+    void _reset();
+    bool _wantsKeepAlive() const;
 
     void _addParam(AsyncWebParameter*);
     void _addPathParam(const char *param);
@@ -195,6 +209,11 @@ class AsyncWebServerRequest {
     void _parsePlainPostChar(uint8_t data);
     void _parseMultipartPostByte(uint8_t data, bool last);
     void _addGetParams(const String& params);
+    void _appendRawHeader(const char *name, size_t nameLen, const char *value);
+    AsyncWebHeader* _headerNode(const char *name, size_t nameLen, const char *value, size_t valueLen) const;
+    AsyncWebParameter* _queryParamNode(const char *name, size_t nameLen, const char *value, size_t valueLen) const;
+    AsyncWebParameter* _queryParam(const char *name) const;
+    size_t _queryParamCount() const;
 
     void _handleUploadStart();
     void _handleUploadByte(uint8_t data, bool last);
@@ -215,6 +234,7 @@ class AsyncWebServerRequest {
     const String& contentType() const { return _contentType; }
     size_t contentLength() const { return _contentLength; }
     bool multipart() const { return _isMultipart; }
+    bool keepAlive() const { return _keepAlive; }
     const char * methodToString() const;
     const char * requestedConnTypeToString() const;
     RequestedConnectionType requestedConnType() const { return _reqconntype; }
@@ -369,6 +389,7 @@ class AsyncWebServerResponse {
     size_t _writtenLength;
     WebResponseState _state;
     const char* _responseCodeToString(int code);
+    void _addConnectionHeader(AsyncWebServerRequest *request);
 
   public:
     AsyncWebServerResponse();
@@ -400,6 +421,8 @@ class AsyncWebServer {
     LinkedList<AsyncWebRewrite*> _rewrites;
     LinkedList<AsyncWebHandler*> _handlers;
     AsyncCallbackWebHandler* _catchAllHandler;
+    uint16_t _keepAliveTimeout;
+    uint8_t _keepAliveMax;
 
   public:
     AsyncWebServer(uint16_t port);
@@ -432,6 +455,12 @@ class AsyncWebServer {
     void onRequestBody(ArBodyHandlerFunction fn); //handle posts with plain body content (JSON often transmitted this way as a request)
 
     void reset(); //remove all writers and handlers, with onNotFound/onFileUpload/onRequestBody 
+
+    // HTTP/1.1 persistent connections: keep a connection open for up to maxRequests requests, closing it after
+    // idleTimeout seconds without a new request. Disabled (idleTimeout 0) by default.
+    void setKeepAlive(uint16_t idleTimeout, uint8_t maxRequests = 16);
+    uint16_t keepAliveTimeout() const { return _keepAliveTimeout; }
+    uint8_t keepAliveMax() const { return _keepAliveMax; }
   
     void _handleDisconnect(AsyncWebServerRequest *request);
     void _attachHandler(AsyncWebServerRequest *request);
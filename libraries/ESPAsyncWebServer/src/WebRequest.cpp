@@ -22,16 +22,88 @@
 #include "WebResponseImpl.h"
 #include "WebAuthentication.h"
 
+#include <algorithm>
+#include <utility>
+
 #ifndef ESP8266
 #define os_strlen strlen
 #endif
 
 static const String SharedEmptyString = String();
 
+// Decode the URL-encoded character at text[i] (of len), advancing i past it
+static char urlDecodeChar(const char *text, size_t len, size_t &i){
+  char c = text[i++];
+  if(c == '%' && i + 1 < len){
+    char hex[3] = { text[i], text[i + 1], 0 };
+    i += 2;
+    return (char)strtol(hex, NULL, 16);
+  }
+  return c == '+' ? ' ' : c;
+}
+
+static void urlDecodeAppend(String &out, const char *text, size_t len){
+  out.reserve(out.length() + len); // never longer than the source text
+  size_t i = 0;
+  while(i < len){
+    out.concat(urlDecodeChar(text, len, i));
+  }
+}
+
+// Whether URL-encoded text (of len) decodes to plain, without decoding into a buffer
+static bool urlDecodedEquals(const char *text, size_t len, const char *plain){
+  size_t i = 0;
+  while(i < len){
+    if(*plain == 0 || urlDecodeChar(text, len, i) != *plain++)
+      return false;
+  }
+  return *plain == 0;
+}
+
+// Views into a raw "name=value&..." query or "Name:value\n..." header block
+struct RawEntry {
+  const char *name;
+  size_t nameLen;
+  const char *value;
+  size_t valueLen;
+};
+
+static bool nextEntry(const char *&p, const char *end, char separator, char assign, RawEntry &e){
+  if(p >= end) return false;
+  const char *stop = (const char *)memchr(p, separator, end - p);
+  if(!stop) stop = end;
+  const char *eq = (const char *)memchr(p, assign, stop - p);
+  e.name = p;
+  e.nameLen = (eq ? eq : stop) - p;
+  e.value = eq ? eq + 1 : stop;
+  e.valueLen = stop - e.value;
+  p = stop < end ? stop + 1 : end;
+  return true;
+}
+
+static bool nextQueryEntry(const char *&p, const char *end, RawEntry &e){ return nextEntry(p, end, '&', '=', e); }
+static bool nextHeaderEntry(const char *&p, const char *end, RawEntry &e){ return nextEntry(p, end, '\n', ':', e); }
+
+static bool nameEqualsIgnoreCase(const char *name, size_t nameLen, const char *other){
+  return strlen(other) == nameLen && strncasecmp(name, other, nameLen) == 0;
+}
+
+static bool containsIgnoreCase(const char *text, const char *find){
+  const size_t flen = strlen(find);
+  for(; *text; text++){
+    if(strncasecmp(text, find, flen) == 0) return true;
+  }
+  return false;
+}
+
 #define __is_param_char(c) ((c) && ((c) != '{') && ((c) != '[') && ((c) != '&') && ((c) != '='))
 
 enum { PARSE_REQ_START, PARSE_REQ_HEADERS, PARSE_REQ_BODY, PARSE_REQ_END, PARSE_REQ_FAIL };
 
+// Most bytes of pipelined requests held while a response is still going out; a client sending more is not
+// waiting for answers and gets disconnected
+static const size_t PIPELINE_MAX = 2048;
+
 AsyncWebServerRequest::AsyncWebServerRequest(AsyncWebServer* s, AsyncClient* c)
   : _client(c)
   , _server(s)
@@ -51,8 +123,15 @@ AsyncWebServerRequest::AsyncWebServerRequest(AsyncWebServer* s, AsyncClient* c)
   , _isMultipart(false)
   , _isPlainPost(false)
   , _expectingContinue(false)
+  , _connectionClose(false)
+  , _keepAlive(false)
+  , _requestCount(0)
+  , _pipelined()
   , _contentLength(0)
   , _parsedLength(0)
+  , _rawQuery()
+  , _rawHeaders()
+  , _rawHeadersReserved(0)
   , _headers(LinkedList<AsyncWebHeader *>([](AsyncWebHeader *h){ delete h; }))
   , _params(LinkedList<AsyncWebParameter *>([](AsyncWebParameter *p){ delete p; }))
   , _pathParams(LinkedList<String *>([](String *p){ delete p; }))
@@ -132,39 +211,41 @@ void AsyncWebServerRequest::_onData(void *buf, size_t len){
     // A handler should be already attached at this point in _parseLine function.
     // If handler does nothing (_onRequest is NULL), we don't need to really parse the body.
     const bool needParse = _handler && !_handler->isRequestHandlerTrivial();
+    // Anything past the body belongs to the next (pipelined) request
+    const size_t bodyLen = std::min(len, _contentLength - _parsedLength);
     if(_isMultipart){
       if(needParse){
         size_t i;
-        for(i=0; i<len; i++){
-          _parseMultipartPostByte(((uint8_t*)buf)[i], i == len - 1);
+        for(i=0; i<bodyLen; i++){
+          _parseMultipartPostByte(((uint8_t*)buf)[i], i == bodyLen - 1);
           _parsedLength++;
         }
       } else
-          _parsedLength += len;
+          _parsedLength += bodyLen;
     } else {
       if(_parsedLength == 0){
         if(_contentType.startsWith("application/x-www-form-urlencoded")){
           _isPlainPost = true;
         } else if(_contentType == "text/plain" && __is_param_char(((char*)buf)[0])){
           size_t i = 0;
-          while (i<len && __is_param_char(((char*)buf)[i++]));
-          if(i < len && ((char*)buf)[i-1] == '='){
+          while (i<bodyLen && __is_param_char(((char*)buf)[i++]));
+          if(i < bodyLen && ((char*)buf)[i-1] == '='){
             _isPlainPost = true;
           }
         }
       }
       if(!_isPlainPost) {
         //check if authenticated before calling the body
-        if(_handler) _handler->handleBody(this, (uint8_t*)buf, len, _parsedLength, _contentLength);
-        _parsedLength += len;
+        if(_handler) _handler->handleBody(this, (uint8_t*)buf, bodyLen, _parsedLength, _contentLength);
+        _parsedLength += bodyLen;
       } else if(needParse) {
         size_t i;
-        for(i=0; i<len; i++){
+        for(i=0; i<bodyLen; i++){
           _parsedLength++;
           _parsePlainPostChar(((uint8_t*)buf)[i]);
         }
       } else {
-        _parsedLength += len;
+        _parsedLength += bodyLen;
       }
     }
     if(_parsedLength == _contentLength){
@@ -173,6 +254,21 @@ void AsyncWebServerRequest::_onData(void *buf, size_t len){
       if(_handler) _handler->handleRequest(this);
       else send(501);
     }
+    if(bodyLen < len){
+      buf = (uint8_t*)buf + bodyLen;
+      len -= bodyLen;
+      continue;
+    }
+  } else if(_parseState == PARSE_REQ_END){
+    // The client did not wait for our response: hold the next request until the response has been acked,
+    // parsing it now would clobber the request being answered
+    if(_keepAlive){
+      if(_pipelined.length() + len > PIPELINE_MAX){
+        _client->close();
+      } else {
+        _pipelined.concat((const char*)buf, len);
+      }
+    }
   }
   break;
   }
@@ -180,6 +276,24 @@ void AsyncWebServerRequest::_onData(void *buf, size_t len){
 
 void AsyncWebServerRequest::_removeNotInterestingHeaders(){
   if (_interestingHeaders.containsIgnoreCase("ANY")) return; // nothing to do
+  // Compact the raw block in place
+  size_t pos = 0;
+  while(pos < _rawHeaders.length()){
+    const char *line = _rawHeaders.c_str() + pos;
+    const char *end = _rawHeaders.c_str() + _rawHeaders.length();
+    RawEntry e;
+    const char *next = line;
+    nextHeaderEntry(next, end, e);
+    bool interesting = false;
+    for(const auto& h: _interestingHeaders){
+      if(nameEqualsIgnoreCase(e.name, e.nameLen, h.c_str())){
+        interesting = true;
+        break;
+      }
+    }
+    if(interesting) pos += next - line;
+    else _rawHeaders.remove(pos, next - line);
+  }
   for(const auto& header: _headers){
       if(!_interestingHeaders.containsIgnoreCase(header->name().c_str())){
         _headers.remove(header);
@@ -190,7 +304,7 @@ void AsyncWebServerRequest::_removeNotInterestingHeaders(){
 void AsyncWebServerRequest::_onPoll(){
   //os_printf("p\n");
   if(_response != NULL && _client != NULL && _client->canSend() && !_response->_finished()){
-    _response->_ack(this, 0, 0);
+    _ackResponse(0, 0);
   }
 }
 
@@ -198,7 +312,7 @@ void AsyncWebServerRequest::_onAck(size_t len, uint32_t time){
   //os_printf("a:%u:%u\n", len, time);
   if(_response != NULL){
     if(!_response->_finished()){
-      _response->_ack(this, len, time);
+      _ackResponse(len, time);
     } else {
       AsyncWebServerResponse* r = _response;
       _response = NULL;
@@ -207,6 +321,93 @@ void AsyncWebServerRequest::_onAck(size_t len, uint32_t time){
   }
 }
 
+void AsyncWebServerRequest::_ackResponse(size_t len, uint32_t time){
+  // Read before _ack(): upgrading responses (WebSocket, SSE) hand the client over and delete this request in there,
+  // they are never kept alive
+  const bool keepAlive = _keepAlive;
+  _response->_ack(this, len, time);
+  if(keepAlive && _response->_finished() && !_response->_failed()){
+    _nextRequest();
+  }
+}
+
+void AsyncWebServerRequest::_nextRequest(){
+  if(_parseState != PARSE_REQ_END){
+    // Answered before the whole body arrived: the rest of it cannot be told apart from a next request
+    _client->close();
+    return;
+  }
+  if(_onDisconnectfn){
+    _onDisconnectfn();
+  }
+  String pipelined = std::move(_pipelined);
+  _reset();
+  _client->setRxTimeout(_server->keepAliveTimeout());
+  if(pipelined.length()){
+    _onData(pipelined.begin(), pipelined.length());
+  }
+}
+
+void AsyncWebServerRequest::_reset(){
+  // Back to a freshly accepted connection, keeping the buffers' capacity for the next request
+  _headers.free();
+  _params.free();
+  _pathParams.free();
+  _interestingHeaders.free();
+  if(_response != NULL){
+    delete _response;
+    _response = NULL;
+  }
+  if(_tempObject != NULL){
+    free(_tempObject);
+    _tempObject = NULL;
+  }
+  if(_tempFile){
+    _tempFile.close();
+  }
+  if(_itemBuffer){
+    free(_itemBuffer);
+    _itemBuffer = NULL;
+  }
+  _handler = NULL;
+  _onDisconnectfn = nullptr;
+  _temp.remove(0);
+  _parseState = PARSE_REQ_START;
+  _version = 0;
+  _method = HTTP_ANY;
+  _url.remove(0);
+  _host.remove(0);
+  _contentType.remove(0);
+  _boundary.remove(0);
+  _authorization.remove(0);
+  _reqconntype = RCT_HTTP;
+  _isDigest = false;
+  _isMultipart = false;
+  _isPlainPost = false;
+  _expectingContinue = false;
+  _connectionClose = false;
+  _keepAlive = false;
+  _contentLength = 0;
+  _parsedLength = 0;
+  _rawQuery.remove(0);
+  _rawHeaders.remove(0);
+  _multiParseState = 0;
+  _boundaryPosition = 0;
+  _itemStartIndex = 0;
+  _itemSize = 0;
+  _itemName.remove(0);
+  _itemFilename.remove(0);
+  _itemType.remove(0);
+  _itemValue.remove(0);
+  _itemBufferIndex = 0;
+  _itemIsFile = false;
+}
+
+bool AsyncWebServerRequest::_wantsKeepAlive() const {
+  return _server->keepAliveTimeout() && _version == 1 && !_connectionClose && _reqconntype == RCT_HTTP
+      && _requestCount < _server->keepAliveMax();
+}
+
 void AsyncWebServerRequest::_onError(int8_t error){
   (void)error;
 }
@@ -238,116 +439,107 @@ void AsyncWebServerRequest::_addPathParam(const char *p){
 }
 
 void AsyncWebServerRequest::_addGetParams(const String& params){
-  size_t start = 0;
-  while (start < params.length()){
-    int end = params.indexOf('&', start);
-    if (end < 0) end = params.length();
-    int equal = params.indexOf('=', start);
-    if (equal < 0 || equal > end) equal = end;
-    String name = params.substring(start, equal);
-    String value = equal + 1 < end ? params.substring(equal + 1, end) : String();
-    _addParam(new AsyncWebParameter(urlDecode(name), urlDecode(value)));
-    start = end + 1;
-  }
+  // Kept raw; parameters are decoded when asked for
+  if(!params.length()) return;
+  if(_rawQuery.length()) _rawQuery.concat('&');
+  _rawQuery.concat(params);
 }
 
 bool AsyncWebServerRequest::_parseReqHead(){
-  // Split the head into method, url and version
-  int index = _temp.indexOf(' ');
-  String m = _temp.substring(0, index);
-  index = _temp.indexOf(' ', index+1);
-  String u = _temp.substring(m.length()+1, index);
-  _temp = _temp.substring(index+1);
-
-  if(m == "GET"){
-    _method = HTTP_GET;
-  } else if(m == "POST"){
-    _method = HTTP_POST;
-  } else if(m == "DELETE"){
-    _method = HTTP_DELETE;
-  } else if(m == "PUT"){
-    _method = HTTP_PUT;
-  } else if(m == "PATCH"){
-    _method = HTTP_PATCH;
-  } else if(m == "HEAD"){
-    _method = HTTP_HEAD;
-  } else if(m == "OPTIONS"){
-    _method = HTTP_OPTIONS;
-  }
-
-  String g = String();
-  index = u.indexOf('?');
-  if(index > 0){
-    g = u.substring(index +1);
-    u = u.substring(0, index);
-  }
-  _url = urlDecode(u);
-  _addGetParams(g);
-
-  if(!_temp.startsWith("HTTP/1.0"))
+  // Split the head into method, url and version in place: only the decoded path and the raw query are copied
+  const char *head = _temp.c_str();
+  const char *end = head + _temp.length();
+  const char *sp = strchr(head, ' ');
+  const size_t methodLen = (sp ? sp : end) - head;
+  const char *u = sp ? sp + 1 : end;
+  sp = strchr(u, ' ');
+  const char *uEnd = sp ? sp : end;
+  const char *version = sp ? sp + 1 : end;
+
+  static const struct { const char *name; WebRequestMethod method; } methods[] = {
+    {"GET", HTTP_GET}, {"POST", HTTP_POST}, {"DELETE", HTTP_DELETE}, {"PUT", HTTP_PUT},
+    {"PATCH", HTTP_PATCH}, {"HEAD", HTTP_HEAD}, {"OPTIONS", HTTP_OPTIONS},
+  };
+  for(const auto& m: methods){
+    if(strlen(m.name) == methodLen && strncmp(head, m.name, methodLen) == 0){
+      _method = m.method;
+      break;
+    }
+  }
+
+  const char *query = (const char *)memchr(u, '?', uEnd - u);
+  if(query == u) query = NULL;
+  _url = String();
+  urlDecodeAppend(_url, u, (query ? query : uEnd) - u);
+  if(query) _rawQuery.concat(query + 1, uEnd - query - 1);
+
+  if(strncmp(version, "HTTP/1.0", 8) != 0)
     _version = 1;
 
-  _temp = String();
+  _temp.remove(0); // keep the line buffer for the headers
   return true;
 }
 
-bool strContains(String src, String find, bool mindcase = true) {
-  int pos=0, i=0;
-  const int slen = src.length();
-  const int flen = find.length();
-
-  if (slen < flen) return false;
-  while (pos <= (slen - flen)) {
-    for (i=0; i < flen; i++) {
-      if (mindcase) {
-        if (src[pos+i] != find[i]) i = flen + 1; // no match
-      } else if (tolower(src[pos+i]) != tolower(find[i])) i = flen + 1; // no match
-    }
-    if (i == flen) return true;
-    pos++;
+void AsyncWebServerRequest::_appendRawHeader(const char *name, size_t nameLen, const char *value){
+  const size_t valueLen = strlen(value);
+  const size_t needed = _rawHeaders.length() + nameLen + valueLen + 2;
+  if(needed > _rawHeadersReserved){
+    // Grow geometrically, String::concat() alone would reallocate for every header
+    _rawHeadersReserved = std::max(needed, std::max((size_t)256, 2 * _rawHeadersReserved));
+    _rawHeaders.reserve(_rawHeadersReserved);
   }
-  return false;
+  _rawHeaders.concat(name, nameLen);
+  _rawHeaders.concat(':');
+  _rawHeaders.concat(value, valueLen);
+  _rawHeaders.concat('\n');
 }
 
 bool AsyncWebServerRequest::_parseReqHeader(){
-  int index = _temp.indexOf(':');
-  if(index){
-    String name = _temp.substring(0, index);
-    String value = _temp.substring(index + 2);
-    if(name.equalsIgnoreCase("Host")){
+  const char *line = _temp.c_str();
+  const char *colon = strchr(line, ':');
+  if(colon && colon != line){
+    const size_t nameLen = colon - line;
+    const char *value = colon + 1;
+    while(*value == ' ' || *value == '\t') value++;
+    if(nameEqualsIgnoreCase(line, nameLen, "Host")){
       _host = value;
-    } else if(name.equalsIgnoreCase("Content-Type")){
-	  _contentType = value.substring(0, value.indexOf(';'));
-      if (value.startsWith("multipart/")){
-        _boundary = value.substring(value.indexOf('=')+1);
+    } else if(nameEqualsIgnoreCase(line, nameLen, "Content-Type")){
+      const char *semicolon = strchr(value, ';');
+      _contentType = String();
+      _contentType.concat(value, semicolon ? semicolon - value : strlen(value));
+      if (strncmp(value, "multipart/", 10) == 0){
+        const char *eq = strchr(value, '=');
+        _boundary = eq ? eq + 1 : value;
         _boundary.replace("\"","");
         _isMultipart = true;
       }
-    } else if(name.equalsIgnoreCase("Content-Length")){
-      _contentLength = atoi(value.c_str());
-    } else if(name.equalsIgnoreCase("Expect") && value == "100-continue"){
+    } else if(nameEqualsIgnoreCase(line, nameLen, "Content-Length")){
+      _contentLength = atoi(value);
+    } else if(nameEqualsIgnoreCase(line, nameLen, "Expect") && strcmp(value, "100-continue") == 0){
       _expectingContinue = true;
-    } else if(name.equalsIgnoreCase("Authorization")){
-      if(value.length() > 5 && value.substring(0,5).equalsIgnoreCase("Basic")){
-        _authorization = value.substring(6);
-      } else if(value.length() > 6 && value.substring(0,6).equalsIgnoreCase("Digest")){
+    } else if(nameEqualsIgnoreCase(line, nameLen, "Connection") && containsIgnoreCase(value, "close")){
+      _connectionClose = true;
+    } else if(nameEqualsIgnoreCase(line, nameLen, "Authorization")){
+      if(strlen(value) > 5 && strncasecmp(value, "Basic", 5) == 0){
+        _authorization = value + 6;
+      } else if(strlen(value) > 6 && strncasecmp(value, "Digest", 6) == 0){
         _isDigest = true;
-        _authorization = value.substring(7);
+        _authorization = value + 7;
       }
     } else {
-      if(name.equalsIgnoreCase("Upgrade") && value.equalsIgnoreCase("websocket")){
+      if(nameEqualsIgnoreCase(line, nameLen, "Upgrade") && strcasecmp(value, "websocket") == 0){
         // WebSocket request can be uniquely identified by header: [Upgrade: websocket]
         _reqconntype = RCT_WS;
       } else {
-        if(name.equalsIgnoreCase("Accept") && strContains(value, "text/event-stream", false)){
+        if(nameEqualsIgnoreCase(line, nameLen, "Accept") && containsIgnoreCase(value, "text/event-stream")){
           // WebEvent request can be uniquely identified by header:  [Accept: text/event-stream]
           _reqconntype = RCT_EVENT;
         }
       }
     }
-    _headers.add(new AsyncWebHeader(name, value));
+    _appendRawHeader(line, nameLen, value);
   }
-  _temp = String();
+  _temp.remove(0); // keep the line buffer for the next header
   return true;
 }
 
@@ -566,9 +758,12 @@ void AsyncWebServerRequest::_parseLine(){
   if(_parseState == PARSE_REQ_HEADERS){
     if(!_temp.length()){
       //end of headers
+      _temp = String();
       _server->_rewriteRequest(this);
       _server->_attachHandler(this);
       _removeNotInterestingHeaders();
+      _requestCount++;
+      _keepAlive = _wantsKeepAlive();
       if(_expectingContinue){
         const char * response = "HTTP/1.1 100 Continue\r\n\r\n";
         _client->write(response, os_strlen(response));
@@ -586,12 +781,20 @@ void AsyncWebServerRequest::_parseLine(){
 }
 
 size_t AsyncWebServerRequest::headers() const{
-  return _headers.length();
+  size_t n = 0;
+  const char *p = _rawHeaders.c_str();
+  const char *end = p + _rawHeaders.length();
+  RawEntry e;
+  while(nextHeaderEntry(p, end, e)) n++;
+  return n;
 }
 
 bool AsyncWebServerRequest::hasHeader(const String& name) const {
-  for(const auto& h: _headers){
-    if(h->name().equalsIgnoreCase(name)){
+  const char *p = _rawHeaders.c_str();
+  const char *end = p + _rawHeaders.length();
+  RawEntry e;
+  while(nextHeaderEntry(p, end, e)){
+    if(nameEqualsIgnoreCase(e.name, e.nameLen, name.c_str())){
       return true;
     }
   }
@@ -618,12 +821,30 @@ bool AsyncWebServerRequest::hasHeader(const __FlashStringHelper * data) const {
   }
 }
 
-AsyncWebHeader* AsyncWebServerRequest::getHeader(const String& name) const {
+AsyncWebHeader* AsyncWebServerRequest::_headerNode(const char *name, size_t nameLen, const char *value, size_t valueLen) const {
   for(const auto& h: _headers){
-    if(h->name().equalsIgnoreCase(name)){
+    if(h->name().length() == nameLen && h->value().length() == valueLen &&
+       memcmp(h->name().c_str(), name, nameLen) == 0 && memcmp(h->value().c_str(), value, valueLen) == 0){
       return h;
     }
   }
+  String n, v;
+  n.concat(name, nameLen);
+  v.concat(value, valueLen);
+  AsyncWebHeader *h = new AsyncWebHeader(n, v);
+  _headers.add(h);
+  return h;
+}
+
+AsyncWebHeader* AsyncWebServerRequest::getHeader(const String& name) const {
+  const char *p = _rawHeaders.c_str();
+  const char *end = p + _rawHeaders.length();
+  RawEntry e;
+  while(nextHeaderEntry(p, end, e)){
+    if(nameEqualsIgnoreCase(e.name, e.nameLen, name.c_str())){
+      return _headerNode(e.name, e.nameLen, e.value, e.valueLen);
+    }
+  }
   return nullptr;
 }
 
@@ -642,15 +863,69 @@ AsyncWebHeader* AsyncWebServerRequest::getHeader(const __FlashStringHelper * dat
 }
 
 AsyncWebHeader* AsyncWebServerRequest::getHeader(size_t num) const {
-  auto header = _headers.nth(num);
-  return header ? *header : nullptr;
+  const char *p = _rawHeaders.c_str();
+  const char *end = p + _rawHeaders.length();
+  RawEntry e;
+  while(nextHeaderEntry(p, end, e)){
+    if(num-- == 0){
+      return _headerNode(e.name, e.nameLen, e.value, e.valueLen);
+    }
+  }
+  return nullptr;
+}
+
+AsyncWebParameter* AsyncWebServerRequest::_queryParamNode(const char *name, size_t nameLen, const char *value, size_t valueLen) const {
+  for(const auto& p: _params){
+    if(!p->isPost() && urlDecodedEquals(name, nameLen, p->name().c_str()) &&
+       urlDecodedEquals(value, valueLen, p->value().c_str())){
+      return p;
+    }
+  }
+  String n, v;
+  urlDecodeAppend(n, name, nameLen);
+  urlDecodeAppend(v, value, valueLen);
+  AsyncWebParameter *p = new AsyncWebParameter(n, v);
+  _params.add(p);
+  return p;
+}
+
+AsyncWebParameter* AsyncWebServerRequest::_queryParam(const char *name) const {
+  const char *p = _rawQuery.c_str();
+  const char *end = p + _rawQuery.length();
+  RawEntry e;
+  while(nextQueryEntry(p, end, e)){
+    if(urlDecodedEquals(e.name, e.nameLen, name)){
+      return _queryParamNode(e.name, e.nameLen, e.value, e.valueLen);
+    }
+  }
+  return nullptr;
+}
+
+size_t AsyncWebServerRequest::_queryParamCount() const {
+  size_t n = 0;
+  const char *p = _rawQuery.c_str();
+  const char *end = p + _rawQuery.length();
+  RawEntry e;
+  while(nextQueryEntry(p, end, e)) n++;
+  return n;
 }
 
 size_t AsyncWebServerRequest::params() const {
-  return _params.length();
+  return _queryParamCount() + _params.count_if([](AsyncWebParameter *p){ return p->isPost(); });
 }
 
 bool AsyncWebServerRequest::hasParam(const String& name, bool post, bool file) const {
+  if(!post && !file){
+    const char *p = _rawQuery.c_str();
+    const char *end = p + _rawQuery.length();
+    RawEntry e;
+    while(nextQueryEntry(p, end, e)){
+      if(urlDecodedEquals(e.name, e.nameLen, name.c_str())){
+        return true;
+      }
+    }
+    return false;
+  }
   for(const auto& p: _params){
     if(p->name() == name && p->isPost() == post && p->isFile() == file){
       return true;
@@ -676,6 +951,9 @@ bool AsyncWebServerRequest::hasParam(const __FlashStringHelper * data, bool post
 }
 
 AsyncWebParameter* AsyncWebServerRequest::getParam(const String& name, bool post, bool file) const {
+  if(!post && !file){
+    return _queryParam(name.c_str());
+  }
   for(const auto& p: _params){
     if(p->name() == name && p->isPost() == post && p->isFile() == file){
       return p;
@@ -699,8 +977,21 @@ AsyncWebParameter* AsyncWebServerRequest::getParam(const __FlashStringHelper * d
 }
 
 AsyncWebParameter* AsyncWebServerRequest::getParam(size_t num) const {
-  auto param = _params.nth(num);
-  return param ? *param : nullptr;
+  // Query parameters first, then body parameters, as they appear in the request
+  const char *q = _rawQuery.c_str();
+  const char *end = q + _rawQuery.length();
+  RawEntry e;
+  while(nextQueryEntry(q, end, e)){
+    if(num-- == 0){
+      return _queryParamNode(e.name, e.nameLen, e.value, e.valueLen);
+    }
+  }
+  for(const auto& p: _params){
+    if(p->isPost() && num-- == 0){
+      return p;
+    }
+  }
+  return nullptr;
 }
 
 void AsyncWebServerRequest::addInterestingHeader(const String& name){
@@ -862,8 +1153,11 @@ void AsyncWebServerRequest::requestAuthentication(const char * realm, bool isDig
 }
 
 bool AsyncWebServerRequest::hasArg(const char* name) const {
+  if(hasParam(name)){
+    return true;
+  }
   for(const auto& arg: _params){
-    if(arg->name() == name){
+    if(arg->isPost() && arg->name() == name){
       return true;
     }
   }
@@ -886,8 +1180,11 @@ bool AsyncWebServerRequest::hasArg(const __FlashStringHelper * data) const {
 
 
 const String& AsyncWebServerRequest::arg(const String& name) const {
+  if(AsyncWebParameter* param = _queryParam(name.c_str())){
+    return param->value();
+  }
   for(const auto& arg: _params){
-    if(arg->name() == name){
+    if(arg->isPost() && arg->name() == name){
       return arg->value();
     }
   }
@@ -953,25 +1250,8 @@ const String& AsyncWebServerRequest::headerName(size_t i) const {
 }
 
 String AsyncWebServerRequest::urlDecode(const String& text) const {
-  char temp[] = "0x00";
-  unsigned int len = text.length();
-  unsigned int i = 0;
   String decoded = String();
-  decoded.reserve(len); // Allocate the string internal buffer - never longer from source text
-  while (i < len){
-    char decodedChar;
-    char encodedChar = text.charAt(i++);
-    if ((encodedChar == '%') && (i + 1 < len)){
-      temp[2] = text.charAt(i++);
-      temp[3] = text.charAt(i++);
-      decodedChar = strtol(temp, NULL, 16);
-    } else if (encodedChar == '+') {
-      decodedChar = ' ';
-    } else {
-      decodedChar = encodedChar;  // normal ascii char
-    }
-    decoded.concat(decodedChar);
-  }
+  urlDecodeAppend(decoded, text.c_str(), text.length());
   return decoded;
 }
 
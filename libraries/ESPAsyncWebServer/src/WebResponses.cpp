@@ -163,6 +163,20 @@ bool AsyncWebServerResponse::_sourceValid() const { return false; }
 void AsyncWebServerResponse::_respond(AsyncWebServerRequest *request){ _state = RESPONSE_END; request->client()->close(); }
 size_t AsyncWebServerResponse::_ack(AsyncWebServerRequest *request, size_t len, uint32_t time){ (void)request; (void)len; (void)time; return 0; }
 
+void AsyncWebServerResponse::_addConnectionHeader(AsyncWebServerRequest *request){
+  // Only a body with a known end (length or chunked) lets the client find where the next response starts
+  if(request->_keepAlive && (_sendContentLength || _chunked)){
+    AsyncWebServer *server = request->_server;
+    char buf[32];
+    snprintf(buf, sizeof(buf), "timeout=%u, max=%u", (unsigned)server->keepAliveTimeout(), (unsigned)(server->keepAliveMax() - request->_requestCount));
+    addHeader("Connection","keep-alive");
+    addHeader("Keep-Alive",buf);
+  } else {
+    request->_keepAlive = false;
+    addHeader("Connection","close");
+  }
+}
+
 /*
  * String/Code Response
  * */
@@ -175,10 +189,10 @@ AsyncBasicResponse::AsyncBasicResponse(int code, const String& contentType, cons
     if(!_contentType.length())
       _contentType = "text/plain";
   }
-  addHeader("Connection","close");
 }
 
 void AsyncBasicResponse::_respond(AsyncWebServerRequest *request){
+  _addConnectionHeader(request);
   _state = RESPONSE_HEADERS;
   String out = _assembleHead(request->version());
   size_t outLen = out.length();
@@ -255,7 +269,7 @@ AsyncAbstractResponse::AsyncAbstractResponse(AwsTemplateProcessor callback): _ca
 }
 
 void AsyncAbstractResponse::_respond(AsyncWebServerRequest *request){
-  addHeader("Connection","close");
+  _addConnectionHeader(request);
   _head = _assembleHead(request->version());
   _state = RESPONSE_HEADERS;
   _ack(request, 0, 0);
@@ -34,6 +34,8 @@ AsyncWebServer::AsyncWebServer(uint16_t port)
   : _server(port)
   , _rewrites(LinkedList<AsyncWebRewrite*>(nullptr))
   , _handlers(LinkedList<AsyncWebHandler*>(nullptr))
+  , _keepAliveTimeout(0)
+  , _keepAliveMax(0)
 {
   _catchAllHandler = new AsyncCallbackWebHandler();
   if(_catchAllHandler == NULL)
@@ -88,6 +90,11 @@ void AsyncWebServer::end(){
   _server.end();
 }
 
+void AsyncWebServer::setKeepAlive(uint16_t idleTimeout, uint8_t maxRequests){
+  _keepAliveTimeout = idleTimeout;
+  _keepAliveMax = maxRequests;
+}
+
 #if ASYNC_TCP_SSL_ENABLED
 void AsyncWebServer::onSslFileRequest(AcSSlFileHandler cb, void* arg){
   _server.onSslFileRequest(cb, arg);
@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+"""
+Build a DrawMatrix animation file (.dma) from raw RGB frames.
+
+Frames are raw row-major RGB (3 bytes per pixel, pixel 0 top-left); an input file may hold several frames back to
+back, e.g. a GIF converted with ffmpeg:
+
+    ffmpeg -i in.gif -vf scale=32:24 -f rawvideo -pix_fmt rgb24 frames.rgb
+    python3 tools/animation.py --duration 80 frames.rgb anim.dma
+    curl --data-binary @anim.dma 'http://esp8266.local/animation_upload?name=wave'
+    curl 'http://esp8266.local/animation_play?name=wave'
+
+An input written as `file.rgb:ms` gives its frames that duration. Each frame is stored as a key frame or as the XOR
+with the previous frame, whichever is smaller, RLE-encoded like FrameCodec; see DrawMatrix/Animation.hpp.
+"""
+import argparse
+import struct
+import sys
+
+MAGIC = b"DMA1"
+HEADER_SIZE = 16
+INDEX_ENTRY_SIZE = 8
+FRAME_KEY = b"K"
+FRAME_DELTA = b"D"
+MAX_PACKET_PIXELS = 128
+
+
+def rle_encode(pixels):
+    """Same packets as FrameCodec::rle_encode: 0x80 | (run - 1) + one pixel, or (count - 1) + count pixels."""
+    px = [pixels[i : i + 3] for i in range(0, len(pixels), 3)]
+    out = bytearray()
+    i = 0
+    while i < len(px):
+        run = 1
+        while i + run < len(px) and run < MAX_PACKET_PIXELS and px[i + run] == px[i]:
+            run += 1
+        if run >= 2:
+            out.append(0x80 | (run - 1))
+            out += px[i]
+            i += run
+            continue
+        lit = 1
+        while i + lit < len(px) and lit < MAX_PACKET_PIXELS:
+            if i + lit + 1 < len(px) and px[i + lit] == px[i + lit + 1]:
+                break
+            lit += 1
+        out.append(lit - 1)
+        for p in px[i : i + lit]:
+            out += p
+        i += lit
+    return bytes(out)
+
+
+def build(frames, width, height, loops, key_interval):
+    """frames: list of (pixels, duration_ms)."""
+    encoded = []
+    previous = None
+    for n, (pixels, duration) in enumerate(frames):
+        frame = FRAME_KEY + rle_encode(pixels)
+        if previous is not None and (not key_interval or n % key_interval):
+            delta = FRAME_DELTA + rle_encode(bytes(a ^ b for a, b in zip(pixels, previous)))
+            frame = delta if len(delta) < len(frame) else frame
+        encoded.append((frame, duration))
+        previous = pixels
+
+    out = bytearray(MAGIC + struct.pack("<HHHH4x", width, height, len(frames), loops))
+    offset = HEADER_SIZE + INDEX_ENTRY_SIZE * len(frames)
+    for frame, duration in encoded:
+        out += struct.pack("<IHH", offset, len(frame), duration)
+        offset += len(frame)
+    for frame, _ in encoded:
+        out += frame
+    return bytes(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--width", type=int, default=32)
+    parser.add_argument("--height", type=int, default=24)
+    parser.add_argument("--duration", type=int, default=100, help="default frame duration in ms")
+    parser.add_argument("--loops", type=int, default=0, help="times to play, 0 for forever")
+    parser.add_argument("--key-interval", type=int, default=0, help="force a key frame every N frames")
+    parser.add_argument("inputs", nargs="+", help="raw RGB files, optionally suffixed with :ms")
+    parser.add_argument("output", help="animation file")
+    args = parser.parse_args()
+
+    frame_size = args.width * args.height * 3
+    frames = []
+    for spec in args.inputs:
+        name, _, ms = spec.rpartition(":") if ":" in spec else (spec, "", "")
+        data = open(name, "rb").read()
+        if not data or len(data) % frame_size:
+            print(f"{name}: size is not a multiple of {frame_size} bytes", file=sys.stderr)
+            return 1
+        duration = int(ms) if ms else args.duration
+        frames += [(data[i : i + frame_size], duration) for i in range(0, len(data), frame_size)]
+    if len(frames) > 0xFFFF:
+        print("too many frames", file=sys.stderr)
+        return 1
+
+    result = build(frames, args.width, args.height, args.loops, args.key_interval)
+    with open(args.output, "wb") as f:
+        f.write(result)
+    print(f"{len(frames)} frames, {len(frames) * frame_size} -> {len(result)} bytes", file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+"""
+DrawMatrix web asset generator.
+
+Minifies and gzips the pages in DrawMatrix/data/ into PROGMEM blobs (DrawMatrix/WebAssets.hpp), each with a strong
+ETag derived from its compressed content. The Arduino IDE has no pre-build hook, so run this after editing any page
+and commit the regenerated header together with the page:
+
+    python3 tools/gen_web_assets.py          # regenerate
+    python3 tools/gen_web_assets.py --check  # fail if the header is stale (e.g. in CI)
+
+The pages keep their `const char X_HTML[] PROGMEM = R"html(` / `)html";` wrapper lines; they are stripped here.
+"""
+import argparse
+import gzip
+import hashlib
+import re
+import sys
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent
+DATA_DIR = ROOT / "DrawMatrix" / "data"
+OUTPUT = ROOT / "DrawMatrix" / "WebAssets.hpp"
+
+# (source file, C++ name, content type)
+ASSETS = [
+    ("index.html", "INDEX", "text/html"),
+    ("draw.html", "DRAW", "text/html"),
+    ("music.html", "MUSIC", "text/html"),
+    ("alarm.html", "ALARM", "text/html"),
+]
+
+WRAPPER_FIRST = re.compile(r'^const char \w+\[\] PROGMEM = R"html\($')
+WRAPPER_LAST = ')html";'
+
+
+def strip_wrapper(text, name):
+    lines = text.split("\n")
+    while lines and lines[-1].strip() == "":
+        lines.pop()
+    if not lines or not WRAPPER_FIRST.match(lines[0]) or lines[-1].strip() != WRAPPER_LAST:
+        sys.exit(f"{name}: missing the PROGMEM wrapper lines")
+    return "\n".join(lines[1:-1])
+
+
+def minify(html):
+    """Conservative minification: drop HTML and whole-line JS/CSS comments, indentation and blank lines.
+
+    Line breaks are kept so JavaScript automatic semicolon insertion is never affected.
+    """
+    html = re.sub(r"<!--.*?-->", "", html, flags=re.S)
+    out = []
+    in_block_comment = False
+    for line in html.split("\n"):
+        line = line.strip()
+        if in_block_comment:
+            if "*/" in line:
+                line = line.split("*/", 1)[1].strip()
+                in_block_comment = False
+            else:
+                continue
+        if line.startswith("/*"):
+            if "*/" in line:
+                line = line.split("*/", 1)[1].strip()
+            else:
+                in_block_comment = True
+                continue
+        if not line or line.startswith("//"):
+            continue
+        out.append(line)
+    return "\n".join(out) + "\n"
+
+
+def c_array(data):
+    rows = []
+    for i in range(0, len(data), 20):
+        rows.append("    " + ", ".join(f"0x{b:02x}" for b in data[i : i + 20]) + ",")
+    return "\n".join(rows)
+
+
+def generate():
+    blobs = []
+    for filename, name, content_type in ASSETS:
+        source = (DATA_DIR / filename).read_text(encoding="utf-8")
+        page = minify(strip_wrapper(source, filename)).encode("utf-8")
+        # mtime=0 keeps the output (and so the ETag) reproducible
+        gz = gzip.compress(page, compresslevel=9, mtime=0)
+        etag = hashlib.sha256(gz).hexdigest()[:16]
+        blobs.append((filename, name, content_type, len(source.encode("utf-8")), gz, etag))
+
+    out = [
+        "/**",
+        " * @file      WebAssets.hpp",
+        " * @brief     Gzipped web pages with their ETags (GENERATED by tools/gen_web_assets.py from data/ - do not edit)",
+        " */",
+        "#ifndef DRAWMATRIX_WEBASSETS",
+        "#define DRAWMATRIX_WEBASSETS",
+        "",
+        "#include <Arduino.h>",
+        "",
+        "namespace WebAssets {",
+        "",
+        "/**",
+        " * @brief A precompressed page: send as-is with `Content-Encoding: gzip`.",
+        " */",
+        "struct Asset {",
+        "    const uint8_t *gz;        ///< Gzip stream (PROGMEM)",
+        "    size_t gz_len;            ///< Length of the gzip stream",
+        "    const char *etag;         ///< Strong ETag, quotes included",
+        "    const char *content_type; ///< MIME type of the uncompressed content",
+        "};",
+        "",
+        "// Browsers may reuse a page but must revalidate it (a cheap 304) so a firmware update is picked up at once",
+        'constexpr const char *CACHE_CONTROL = "no-cache";',
+        "",
+    ]
+    for filename, name, content_type, raw_len, gz, etag in blobs:
+        out += [
+            f"// {filename}: {raw_len} bytes -> {len(gz)} bytes gzipped",
+            f"const uint8_t {name}_GZ[] PROGMEM = {{",
+            c_array(gz),
+            "};",
+            f'constexpr Asset {name} = {{{name}_GZ, sizeof({name}_GZ), "\\"{etag}\\"", "{content_type}"}};',
+            "",
+        ]
+    out += [
+        "} // namespace WebAssets",
+        "",
+        "#endif /* DRAWMATRIX_WEBASSETS */",
+        "",
+    ]
+    return "\n".join(out), blobs
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--check", action="store_true", help="verify the header is up to date instead of writing it")
+    args = parser.parse_args()
+
+    header, blobs = generate()
+    if args.check:
+        if not OUTPUT.exists() or OUTPUT.read_text(encoding="utf-8") != header:
+            sys.exit(f"{OUTPUT.relative_to(ROOT)} is stale, run tools/gen_web_assets.py")
+        return
+    OUTPUT.write_text(header, encoding="utf-8")
+    for filename, _, _, raw_len, gz, etag in blobs:
+        print(f"{filename:12} {raw_len:6} -> {len(gz):6} bytes  ETag {etag}")
+
+
+if __name__ == "__main__":
+    main()
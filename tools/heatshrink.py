@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+"""
+heatshrink encoder/decoder for DrawMatrix frame payloads (window 2^8, lookahead 2^4).
+
+Frames are raw row-major RGB (3 bytes per pixel, pixel 0 top-left). Compress one and send it to any frame input:
+
+    python3 tools/heatshrink.py frame.rgb frame.hs
+    curl --data-binary @frame.hs -H 'Content-Type: application/x-heatshrink' http://esp8266.local/set_display_matrix
+
+    python3 tools/heatshrink.py -d frame.hs frame.rgb   # decompress (round-trip check)
+
+Same bit stream as the reference `heatshrink -w 8 -l 4`: `1` + 8-bit literal, or `0` + 8-bit (offset - 1) + 4-bit
+(count - 1), most significant bit first, the last byte padded with zeros.
+"""
+import argparse
+import sys
+
+WINDOW_BITS = 8
+LOOKAHEAD_BITS = 4
+WINDOW = 1 << WINDOW_BITS
+LOOKAHEAD = 1 << LOOKAHEAD_BITS
+# A back reference (13 bits) only pays off from 2 bytes (2 literals are 18 bits)
+MIN_MATCH = 2
+
+
+class BitWriter:
+    def __init__(self):
+        self.out = bytearray()
+        self.acc = 0
+        self.n = 0
+
+    def put(self, value, bits):
+        self.acc = (self.acc << bits) | value
+        self.n += bits
+        while self.n >= 8:
+            self.n -= 8
+            self.out.append((self.acc >> self.n) & 0xFF)
+        self.acc &= (1 << self.n) - 1
+
+    def finish(self):
+        if self.n:
+            self.out.append((self.acc << (8 - self.n)) & 0xFF)
+        return bytes(self.out)
+
+
+def encode(data):
+    """Greedy longest-match LZSS; matches may overlap the bytes they produce (runs)."""
+    w = BitWriter()
+    i = 0
+    while i < len(data):
+        best_len, best_off = 0, 0
+        for off in range(1, min(i, WINDOW) + 1):
+            n = 0
+            while n < LOOKAHEAD and i + n < len(data) and data[i + n] == data[i + n - off]:
+                n += 1
+            if n > best_len:
+                best_len, best_off = n, off
+                if n == LOOKAHEAD:
+                    break
+        if best_len >= MIN_MATCH:
+            w.put(0, 1)
+            w.put(best_off - 1, WINDOW_BITS)
+            w.put(best_len - 1, LOOKAHEAD_BITS)
+            i += best_len
+        else:
+            w.put(1, 1)
+            w.put(data[i], 8)
+            i += 1
+    return w.finish()
+
+
+def decode(data):
+    window = bytearray(WINDOW)
+    out = bytearray()
+    bits = "".join(f"{b:08b}" for b in data)
+    pos = 0
+    while True:
+        if pos + 1 > len(bits):
+            break
+        tag = bits[pos]
+        pos += 1
+        if tag == "1":
+            if pos + 8 > len(bits):
+                break
+            c = int(bits[pos:pos + 8], 2)
+            pos += 8
+            window[len(out) % WINDOW] = c
+            out.append(c)
+        else:
+            if pos + WINDOW_BITS + LOOKAHEAD_BITS > len(bits):
+                break
+            off = int(bits[pos:pos + WINDOW_BITS], 2) + 1
+            count = int(bits[pos + WINDOW_BITS:pos + WINDOW_BITS + LOOKAHEAD_BITS], 2) + 1
+            pos += WINDOW_BITS + LOOKAHEAD_BITS
+            for _ in range(count):
+                c = window[(len(out) - off) % WINDOW]
+                window[len(out) % WINDOW] = c
+                out.append(c)
+    return bytes(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("-d", "--decode", action="store_true", help="decompress instead")
+    parser.add_argument("input", help="input file, - for stdin")
+    parser.add_argument("output", help="output file, - for stdout")
+    args = parser.parse_args()
+
+    data = sys.stdin.buffer.read() if args.input == "-" else open(args.input, "rb").read()
+    result = decode(data) if args.decode else encode(data)
+    if args.output == "-":
+        sys.stdout.buffer.write(result)
+    else:
+        with open(args.output, "wb") as f:
+            f.write(result)
+    print(f"{len(data)} -> {len(result)} bytes", file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
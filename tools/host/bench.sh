@@ -0,0 +1,22 @@
+#!/bin/sh
+# Build the host benchmarks against the stub Arduino core in tools/host/stubs and run them.
+#
+#   tools/host/bench.sh            # from the repository root; needs g++ (C++17)
+#
+# Only modules that do not touch the hardware are built; the figures are for the PC they run on, not the ESP8266.
+set -e
+ROOT=$(cd "$(dirname "$0")/../.." && pwd)
+LIB=$ROOT/libraries
+OUT=${OUT:-$(mktemp -d)}
+CXX=${CXX:-g++}
+CXXFLAGS="-std=gnu++17 -O2 -DARDUINO=10819 -DESP8266 -I$ROOT/tools/host/stubs -I$LIB/Adafruit_GFX_Library \
+-I$LIB/Adafruit_NeoPixel -I$LIB/Adafruit_NeoMatrix -I$ROOT/DrawMatrix"
+
+$CXX $CXXFLAGS -o "$OUT/gif_bench" "$ROOT/tools/host/gif_bench.cpp" "$ROOT/DrawMatrix/Gif.cpp" \
+    "$ROOT/DrawMatrix/Compositor.cpp" "$LIB/Adafruit_GFX_Library/Adafruit_GFX.cpp"
+"$OUT/gif_bench" "$ROOT"/tools/host/samples/*.gif
+
+$CXX $CXXFLAGS -o "$OUT/effects_bench" "$ROOT/tools/host/effects_bench.cpp" "$ROOT/DrawMatrix/Effects.cpp" \
+    "$ROOT/DrawMatrix/Compositor.cpp" "$LIB/Adafruit_GFX_Library/Adafruit_GFX.cpp" \
+    "$LIB/Adafruit_NeoPixel/Adafruit_NeoPixel.cpp"
+"$OUT/effects_bench"
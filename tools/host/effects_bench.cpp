@@ -0,0 +1,105 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      effects_bench.cpp                                                                                        *
+ * @brief     Host benchmark of Effects::Engine and check of hsv_to_rgb() against Adafruit_NeoPixel::ColorHSV      *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+/*
+ * Built and run by tools/host/bench.sh; by hand, from the repository root:
+ *   g++ -std=gnu++17 -O2 -DARDUINO=10819 -DESP8266 -Itools/host/stubs -Ilibraries/Adafruit_GFX_Library
+ *       -Ilibraries/Adafruit_NeoPixel -IDrawMatrix tools/host/effects_bench.cpp DrawMatrix/Effects.cpp
+ *       DrawMatrix/Compositor.cpp libraries/Adafruit_GFX_Library/Adafruit_GFX.cpp
+ *       libraries/Adafruit_NeoPixel/Adafruit_NeoPixel.cpp -o effects_bench
+ *   ./effects_bench
+ */
+#include <Adafruit_NeoPixel.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+
+#include "Effects.hpp"
+
+namespace {
+constexpr uint16_t N_COLS = 32;
+constexpr uint16_t N_ROWS = 24;
+constexpr size_t N_PIXELS = static_cast<size_t>(N_COLS) * N_ROWS;
+// Frames rendered per effect, DEFAULT_FPS apart in effect time as on the device, after one untimed run (allocations,
+// cold caches)
+constexpr size_t FRAMES = 2000;
+
+// --------------------------------------------------------------------------------------
+// Largest channel difference between hsv_to_rgb() and ColorHSV (then gamma32 if `gamma`) over every byte hue,
+// saturation and value
+int max_hsv_diff(bool gamma) {
+    std::unique_ptr<uint8_t[]> hsv(new uint8_t[256 * 3]);
+    std::unique_ptr<uint8_t[]> rgb(new uint8_t[256 * 3]);
+    int max_diff = 0;
+    for (int s = 0; s < 256; s++) {
+        for (int v = 0; v < 256; v++) {
+            for (int h = 0; h < 256; h++) {
+                hsv[h * 3] = h;
+                hsv[h * 3 + 1] = s;
+                hsv[h * 3 + 2] = v;
+            }
+            Effects::hsv_to_rgb(hsv.get(), rgb.get(), 256, gamma);
+            for (int h = 0; h < 256; h++) {
+                uint32_t color = Adafruit_NeoPixel::ColorHSV(h << 8, s, v);
+                color = gamma ? Adafruit_NeoPixel::gamma32(color) : color;
+                for (int c = 0; c < 3; c++) {
+                    const int diff = abs(rgb[h * 3 + c] - static_cast<int>((color >> (16 - 8 * c)) & 0xFF));
+                    max_diff = diff > max_diff ? diff : max_diff;
+                }
+            }
+        }
+    }
+    return max_diff;
+}
+
+// --------------------------------------------------------------------------------------
+// Microseconds per frame of Effects::benchmark_hsv() (hsv_to_rgb() if `batch`, else ColorHSV and gamma32 per pixel)
+double hsv_us(bool batch) {
+    Effects::benchmark_hsv(N_PIXELS, FRAMES, batch);
+    const auto start = std::chrono::steady_clock::now();
+    Effects::benchmark_hsv(N_PIXELS, FRAMES, batch);
+    const std::chrono::duration<double, std::micro> us = std::chrono::steady_clock::now() - start;
+    return us.count() / FRAMES;
+}
+} // namespace
+
+// --------------------------------------------------------------------------------------
+int main() {
+    Compositor::Canvas canvas(N_COLS, N_ROWS);
+    Effects::Engine engine(canvas);
+    std::unique_ptr<uint8_t[]> scratch(new uint8_t[N_PIXELS * 3]);
+
+    int failed = 0;
+    printf("%-16s %10s %10s\n", "effect", "us/frame", "frames/s");
+    for (size_t k = 0; k < Effects::N_KINDS; k++) {
+        const Effects::Kind kind = static_cast<Effects::Kind>(k);
+        engine.benchmark(kind, scratch.get(), FRAMES);
+        const auto start = std::chrono::steady_clock::now();
+        const bool ok = engine.benchmark(kind, scratch.get(), FRAMES) != 0;
+        const std::chrono::duration<double, std::micro> us = std::chrono::steady_clock::now() - start;
+        if (!ok) {
+            printf("%-16s failed\n", Effects::name(kind));
+            failed++;
+            continue;
+        }
+        const double us_per_frame = us.count() / FRAMES;
+        printf("%-16s %10.2f %10.0f\n", Effects::name(kind), us_per_frame, 1e6 / us_per_frame);
+    }
+
+    // A frame of HSV with gamma, as /effect_benchmark reports it on the device
+    printf("%-16s %10.2f\n", "hsv_to_rgb", hsv_us(true));
+    printf("%-16s %10.2f\n", "color_hsv", hsv_us(false));
+    // hsv_to_rgb() has 256 hues to ColorHSV's 1530, hence small differences on the ramps
+    printf("hsv_to_rgb max difference from ColorHSV: %d, with gamma: %d\n", max_hsv_diff(false), max_hsv_diff(true));
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,104 @@
+/**
+ * ------------------------------------------------------------------------------------------------------------------- *
+ *            DrawMatrix                                                                                               *
+ * @file      gif_bench.cpp                                                                                            *
+ * @brief     Host benchmark of Gif::Decoder: microseconds per frame for the given GIFs                                *
+ * @date      Sun Oct 18 2026                                                                                          *
+ * @author    Joao Carlos Bastos Portela (jcbastosportela@gmail.com)                                                   *
+ * @copyright 2025 - 2026, Joao Carlos Bastos Portela                                                                  *
+ *            MIT License                                                                                              *
+ * ------------------------------------------------------------------------------------------------------------------- *
+ */
+/*
+ * Built and run by tools/host/bench.sh; by hand, from the repository root:
+ *   g++ -std=gnu++17 -O2 -DARDUINO=10819 -DESP8266 -Itools/host/stubs -Ilibraries/Adafruit_GFX_Library
+ *       -Ilibraries/Adafruit_NeoMatrix -IDrawMatrix tools/host/gif_bench.cpp DrawMatrix/Gif.cpp
+ *       DrawMatrix/Compositor.cpp libraries/Adafruit_GFX_Library/Adafruit_GFX.cpp -o gif_bench
+ *   ./gif_bench tools/host/samples/gradient.gif tools/host/samples/noise.gif tools/host/samples/sprite.gif
+ */
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "Gif.hpp"
+
+namespace {
+constexpr uint16_t N_COLS = 32;
+constexpr uint16_t N_ROWS = 24;
+// Every GIF is decoded this many times over, frames timed one by one, after one untimed pass (header, allocations,
+// cold caches)
+constexpr int PASSES = 200;
+
+// --------------------------------------------------------------------------------------
+bool load(const char *path, std::vector<uint8_t> &data) {
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        return false;
+    }
+    uint8_t chunk[4096];
+    for (size_t n; (n = fread(chunk, 1, sizeof(chunk), file)) > 0;) {
+        data.insert(data.end(), chunk, chunk + n);
+    }
+    fclose(file);
+    return true;
+}
+
+// --------------------------------------------------------------------------------------
+// Decode the whole file 1 + PASSES times (looping with rewind(), as Gif::Player does); false on a decoder error
+bool bench(const std::vector<uint8_t> &data, size_t &frames, double &avg_us, double &max_us) {
+    Compositor::Canvas canvas(N_COLS, N_ROWS);
+    Gif::Decoder decoder(canvas, N_COLS, N_ROWS);
+    double total_us = 0;
+    size_t decoded = 0;
+    max_us = 0;
+    for (int pass = 0; pass <= PASSES; pass++) {
+        size_t offset = pass ? decoder.frames_offset() : 0;
+        if (pass) {
+            decoder.rewind();
+        }
+        while (!decoder.finished() && !decoder.error() && offset < data.size()) {
+            const auto start = std::chrono::steady_clock::now();
+            offset += decoder.feed(data.data() + offset, data.size() - offset);
+            const std::chrono::duration<double, std::micro> us = std::chrono::steady_clock::now() - start;
+            if (pass && decoder.frame_done()) {
+                decoded++;
+                total_us += us.count();
+                max_us = us.count() > max_us ? us.count() : max_us;
+            }
+        }
+        if (decoder.error() || !decoder.finished()) {
+            fprintf(stderr, "%s\n", decoder.error() ? decoder.error() : "Truncated GIF");
+            return false;
+        }
+    }
+    frames = decoded / PASSES;
+    avg_us = decoded ? total_us / decoded : 0;
+    return true;
+}
+} // namespace
+
+// --------------------------------------------------------------------------------------
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s file.gif...\n", argv[0]);
+        return 2;
+    }
+    int failed = 0;
+    printf("%-16s %6s %10s %10s\n", "GIF", "frames", "us/frame", "max us");
+    for (int k = 1; k < argc; k++) {
+        const char *slash = strrchr(argv[k], '/');
+        const char *name = slash ? slash + 1 : argv[k];
+        std::vector<uint8_t> data;
+        size_t frames = 0;
+        double avg_us = 0;
+        double max_us = 0;
+        if (!load(argv[k], data) || !bench(data, frames, avg_us, max_us)) {
+            printf("%-16s failed\n", name);
+            failed++;
+            continue;
+        }
+        printf("%-16s %6zu %10.2f %10.2f\n", name, frames, avg_us, max_us);
+    }
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+"""
+Sample 32x24 GIFs for the host decoder benchmark (tools/host/gif_bench.cpp), written to tools/host/samples/:
+
+    python3 tools/host/make_sample_gifs.py
+
+- gradient.gif: full-frame hue sweep, 24 frames, one global palette (long LZW runs)
+- sprite.gif: a ball bouncing over a transparent background, 30 frames, restore-to-background disposal, Pillow
+  crops every frame to the changed rectangle
+- noise.gif: random pixels from 256 colours, 8 frames (worst case for LZW: short codes, full dictionary)
+
+Needs Pillow. The output is deterministic, so the committed files can be regenerated byte for byte with the same
+Pillow version.
+"""
+import colorsys
+import os
+import random
+
+from PIL import Image
+
+WIDTH = 32
+HEIGHT = 24
+OUT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "samples")
+
+
+def gradient():
+    frames = []
+    for f in range(24):
+        im = Image.new("RGB", (WIDTH, HEIGHT))
+        for y in range(HEIGHT):
+            for x in range(WIDTH):
+                r, g, b = colorsys.hsv_to_rgb(((x + y) / (WIDTH + HEIGHT) + f / 24) % 1, 1, 1)
+                im.putpixel((x, y), (int(r * 255), int(g * 255), int(b * 255)))
+        frames.append(im.quantize(64))
+    frames[0].save(os.path.join(OUT, "gradient.gif"), save_all=True, append_images=frames[1:], duration=40, loop=0)
+
+
+def sprite():
+    frames = []
+    x, y, dx, dy = 3, 2, 2, 1
+    for _ in range(30):
+        im = Image.new("P", (WIDTH, HEIGHT), 0)
+        im.putpalette([0, 0, 0, 255, 200, 0, 255, 80, 0] + [0] * (253 * 3))
+        for py in range(-3, 4):
+            for px in range(-3, 4):
+                if px * px + py * py <= 10:
+                    im.putpixel((x + px, y + py), 1 if px * px + py * py <= 4 else 2)
+        frames.append(im)
+        x, y = x + dx, y + dy
+        dx = -dx if not 3 <= x + dx < WIDTH - 3 else dx
+        dy = -dy if not 3 <= y + dy < HEIGHT - 3 else dy
+    frames[0].save(os.path.join(OUT, "sprite.gif"), save_all=True, append_images=frames[1:], duration=50, loop=0,
+                   transparency=0, disposal=2)
+
+
+def noise():
+    rng = random.Random(1)
+    palette = [rng.randrange(256) for _ in range(256 * 3)]
+    frames = []
+    for _ in range(8):
+        im = Image.new("P", (WIDTH, HEIGHT))
+        im.putpalette(palette)
+        im.putdata([rng.randrange(256) for _ in range(WIDTH * HEIGHT)])
+        frames.append(im)
+    frames[0].save(os.path.join(OUT, "noise.gif"), save_all=True, append_images=frames[1:], duration=100, loop=0,
+                   optimize=False)
+
+
+if __name__ == "__main__":
+    os.makedirs(OUT, exist_ok=True)
+    gradient()
+    sprite()
+    noise()
@@ -0,0 +1,93 @@
+/**
+ * Just enough of the Arduino core for the DrawMatrix modules that do not touch the hardware to build on a PC (see
+ * tools/host/bench.sh). Time comes from std::chrono; Serial prints to stdout.
+ */
+#ifndef DRAWMATRIX_HOST_ARDUINO
+#define DRAWMATRIX_HOST_ARDUINO
+
+#include <chrono>
+#include <cmath>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#define PROGMEM
+#define F_CPU 80000000L
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+
+#define IRAM_ATTR
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define noInterrupts()
+#define interrupts()
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+class __FlashStringHelper;
+
+inline unsigned long micros() {
+    static const auto start = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+inline unsigned long millis() { return micros() / 1000; }
+inline void yield() {}
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+#ifdef ESP8266
+// Adafruit_NeoPixel::show() hands its buffer to this; there is no strip to send it to
+extern "C" inline void espShow(uint16_t, uint8_t *, uint32_t, uint8_t) {}
+#endif
+
+class String {
+  public:
+    String() = default;
+    String(const char *s) : m_s(s ? s : "") {}
+    const char *c_str() const { return m_s.c_str(); }
+    unsigned int length() const { return m_s.length(); }
+
+  private:
+    std::string m_s;
+};
+
+class Print {
+  public:
+    virtual ~Print() = default;
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size) {
+        size_t n = 0;
+        while (size--) {
+            n += write(*buffer++);
+        }
+        return n;
+    }
+    size_t write(const char *s) { return write(reinterpret_cast<const uint8_t *>(s), strlen(s)); }
+    size_t print(const char *s) { return write(s); }
+    size_t print(const String &s) { return write(s.c_str()); }
+    size_t println(const char *s) { return write(s) + write("\n"); }
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3))) {
+        char buffer[256];
+        va_list args;
+        va_start(args, format);
+        vsnprintf(buffer, sizeof(buffer), format, args);
+        va_end(args);
+        return write(buffer);
+    }
+};
+
+class HostSerial : public Print {
+  public:
+    size_t write(uint8_t c) override { return fputc(c, stdout) == EOF ? 0 : 1; }
+    using Print::write;
+};
+inline HostSerial Serial;
+
+#endif /* DRAWMATRIX_HOST_ARDUINO */
@@ -0,0 +1,48 @@
+/**
+ * Files of the host file system behind the fs::File interface the DrawMatrix modules use.
+ */
+#ifndef DRAWMATRIX_HOST_FS
+#define DRAWMATRIX_HOST_FS
+
+#include <memory>
+
+#include "Arduino.h"
+
+namespace fs {
+
+class File {
+  public:
+    File() = default;
+    explicit File(FILE *file) : m_file(file, fclose) {}
+    size_t read(uint8_t *buffer, size_t size) { return m_file ? fread(buffer, 1, size, m_file.get()) : 0; }
+    size_t write(const uint8_t *buffer, size_t size) { return m_file ? fwrite(buffer, 1, size, m_file.get()) : 0; }
+    bool seek(uint32_t pos) { return m_file && !fseek(m_file.get(), pos, SEEK_SET); }
+    size_t position() const { return m_file ? ftell(m_file.get()) : 0; }
+    size_t size() const {
+        if (!m_file) {
+            return 0;
+        }
+        const long pos = ftell(m_file.get());
+        fseek(m_file.get(), 0, SEEK_END);
+        const long end = ftell(m_file.get());
+        fseek(m_file.get(), pos, SEEK_SET);
+        return end;
+    }
+    void close() { m_file.reset(); }
+    explicit operator bool() const { return static_cast<bool>(m_file); }
+
+  private:
+    std::shared_ptr<FILE> m_file;
+};
+
+class FS {
+  public:
+    File open(const char *path, const char *mode) { return File(fopen(path, mode[0] == 'r' ? "rb" : "wb")); }
+    File open(const String &path, const char *mode) { return open(path.c_str(), mode); }
+};
+
+} // namespace fs
+
+using fs::File;
+
+#endif /* DRAWMATRIX_HOST_FS */
@@ -0,0 +1,4 @@
+#include "FS.h"
+
+// Paths are taken as they are, relative to the working directory
+inline fs::FS LittleFS;